@@ -0,0 +1,167 @@
+#include "components/Components.hpp"
+#include "network/Crc32.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "rollback/StateChecksum.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    std::uint32_t legacyPacketCrc(const std::uint8_t* data, std::size_t len)
+    {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < len; ++i) {
+            crc ^= static_cast<std::uint32_t>(data[i]);
+            for (int b = 0; b < 8; ++b) {
+                const bool lsb = (crc & 1u) != 0u;
+                crc >>= 1;
+                if (lsb)
+                    crc ^= 0xEDB88320u;
+            }
+        }
+        return ~crc;
+    }
+
+    struct LegacyTable
+    {
+        std::uint32_t entries[256];
+
+        LegacyTable()
+        {
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                std::uint32_t crc = i;
+                for (int b = 0; b < 8; ++b)
+                    crc = (crc & 1u) != 0u ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+                entries[i] = crc;
+            }
+        }
+    };
+
+    const LegacyTable kLegacyTable;
+
+    std::uint32_t legacyUpdate(std::uint32_t crc, const void* data, std::size_t length)
+    {
+        const auto* buf = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < length; i++)
+            crc = kLegacyTable.entries[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+        return crc;
+    }
+
+    std::uint32_t legacyStateChecksum(const std::unordered_map<EntityId, CachedEntityState>& entities)
+    {
+        std::vector<EntityId> sortedIds;
+        sortedIds.reserve(entities.size());
+        for (const auto& [id, _] : entities)
+            sortedIds.push_back(id);
+        std::sort(sortedIds.begin(), sortedIds.end());
+
+        std::uint32_t crc   = 0xFFFFFFFF;
+        std::uint32_t count = static_cast<std::uint32_t>(entities.size());
+        crc                 = legacyUpdate(crc, &count, sizeof(count));
+        for (EntityId id : sortedIds) {
+            const auto& state = entities.at(id);
+            crc               = legacyUpdate(crc, &id, sizeof(id));
+            crc               = legacyUpdate(crc, &state.posX, sizeof(state.posX));
+            crc               = legacyUpdate(crc, &state.posY, sizeof(state.posY));
+            crc               = legacyUpdate(crc, &state.velX, sizeof(state.velX));
+            crc               = legacyUpdate(crc, &state.velY, sizeof(state.velY));
+            crc               = legacyUpdate(crc, &state.health, sizeof(state.health));
+            crc               = legacyUpdate(crc, &state.lives, sizeof(state.lives));
+            crc               = legacyUpdate(crc, &state.score, sizeof(state.score));
+            crc               = legacyUpdate(crc, &state.status, sizeof(state.status));
+            crc               = legacyUpdate(crc, &state.entityType, sizeof(state.entityType));
+        }
+        return ~crc;
+    }
+
+    template <typename Fn> double nanosecondsPerCall(int iterations, Fn&& fn)
+    {
+        std::uint32_t sink = 0;
+        auto start         = Clock::now();
+        for (int it = 0; it < iterations; ++it)
+            sink ^= fn(it);
+        const double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        if (sink == 0x12345678u)
+            std::printf("sink\n");
+        return elapsed / iterations;
+    }
+
+    void benchBuffers(int iterations)
+    {
+        std::mt19937 rng(5);
+        std::vector<std::uint8_t> data(1400 + 8);
+        for (auto& byte : data)
+            byte = static_cast<std::uint8_t>(rng());
+
+        for (std::size_t size : {64, 512, 1400}) {
+            auto row = [&](const char* name, auto kernel) {
+                auto call = [&](int it) { return kernel(data.data() + (it & 7), size); };
+                double ns = nanosecondsPerCall(iterations, call);
+                std::printf("  %-26s %5zu B %10.1f ns %10.1f MB/s\n", name, size, ns,
+                            static_cast<double>(size) * 1000.0 / ns);
+            };
+            row("bitwise (legacy packet)", legacyPacketCrc);
+            row("table (legacy state)", [](const std::uint8_t* d, std::size_t n) { return ~legacyUpdate(~0u, d, n); });
+            row("ieee slicing-by-8", Crc32::ieeePortable);
+            row("ieee dispatched", Crc32::ieee);
+            row("castagnoli slicing-by-8", Crc32::castagnoliPortable);
+            row("castagnoli dispatched", Crc32::castagnoli);
+        }
+    }
+
+    void benchState(std::size_t entities, int iterations)
+    {
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> pos(0.0F, 1200.0F);
+        Registry registry;
+        for (std::size_t i = 0; i < entities; ++i) {
+            EntityId id = registry.createEntity();
+            registry.emplace<TransformComponent>(id, TransformComponent::create(pos(rng), pos(rng)));
+            registry.emplace<VelocityComponent>(id, VelocityComponent::create(1.0F, 0.0F));
+            registry.emplace<HealthComponent>(id, HealthComponent::create(30));
+        }
+        CaptureFrame frame;
+        captureFrame(registry, 0, frame);
+        std::unordered_map<EntityId, CachedEntityState> map;
+        for (std::size_t i = 0; i < frame.size(); ++i)
+            map[frame.ids[i]] = frame.states[i];
+
+        const std::size_t changed = entities / 10;
+        auto mutate               = [&](int it) {
+            for (std::size_t k = 0; k < changed; ++k) {
+                std::size_t i = (static_cast<std::size_t>(it) * changed + k) % frame.size();
+                frame.states[i].posX += 0.5F;
+            }
+        };
+
+        StateHash hash;
+        StateChecksum::update(hash, frame);
+        double legacy = nanosecondsPerCall(iterations, [&](int) { return legacyStateChecksum(map); });
+        double full   = nanosecondsPerCall(iterations, [&](int) { return StateChecksum::compute(frame); });
+        double incr   = nanosecondsPerCall(iterations, [&](int it) {
+            mutate(it);
+            StateChecksum::update(hash, frame);
+            return hash.value();
+        });
+        std::printf("state %5zu entities  legacy %9.1f us  full %9.1f us  incremental (%zu changed) %9.1f us\n",
+                    entities, legacy / 1000.0, full / 1000.0, changed, incr / 1000.0);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 20000;
+    std::printf("crc32 backends: ieee %s, castagnoli %s\n", Crc32::ieeeBackend(), Crc32::castagnoliBackend());
+    benchBuffers(iterations);
+    for (std::size_t entities : {100, 500, 2000})
+        benchState(entities, std::max(1, iterations / 20));
+    return 0;
+}
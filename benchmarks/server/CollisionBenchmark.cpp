@@ -0,0 +1,139 @@
+#include "systems/CollisionKernels.hpp"
+#include "systems/CollisionSystem.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct PackedShapes
+    {
+        std::vector<float> minX;
+        std::vector<float> maxX;
+        std::vector<float> minY;
+        std::vector<float> maxY;
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> radius;
+
+        CollisionBatch batch() const
+        {
+            return CollisionBatch{minX.data(),    maxX.data(),    minY.data(),  maxY.data(),
+                                  centerX.data(), centerY.data(), radius.data()};
+        }
+    };
+
+    PackedShapes makePacked(std::size_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(0.0F, 1200.0F);
+        std::uniform_real_distribution<float> size(8.0F, 48.0F);
+        PackedShapes p;
+        for (std::size_t i = 0; i < count; ++i) {
+            float x = pos(rng);
+            float y = pos(rng);
+            float r = size(rng);
+            p.minX.push_back(x - r);
+            p.maxX.push_back(x + r);
+            p.minY.push_back(y - r);
+            p.maxY.push_back(y + r);
+            p.centerX.push_back(x);
+            p.centerY.push_back(y);
+            p.radius.push_back(r);
+        }
+        return p;
+    }
+
+    double microseconds(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+
+    template <typename Kernel> double pairsPerMicrosecond(std::size_t count, int iterations, Kernel&& kernel)
+    {
+        auto start = Clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            kernel(it);
+        }
+        return static_cast<double>(count) * iterations / microseconds(start);
+    }
+
+    void benchKernels(int iterations)
+    {
+        std::mt19937 rng(42);
+        const std::size_t count   = 4096;
+        const PackedShapes packed = makePacked(count, rng);
+        const CollisionBatch b    = packed.batch();
+        std::vector<std::uint8_t> hits(count);
+        std::size_t sink = 0;
+
+        auto aabb = [&](auto kernel) {
+            return pairsPerMicrosecond(count, iterations, [&](int it) {
+                const std::size_t k = static_cast<std::size_t>(it) % count;
+                kernel(b, 0, count, std::array<float, 4>{b.minX[k], b.maxX[k], b.minY[k], b.maxY[k]}, hits.data());
+                sink += hits[k];
+            });
+        };
+        auto circle = [&](auto kernel) {
+            return pairsPerMicrosecond(count, iterations, [&](int it) {
+                const std::size_t k = static_cast<std::size_t>(it) % count;
+                kernel(b, 0, count, b.centerX[k], b.centerY[k], b.radius[k], hits.data());
+                sink += hits[k];
+            });
+        };
+
+        std::printf("%-28s %12.1f pairs/us\n", "aabb scalar", aabb(CollisionKernels::overlapAabbScalar));
+        std::printf("%-28s %12.1f pairs/us\n", "aabb batched", aabb(CollisionKernels::overlapAabb));
+        std::printf("%-28s %12.1f pairs/us\n", "circle scalar", circle(CollisionKernels::overlapCircleScalar));
+        std::printf("%-28s %12.1f pairs/us\n", "circle batched", circle(CollisionKernels::overlapCircle));
+        if (sink == 0)
+            std::printf("no hits\n");
+    }
+
+    void benchDetect(std::size_t entities, int iterations)
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> pos(0.0F, 1200.0F);
+        std::uniform_real_distribution<float> size(8.0F, 48.0F);
+        Registry registry;
+        for (std::size_t i = 0; i < entities; ++i) {
+            EntityId id = registry.createEntity();
+            registry.emplace<TransformComponent>(id, TransformComponent::create(pos(rng), pos(rng) * 0.6F));
+            if (i % 3 == 0) {
+                registry.emplace<ColliderComponent>(id, ColliderComponent::circle(size(rng) * 0.5F));
+            } else {
+                registry.emplace<HitboxComponent>(id, HitboxComponent::create(size(rng), size(rng), 0.0F, 0.0F, true));
+            }
+        }
+
+        CollisionSystem collisions;
+        collisions.detect(registry);
+        const CollisionStats before = collisions.stats();
+        auto start                  = Clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            collisions.detect(registry);
+        }
+        const double elapsed       = microseconds(start);
+        const CollisionStats after = collisions.stats();
+        const auto batched         = after.batchedPairs - before.batchedPairs;
+        const auto sat             = after.satPairs - before.satPairs;
+        std::printf("detect %5zu entities       %12.1f pairs/us (%zu batched, %zu sat, %.1f us/tick)\n", entities,
+                    static_cast<double>(batched + sat) / elapsed, batched / static_cast<std::size_t>(iterations),
+                    sat / static_cast<std::size_t>(iterations), elapsed / iterations);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 2000;
+    std::printf("collision kernels: %s (%zu lanes)\n", CollisionKernels::backend(), CollisionKernels::lanes());
+    benchKernels(iterations);
+    for (std::size_t entities : {250, 1000, 4000}) {
+        benchDetect(entities, std::max(1, iterations / 20));
+    }
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include "components/Components.hpp"
+#include "ecs/Registry.hpp"
+#include "network/NetworkCompression.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/ReplicationManager.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    std::size_t gAllocations = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++gAllocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    using State = std::unordered_map<std::uint32_t, SnapshotCodec::EntityFields>;
+
+    constexpr std::uint32_t kWarmupTicks = 120;
+
+    struct Totals
+    {
+        std::size_t v1Payload  = 0;
+        std::size_t v1Wire     = 0;
+        std::size_t v2Payload  = 0;
+        std::size_t v2Wire     = 0;
+        std::size_t entities   = 0;
+        std::size_t sendAllocs = 0;
+        std::size_t ackAllocs  = 0;
+    };
+
+    struct Scene
+    {
+        Registry registry;
+        std::vector<EntityId> players;
+        std::mt19937 rng{7};
+    };
+
+    EntityId spawn(Scene& scene, EntityTag tag, float x, float y, float vx, float vy)
+    {
+        EntityId id = scene.registry.createEntity();
+        scene.registry.emplace<TransformComponent>(id, TransformComponent::create(x, y));
+        scene.registry.emplace<VelocityComponent>(id, VelocityComponent::create(vx, vy));
+        scene.registry.emplace<TagComponent>(id, TagComponent::create(tag));
+        return id;
+    }
+
+    void populate(Scene& scene)
+    {
+        std::uniform_real_distribution<float> x(0.0F, 1280.0F);
+        std::uniform_real_distribution<float> y(0.0F, 720.0F);
+        for (int i = 0; i < 4; ++i) {
+            EntityId id = spawn(scene, EntityTag::Player, 100.0F, 150.0F + 120.0F * static_cast<float>(i), 0.0F, 0.0F);
+            scene.registry.emplace<HealthComponent>(id, HealthComponent::create(100));
+            scene.registry.emplace<LivesComponent>(id, LivesComponent::create(3, 3));
+            scene.registry.emplace<ScoreComponent>(id, ScoreComponent::create(0));
+            scene.players.push_back(id);
+        }
+        for (int i = 0; i < 40; ++i) {
+            EntityId id = spawn(scene, EntityTag::Enemy, x(scene.rng), y(scene.rng), -90.0F, 0.0F);
+            scene.registry.emplace<HealthComponent>(id, HealthComponent::create(30));
+        }
+        for (int i = 0; i < 80; ++i)
+            spawn(scene, EntityTag::Projectile, x(scene.rng), y(scene.rng), 600.0F, 0.0F);
+    }
+
+    void step(Scene& scene, std::uint32_t tick)
+    {
+        constexpr float dt = 1.0F / 60.0F;
+        const float phase  = static_cast<float>(tick) * dt;
+        for (std::size_t i = 0; i < scene.players.size(); ++i) {
+            auto& t = scene.registry.get<TransformComponent>(scene.players[i]);
+            t.x     = 200.0F + 80.0F * std::sin(phase + static_cast<float>(i));
+            t.y     = 150.0F + 120.0F * static_cast<float>(i) + 40.0F * std::cos(phase * 1.3F);
+            if (tick % 30 == i)
+                scene.registry.get<ScoreComponent>(scene.players[i]).value += 100;
+        }
+        std::vector<EntityId> expired;
+        for (EntityId id : scene.registry.view<TransformComponent, VelocityComponent>()) {
+            auto& t       = scene.registry.get<TransformComponent>(id);
+            const auto& v = scene.registry.get<VelocityComponent>(id);
+            t.x += v.vx * dt;
+            t.y += v.vy * dt;
+            if (t.x > 1400.0F)
+                expired.push_back(id);
+            else if (t.x < -100.0F)
+                t.x += 1400.0F;
+        }
+        std::uniform_int_distribution<std::size_t> shooter(0, scene.players.size() - 1);
+        for (EntityId id : expired) {
+            scene.registry.destroyEntity(id);
+            const auto& origin = scene.registry.get<TransformComponent>(scene.players[shooter(scene.rng)]);
+            spawn(scene, EntityTag::Projectile, origin.x + 40.0F, origin.y, 600.0F, 0.0F);
+        }
+    }
+
+    void appendV1(std::vector<std::uint8_t>& out, const SnapshotCodec::EntityHeader& header,
+                  const SnapshotCodec::EntityFields& f)
+    {
+        auto u16 = [&out](std::uint16_t v) {
+            out.push_back(static_cast<std::uint8_t>(v >> 8));
+            out.push_back(static_cast<std::uint8_t>(v & 0xFF));
+        };
+        u16(static_cast<std::uint16_t>(header.id >> 16));
+        u16(static_cast<std::uint16_t>(header.id & 0xFFFF));
+        u16(header.mask);
+        if (header.mask & SnapshotCodec::kFieldType)
+            out.push_back(f.type);
+        for (auto [field, value] : {std::pair{SnapshotCodec::kFieldPosX, f.posX}, {SnapshotCodec::kFieldPosY, f.posY},
+                                    {SnapshotCodec::kFieldVelX, f.velX}, {SnapshotCodec::kFieldVelY, f.velY},
+                                    {SnapshotCodec::kFieldHealth, f.health}}) {
+            if (header.mask & field)
+                u16(static_cast<std::uint16_t>(value));
+        }
+        if (header.mask & SnapshotCodec::kFieldStatus)
+            out.push_back(f.status);
+        if (header.mask & SnapshotCodec::kFieldScore) {
+            u16(static_cast<std::uint16_t>(static_cast<std::uint32_t>(f.score) >> 16));
+            u16(static_cast<std::uint16_t>(f.score & 0xFFFF));
+        }
+    }
+
+    std::size_t wireSize(const std::vector<std::uint8_t>& payload)
+    {
+        std::size_t size = payload.size();
+        if (size > 64)
+            size = std::min(size, Compression::compress(payload).size());
+        return PacketHeader::kSize + size + PacketHeader::kCrcSize;
+    }
+
+    void measure(const std::vector<std::uint8_t>& packet, std::map<std::uint32_t, State>& history, Totals& totals)
+    {
+        auto header = PacketHeader::decode(packet.data(), packet.size());
+        std::vector<std::uint8_t> payload(packet.begin() + PacketHeader::kSize,
+                                          packet.begin() + PacketHeader::kSize + header->payloadSize);
+        if (header->isCompressed)
+            payload = Compression::decompress(payload.data(), payload.size(), header->originalSize);
+
+        std::uint16_t count = static_cast<std::uint16_t>((payload[0] << 8) | payload[1]);
+        BitReader reader(payload.data() + 2, payload.size() - 2);
+        std::optional<std::uint32_t> baselineTick;
+        SnapshotCodec::readBaseline(reader, header->tickId, baselineTick);
+        const State* base = baselineTick ? &history[*baselineTick] : nullptr;
+        State state       = base != nullptr ? *base : State{};
+
+        std::vector<std::uint8_t> v1{static_cast<std::uint8_t>(count >> 8), static_cast<std::uint8_t>(count & 0xFF)};
+        std::uint32_t nextId = 0;
+        for (std::uint16_t i = 0; i < count; ++i) {
+            SnapshotCodec::EntityHeader entity{};
+            SnapshotCodec::EntityFields fields{};
+            SnapshotCodec::readEntityHeader(reader, nextId, baselineTick.has_value(), entity);
+            const SnapshotCodec::EntityFields* prior = nullptr;
+            if (entity.delta)
+                prior = &base->at(entity.id);
+            SnapshotCodec::readEntityFields(reader, entity, prior, fields);
+            state[entity.id] = fields;
+            appendV1(v1, entity, fields);
+        }
+        history[header->tickId] = std::move(state);
+
+        totals.v1Payload += v1.size();
+        totals.v1Wire += wireSize(v1);
+        totals.v2Payload += payload.size();
+        totals.v2Wire += packet.size();
+        totals.entities += count;
+    }
+
+    void report(const char* name, const Totals& t, std::uint32_t ticks)
+    {
+        auto perTick = [ticks](std::size_t bytes) { return static_cast<double>(bytes) / ticks; };
+        std::printf("%-24s %6.1f entities/tick\n", name, perTick(t.entities));
+        std::printf("  payload   v1 %8.1f B/tick   v2 %8.1f B/tick   (%.0f%%)\n", perTick(t.v1Payload),
+                    perTick(t.v2Payload), 100.0 * static_cast<double>(t.v2Payload) / static_cast<double>(t.v1Payload));
+        std::printf("  wire      v1 %8.1f B/tick   v2 %8.1f B/tick   (%.0f%%)\n", perTick(t.v1Wire),
+                    perTick(t.v2Wire), 100.0 * static_cast<double>(t.v2Wire) / static_cast<double>(t.v1Wire));
+        std::printf("  heap allocations after warm-up: capture+synchronize %.2f/tick, acknowledge %.2f/tick\n",
+                    perTick(t.sendAllocs), perTick(t.ackAllocs));
+    }
+
+    void run(const char* name, std::uint32_t ticks, bool forceFull, std::uint32_t ackDelay)
+    {
+        Scene scene;
+        populate(scene);
+        ReplicationManager manager;
+        std::map<std::uint32_t, State> history;
+        Totals totals;
+        Totals warmup;
+        for (std::uint32_t tick = 1; tick <= ticks + kWarmupTicks; ++tick) {
+            const bool measured = tick > kWarmupTicks;
+            step(scene, tick);
+            std::size_t before = gAllocations;
+            manager.capture(scene.registry, tick);
+            auto result = manager.synchronize("bench", forceFull);
+            if (measured)
+                totals.sendAllocs += gAllocations - before;
+            for (const auto& packet : result.packets)
+                measure(packet, history, measured ? totals : warmup);
+            before = gAllocations;
+            if (tick > ackDelay)
+                manager.acknowledge("bench", tick - ackDelay);
+            if (measured)
+                totals.ackAllocs += gAllocations - before;
+            history.erase(history.begin(), history.lower_bound(tick > 128 ? tick - 128 : 0));
+        }
+        report(name, totals, ticks);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const std::uint32_t ticks = argc > 1 ? static_cast<std::uint32_t>(std::atoi(argv[1])) : 600;
+    run("full state", ticks, true, 0);
+    run("acked, 3 tick delay", ticks, false, 3);
+    return 0;
+}
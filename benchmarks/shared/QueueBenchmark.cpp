@@ -0,0 +1,117 @@
+#include "concurrency/MpscQueue.hpp"
+#include "concurrency/SpscQueue.hpp"
+#include "concurrency/ThreadSafeQueue.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Item
+    {
+        std::uint32_t playerId = 0;
+        std::uint16_t sequence = 0;
+        std::uint16_t flags    = 0;
+        float x                = 0.0F;
+        float y                = 0.0F;
+        float angle            = 0.0F;
+        std::uint64_t stamp    = 0;
+    };
+
+    template <typename Queue> struct LockFree
+    {
+        static void push(Queue& q, const Item& item)
+        {
+            while (!q.push(item))
+                std::this_thread::yield();
+        }
+
+        static std::size_t drain(Queue& q, std::vector<Item>& out)
+        {
+            return q.drainInto(out);
+        }
+    };
+
+    struct Locked
+    {
+        static void push(ThreadSafeQueue<Item>& q, const Item& item)
+        {
+            q.push(item);
+        }
+
+        static std::size_t drain(ThreadSafeQueue<Item>& q, std::vector<Item>& out)
+        {
+            std::size_t count = 0;
+            Item item;
+            while (q.tryPop(item)) {
+                out.push_back(item);
+                ++count;
+            }
+            return count;
+        }
+    };
+
+    template <typename Queue, typename Ops> double millionsPerSecond(Queue& queue, int producers, int perProducer)
+    {
+        const std::size_t total = static_cast<std::size_t>(producers) * static_cast<std::size_t>(perProducer);
+        std::vector<std::thread> threads;
+        auto start = Clock::now();
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, p, perProducer] {
+                Item item;
+                item.playerId = static_cast<std::uint32_t>(p);
+                for (int i = 0; i < perProducer; ++i) {
+                    item.sequence = static_cast<std::uint16_t>(i);
+                    Ops::push(queue, item);
+                }
+            });
+        }
+
+        std::vector<Item> batch;
+        batch.reserve(4096);
+        std::size_t consumed = 0;
+        std::uint64_t sink   = 0;
+        while (consumed < total) {
+            batch.clear();
+            std::size_t got = Ops::drain(queue, batch);
+            if (got == 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            consumed += got;
+            sink += batch.back().sequence;
+        }
+        for (auto& t : threads)
+            t.join();
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if (sink == 0xFFFFFFFFFFFFFFFFull)
+            std::printf("sink\n");
+        return static_cast<double>(total) / seconds / 1e6;
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int perProducer = argc > 1 ? std::atoi(argv[1]) : 500000;
+    std::printf("%-22s %9s %14s\n", "queue", "producers", "Mitems/s");
+    for (int producers : {1, 2, 4, 8}) {
+        ThreadSafeQueue<Item> locked;
+        MpscQueue<Item> mpsc(4096);
+        double lockedRate = millionsPerSecond<ThreadSafeQueue<Item>, Locked>(locked, producers, perProducer);
+        double mpscRate   = millionsPerSecond<MpscQueue<Item>, LockFree<MpscQueue<Item>>>(mpsc, producers, perProducer);
+        std::printf("%-22s %9d %14.2f\n", "ThreadSafeQueue", producers, lockedRate);
+        std::printf("%-22s %9d %14.2f\n", "MpscQueue", producers, mpscRate);
+        if (producers == 1) {
+            SpscQueue<Item> spsc(4096);
+            double spscRate = millionsPerSecond<SpscQueue<Item>, LockFree<SpscQueue<Item>>>(spsc, 1, perProducer);
+            std::printf("%-22s %9d %14.2f\n", "SpscQueue", 1, spscRate);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "components/Components.hpp"
+#include "ecs/Registry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace BenchmarkWorld
+{
+    constexpr std::uint32_t kSeed = 7;
+
+    inline std::vector<EntityId> populate(Registry& registry, std::size_t count, std::uint32_t seed = kSeed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> x(0.0F, 1280.0F);
+        std::uniform_real_distribution<float> y(0.0F, 720.0F);
+        std::uniform_real_distribution<float> size(8.0F, 48.0F);
+        std::vector<EntityId> ids;
+        ids.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const EntityTag tag = i < 4 ? EntityTag::Player : (i % 3 == 0 ? EntityTag::Enemy : EntityTag::Projectile);
+            EntityId id         = registry.createEntity();
+            registry.emplace<TransformComponent>(id, TransformComponent::create(x(rng), y(rng)));
+            registry.emplace<VelocityComponent>(id, VelocityComponent::create(tag == EntityTag::Enemy ? -90.0F : 600.0F,
+                                                                              0.0F));
+            registry.emplace<TagComponent>(id, TagComponent::create(tag));
+            if (tag == EntityTag::Projectile) {
+                registry.emplace<ColliderComponent>(id, ColliderComponent::circle(size(rng) * 0.25F));
+            } else {
+                registry.emplace<HealthComponent>(id, HealthComponent::create(tag == EntityTag::Player ? 100 : 30));
+                registry.emplace<HitboxComponent>(id, HitboxComponent::create(size(rng), size(rng), 0.0F, 0.0F, true));
+            }
+            ids.push_back(id);
+        }
+        return ids;
+    }
+
+    inline void step(Registry& registry, std::uint32_t tick)
+    {
+        constexpr float dt = 1.0F / 60.0F;
+        for (auto [id, transform, velocity] : registry.view<TransformComponent, VelocityComponent>().each()) {
+            transform.x += velocity.vx * dt;
+            transform.y += velocity.vy * dt;
+            if (transform.x > 1400.0F)
+                transform.x -= 1500.0F;
+            else if (transform.x < -100.0F)
+                transform.x += 1500.0F;
+            if ((id + tick) % 16 == 0 && registry.has<HealthComponent>(id))
+                registry.get<HealthComponent>(id).current -= 1;
+        }
+    }
+} // namespace BenchmarkWorld
@@ -0,0 +1,25 @@
+#include "BenchmarkWorld.hpp"
+#include "systems/CollisionSystem.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    void BM_CollisionDetect(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Registry registry;
+        BenchmarkWorld::populate(registry, count);
+        CollisionSystem collisions;
+        collisions.detect(registry);
+        std::size_t hits = 0;
+        for (auto _ : state) {
+            hits = collisions.detect(registry).size();
+            benchmark::DoNotOptimize(hits);
+        }
+        state.counters["collisions"] = static_cast<double>(hits);
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+} // namespace
+
+BENCHMARK(BM_CollisionDetect)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,80 @@
+#include "BenchmarkWorld.hpp"
+#include "network/NetworkCompression.hpp"
+#include "network/PacketHeader.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "rollback/StateChecksum.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+
+namespace
+{
+    std::vector<std::uint8_t> framePayload(std::size_t size)
+    {
+        Registry registry;
+        BenchmarkWorld::populate(registry, size / sizeof(CachedEntityState) + 1);
+        CaptureFrame frame;
+        captureFrame(registry, 0, frame);
+        std::vector<std::uint8_t> payload(size);
+        std::memcpy(payload.data(), frame.states.data(), size);
+        return payload;
+    }
+
+    std::vector<std::uint8_t> randomPayload(std::size_t size)
+    {
+        std::mt19937 rng(BenchmarkWorld::kSeed);
+        std::vector<std::uint8_t> payload(size);
+        for (auto& byte : payload)
+            byte = static_cast<std::uint8_t>(rng());
+        return payload;
+    }
+
+    void BM_CompressionCompress(benchmark::State& state)
+    {
+        const auto input = framePayload(static_cast<std::size_t>(state.range(0)));
+        std::size_t size = 0;
+        for (auto _ : state) {
+            auto output = Compression::compress(input);
+            size        = output.size();
+            benchmark::DoNotOptimize(output.data());
+        }
+        state.counters["ratio"] = static_cast<double>(size) / static_cast<double>(input.size());
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+
+    void BM_CompressionDecompress(benchmark::State& state)
+    {
+        const auto input      = framePayload(static_cast<std::size_t>(state.range(0)));
+        const auto compressed = Compression::compress(input);
+        for (auto _ : state) {
+            auto output = Compression::decompress(compressed.data(), compressed.size(), input.size());
+            benchmark::DoNotOptimize(output.data());
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+
+    void BM_StateChecksumCompute(benchmark::State& state)
+    {
+        Registry registry;
+        BenchmarkWorld::populate(registry, static_cast<std::size_t>(state.range(0)));
+        CaptureFrame frame;
+        captureFrame(registry, 0, frame);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(StateChecksum::compute(frame));
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * frame.size()));
+    }
+
+    void BM_PacketHeaderCrc32(benchmark::State& state)
+    {
+        const auto input = randomPayload(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+            benchmark::DoNotOptimize(PacketHeader::crc32(input.data(), input.size()));
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+    }
+} // namespace
+
+BENCHMARK(BM_CompressionCompress)->Arg(256)->Arg(1400)->Arg(8192);
+BENCHMARK(BM_CompressionDecompress)->Arg(256)->Arg(1400)->Arg(8192);
+BENCHMARK(BM_StateChecksumCompute)->Arg(100)->Arg(500)->Arg(2000);
+BENCHMARK(BM_PacketHeaderCrc32)->Arg(64)->Arg(512)->Arg(1400);
@@ -0,0 +1,58 @@
+#include "BenchmarkWorld.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    void BM_RegistryCreateDestroy(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Registry registry;
+        std::vector<EntityId> ids;
+        ids.reserve(count);
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; ++i) {
+                EntityId id = registry.createEntity();
+                registry.emplace<TransformComponent>(id, TransformComponent::create(0.0F, 0.0F));
+                registry.emplace<VelocityComponent>(id, VelocityComponent::create(1.0F, 0.0F));
+                ids.push_back(id);
+            }
+            for (EntityId id : ids)
+                registry.destroyEntity(id);
+            ids.clear();
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void BM_RegistryViewIteration(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Registry registry;
+        BenchmarkWorld::populate(registry, count);
+        for (auto _ : state) {
+            float sum = 0.0F;
+            for (auto [id, transform, velocity] : registry.view<TransformComponent, VelocityComponent>().each())
+                sum += transform.x + velocity.vx;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void BM_RegistryViewIterationSparse(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        Registry registry;
+        BenchmarkWorld::populate(registry, count);
+        for (auto _ : state) {
+            std::int32_t sum = 0;
+            for (auto [id, transform, health] : registry.view<TransformComponent, HealthComponent>().each())
+                sum += health.current;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+} // namespace
+
+BENCHMARK(BM_RegistryCreateDestroy)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_RegistryViewIteration)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_RegistryViewIterationSparse)->Arg(100)->Arg(1000)->Arg(10000);
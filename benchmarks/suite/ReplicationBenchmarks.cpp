@@ -0,0 +1,114 @@
+#include "BenchmarkWorld.hpp"
+#include "network/SnapshotParser.hpp"
+#include "replication/ReplicationManager.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+
+namespace
+{
+    constexpr std::uint32_t kWarmupTicks  = 8;
+    constexpr std::uint32_t kAckDelay     = 3;
+    constexpr std::size_t kUncappedBudget = std::numeric_limits<std::uint16_t>::max();
+
+    struct ReplicationScene
+    {
+        Registry registry;
+        ReplicationManager manager;
+        std::uint32_t tick = 0;
+
+        ReplicationScene(std::size_t count, std::size_t byteBudget)
+        {
+            BenchmarkWorld::populate(registry, count);
+            manager.setByteBudget(byteBudget);
+        }
+
+        ReplicationManager::SyncResult advance(bool forceFull)
+        {
+            ++tick;
+            BenchmarkWorld::step(registry, tick);
+            manager.capture(registry, tick);
+            auto result = manager.synchronize("bench", forceFull);
+            if (tick > kAckDelay)
+                manager.acknowledge("bench", tick - kAckDelay);
+            return result;
+        }
+    };
+
+    std::size_t packetBytes(const ReplicationManager::SyncResult& result)
+    {
+        std::size_t bytes = 0;
+        for (const auto& packet : result.packets)
+            bytes += packet.size();
+        return bytes;
+    }
+
+    void synchronize(benchmark::State& state, bool forceFull, std::size_t byteBudget)
+    {
+        ReplicationScene scene(static_cast<std::size_t>(state.range(0)), byteBudget);
+        for (std::uint32_t i = 0; i < kWarmupTicks; ++i)
+            scene.advance(forceFull);
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            auto result = scene.advance(forceFull);
+            bytes += packetBytes(result);
+            benchmark::DoNotOptimize(result.packets.data());
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+        state.counters["entities"] = static_cast<double>(scene.manager.replicatedCount());
+        state.counters["bytes/tick"] =
+            benchmark::Counter(static_cast<double>(bytes), benchmark::Counter::kAvgIterations);
+    }
+
+    void BM_ReplicationSynchronizeFull(benchmark::State& state)
+    {
+        synchronize(state, true, kUncappedBudget);
+    }
+
+    void BM_ReplicationSynchronizeDelta(benchmark::State& state)
+    {
+        synchronize(state, false, kUncappedBudget);
+    }
+
+    void BM_ReplicationSynchronizeFullBudgeted(benchmark::State& state)
+    {
+        synchronize(state, true, ReplicationManager::kClientByteBudget);
+    }
+
+    void BM_ReplicationSynchronizeDeltaBudgeted(benchmark::State& state)
+    {
+        synchronize(state, false, ReplicationManager::kClientByteBudget);
+    }
+
+    void BM_SnapshotParserParse(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        ReplicationScene scene(count, kUncappedBudget);
+        auto result = scene.advance(true);
+        if (result.packets.size() != 1) {
+            state.SkipWithError("snapshot was split into chunks");
+            return;
+        }
+        const std::vector<std::uint8_t> packet = result.packets.front();
+        const auto probe                       = SnapshotParser::parse(packet);
+        if (!probe || probe->entities.size() != count) {
+            state.SkipWithError("snapshot does not hold every entity");
+            return;
+        }
+        std::size_t entities = 0;
+        for (auto _ : state) {
+            auto parsed = SnapshotParser::parse(packet);
+            entities    = parsed ? parsed->entities.size() : 0;
+            benchmark::DoNotOptimize(parsed);
+        }
+        state.counters["entities"] = static_cast<double>(entities);
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * packet.size()));
+    }
+} // namespace
+
+BENCHMARK(BM_ReplicationSynchronizeFull)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReplicationSynchronizeDelta)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReplicationSynchronizeFullBudgeted)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReplicationSynchronizeDeltaBudgeted)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SnapshotParserParse)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
@@ -35,6 +35,7 @@ extern bool g_networkDebugEnabled;
 extern bool g_isRoomHost;
 extern bool g_joinAsSpectator;
 extern std::uint8_t g_expectedPlayerCount;
+extern std::uint32_t g_joinRoomId;
 extern ColorFilterMode g_colorFilterMode;
 extern std::atomic<bool> g_forceExit;
 
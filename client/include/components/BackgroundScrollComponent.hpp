@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
+
 struct BackgroundScrollComponent
 {
     float speedX       = 0.0F;
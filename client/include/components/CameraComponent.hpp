@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
+
 #include <cstdint>
 #include <limits>
 
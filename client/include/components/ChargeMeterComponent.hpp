@@ -1,5 +1,6 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
 #include "ecs/ResetValue.hpp"
 
 struct ChargeMeterComponent
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "components/ComponentIds.hpp"
+
+struct AnimationComponent;
+struct AudioComponent;
+struct BackgroundScrollComponent;
+struct BossComponent;
+struct BoxComponent;
+struct ButtonComponent;
+struct CameraComponent;
+struct ChargeMeterComponent;
+struct DirectionalAnimationComponent;
+struct FocusableComponent;
+struct FollowerFacingComponent;
+struct InputFieldComponent;
+struct InputHistoryComponent;
+struct InterpolationComponent;
+struct LayerComponent;
+struct NetworkStatsComponent;
+struct SpriteComponent;
+struct TextComponent;
+
+using ClientComponents =
+    ComponentList<SpriteComponent, LayerComponent, InterpolationComponent, AnimationComponent,
+                  DirectionalAnimationComponent, FollowerFacingComponent, BackgroundScrollComponent, CameraComponent,
+                  TextComponent, BoxComponent, ButtonComponent, FocusableComponent, InputFieldComponent,
+                  ChargeMeterComponent, AudioComponent, BossComponent, InputHistoryComponent, NetworkStatsComponent>;
+
+static_assert(SharedComponents::size + ClientComponents::size <= ComponentTypeId::kStaticCapacity,
+              "Too many statically registered components");
+
+template <typename Component>
+    requires(ClientComponents::contains<Component>)
+struct StaticComponentId<Component>
+    : std::integral_constant<std::size_t, SharedComponents::size + ClientComponents::indexOf<Component>()>
+{};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
+
 struct FollowerFacingComponent
 {
     bool initialized = false;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
+
 #include <cstdint>
 
 enum class InterpolationMode : std::uint8_t
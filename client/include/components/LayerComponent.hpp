@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
+
 namespace RenderLayer
 {
     constexpr int Background = -100;
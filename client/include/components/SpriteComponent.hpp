@@ -1,5 +1,6 @@
 #pragma once
 
+#include "components/ClientComponentIds.hpp"
 #include "ecs/ResetValue.hpp"
 #include "graphics/abstraction/Common.hpp"
 #include "graphics/abstraction/ISprite.hpp"
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "concurrency/SpscQueue.hpp"
 #include "concurrency/ThreadSafeQueue.hpp"
 #include "input/InputBuffer.hpp"
 #include "network/EntityDestroyedPacket.hpp"
@@ -15,6 +16,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 #include <thread>
@@ -22,12 +24,14 @@
 
 struct NetPipelines
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw{4096};
+    std::deque<std::vector<std::uint8_t>> rawPending;
+    std::atomic<std::uint64_t> rawDropped{0};
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     ThreadSafeQueue<LevelEventData> levelEvents;
-    ThreadSafeQueue<EntitySpawnPacket> spawns;
-    ThreadSafeQueue<EntityDestroyedPacket> destroys;
+    SpscQueue<EntitySpawnPacket> spawns{4096};
+    SpscQueue<EntityDestroyedPacket> destroys{4096};
     ThreadSafeQueue<std::string> disconnectEvents;
     ThreadSafeQueue<NotificationData>* broadcastQueue = nullptr;
     std::shared_ptr<UdpSocket> socket;
@@ -40,18 +44,20 @@ struct NetPipelines
     std::atomic<bool> joinDenied{false};
     std::atomic<bool> joinAccepted{false};
     std::atomic<std::uint32_t> receivedPlayerId{0};
+    std::atomic<std::uint32_t> lastSnapshotTick{0};
 };
 
-std::vector<std::uint8_t> buildClientHello(std::uint16_t sequence);
-void sendClientHelloOnce(const IpEndpoint& server, UdpSocket& socket);
+std::vector<std::uint8_t> buildClientHello(std::uint16_t sequence, std::uint32_t roomId = 0);
+void sendClientHelloOnce(const IpEndpoint& server, UdpSocket& socket, std::uint32_t roomId = 0);
 void sendJoinRequestOnce(const IpEndpoint& server, std::uint16_t sequence, UdpSocket& socket, bool spectator = false,
-                         std::uint32_t userId = 0);
+                         std::uint32_t userId = 0, std::uint32_t roomId = 0);
 void sendClientReadyOnce(const IpEndpoint& server, std::uint16_t sequence, UdpSocket& socket);
 void sendPingOnce(const IpEndpoint& server, std::uint16_t sequence, UdpSocket& socket);
 void sendWelcomeLoop(const IpEndpoint& server, std::atomic<bool>& stopFlag, UdpSocket& socket, bool spectator = false,
-                     std::uint32_t userId = 0);
+                     std::uint32_t userId = 0, std::uint32_t roomId = 0);
 void sendClientReady(const IpEndpoint& server, UdpSocket& socket);
 void sendClientReadyLoop(const IpEndpoint& server, std::atomic<bool>& stopFlag, UdpSocket& socket);
+void forwardRawPacket(NetPipelines& net, std::vector<std::uint8_t>&& packet);
 bool startReceiver(NetPipelines& net, std::uint16_t port, std::atomic<bool>& handshakeFlag,
                    ThreadSafeQueue<NotificationData>* broadcastQueue = nullptr);
 bool startSender(NetPipelines& net, InputBuffer& inputBuffer, std::uint16_t clientId, const IpEndpoint& server);
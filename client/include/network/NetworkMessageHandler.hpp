@@ -1,5 +1,6 @@
 #pragma once
 
+#include "concurrency/SpscQueue.hpp"
 #include "concurrency/ThreadSafeQueue.hpp"
 #include "network/EntityDestroyedPacket.hpp"
 #include "network/EntitySpawnPacket.hpp"
@@ -7,12 +8,14 @@
 #include "network/LevelEventData.hpp"
 #include "network/LevelInitData.hpp"
 #include "network/PacketHeader.hpp"
+#include "network/SnapshotHistory.hpp"
 #include "network/SnapshotParser.hpp"
 #include "ui/NotificationData.hpp"
 
 #include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <optional>
 #include <vector>
@@ -21,16 +24,17 @@ class NetworkMessageHandler
 {
   public:
     NetworkMessageHandler(
-        ThreadSafeQueue<std::vector<std::uint8_t>>& rawQueue, ThreadSafeQueue<SnapshotParseResult>& snapshotQueue,
+        SpscQueue<std::vector<std::uint8_t>>& rawQueue, SpscQueue<SnapshotParseResult>& snapshotQueue,
         ThreadSafeQueue<LevelInitData>& levelInitQueue, ThreadSafeQueue<LevelEventData>& levelEventQueue,
-        ThreadSafeQueue<EntitySpawnPacket>& spawnQueue, ThreadSafeQueue<EntityDestroyedPacket>& destroyQueue,
+        SpscQueue<EntitySpawnPacket>& spawnQueue, SpscQueue<EntityDestroyedPacket>& destroyQueue,
         ThreadSafeQueue<std::string>* disconnectQueue     = nullptr,
         ThreadSafeQueue<NotificationData>* broadcastQueue = nullptr, std::atomic<bool>* handshakeFlag = nullptr,
         std::atomic<bool>* allReadyFlag = nullptr, std::atomic<int>* countdownValueFlag = nullptr,
         std::atomic<bool>* gameStartFlag = nullptr, std::atomic<bool>* joinDeniedFlag = nullptr,
-        std::atomic<bool>* joinAcceptedFlag = nullptr, std::atomic<std::uint32_t>* receivedPlayerIdFlag = nullptr);
-    NetworkMessageHandler(ThreadSafeQueue<std::vector<std::uint8_t>>& rawQueue,
-                          ThreadSafeQueue<SnapshotParseResult>& snapshotQueue,
+        std::atomic<bool>* joinAcceptedFlag = nullptr, std::atomic<std::uint32_t>* receivedPlayerIdFlag = nullptr,
+        std::atomic<std::uint32_t>* snapshotTickFlag = nullptr);
+    NetworkMessageHandler(SpscQueue<std::vector<std::uint8_t>>& rawQueue,
+                          SpscQueue<SnapshotParseResult>& snapshotQueue,
                           ThreadSafeQueue<LevelInitData>& levelInitQueue);
 
     void poll();
@@ -60,12 +64,14 @@ class NetworkMessageHandler
         std::chrono::steady_clock::time_point lastUpdate{};
     };
 
-    ThreadSafeQueue<std::vector<std::uint8_t>>& rawQueue_;
-    ThreadSafeQueue<SnapshotParseResult>& snapshotQueue_;
+    SpscQueue<std::vector<std::uint8_t>>& rawQueue_;
+    SpscQueue<SnapshotParseResult>& snapshotQueue_;
     ThreadSafeQueue<LevelInitData>& levelInitQueue_;
     ThreadSafeQueue<LevelEventData>& levelEventQueue_;
-    ThreadSafeQueue<EntitySpawnPacket>& spawnQueue_;
-    ThreadSafeQueue<EntityDestroyedPacket>& destroyQueue_;
+    SpscQueue<EntitySpawnPacket>& spawnQueue_;
+    SpscQueue<EntityDestroyedPacket>& destroyQueue_;
+    std::deque<EntitySpawnPacket> pendingSpawns_;
+    std::deque<EntityDestroyedPacket> pendingDestroys_;
     std::atomic<bool>* handshakeFlag_;
     std::atomic<bool>* allReadyFlag_;
     std::atomic<int>* countdownValueFlag_;
@@ -73,9 +79,12 @@ class NetworkMessageHandler
     std::atomic<bool>* joinDeniedFlag_;
     std::atomic<bool>* joinAcceptedFlag_;
     std::atomic<std::uint32_t>* receivedPlayerIdFlag_;
+    std::atomic<std::uint32_t>* snapshotTickFlag_;
     ThreadSafeQueue<std::string>* disconnectQueue_;
     ThreadSafeQueue<NotificationData>* broadcastQueue_;
+    std::vector<std::vector<std::uint8_t>> rawBatch_;
     std::map<std::uint32_t, ChunkAccumulator> chunkAccumulators_;
+    SnapshotHistory snapshotHistory_;
     std::chrono::steady_clock::time_point lastPacketTime_;
 
     ThreadSafeQueue<GameEndPacket> gameEndQueue_;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "network/PacketHeader.hpp"
+#include "network/UdpReactor.hpp"
 #include "network/UdpSocket.hpp"
 
 #include <atomic>
@@ -31,6 +32,7 @@ class NetworkReceiver
     IpEndpoint actualEndpoint_{};
     SnapshotHandler handler_;
     std::shared_ptr<UdpSocket> socket_;
+    UdpReactor reactor_;
     bool ownsSocket_{false};
     std::thread thread_;
     std::atomic<bool> running_{false};
@@ -30,10 +30,15 @@ class NetworkSender
     {
         playerId_ = playerId;
     }
+    void setAcknowledgeSource(const std::atomic<std::uint32_t>* snapshotTick)
+    {
+        ackSource_ = snapshotTick;
+    }
 
   private:
     void loop();
     void sendCommand(const InputCommand& cmd);
+    void sendAcknowledge();
     InputPacket buildPacket(const InputCommand& cmd) const;
     void reportError(const IError& err);
 
@@ -49,4 +54,7 @@ class NetworkSender
     std::chrono::milliseconds interval_;
     std::uint32_t playerId_;
     ErrorHandler onError_;
+    const std::atomic<std::uint32_t>* ackSource_{nullptr};
+    std::uint32_t lastAcknowledged_{0};
+    std::uint16_t ackSequence_{0};
 };
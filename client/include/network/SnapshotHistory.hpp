@@ -0,0 +1,30 @@
+#pragma once
+
+#include "network/SnapshotCodec.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+class SnapshotHistory
+{
+  public:
+    static constexpr std::size_t kCapacity = 128;
+
+    using State = std::unordered_map<std::uint32_t, SnapshotCodec::EntityFields>;
+
+    std::shared_ptr<const State> find(std::uint32_t tick) const;
+    std::shared_ptr<State> derive(const std::shared_ptr<const State>& base) const;
+    void store(std::uint32_t tick, std::shared_ptr<const State> state);
+    void forget(std::uint32_t entityId);
+    void clear();
+    std::size_t size() const;
+
+  private:
+    std::deque<std::pair<std::uint32_t, std::shared_ptr<const State>>> entries_;
+    std::unordered_set<std::uint32_t> forgotten_;
+};
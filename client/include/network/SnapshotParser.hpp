@@ -1,8 +1,11 @@
 #pragma once
 
 #include "network/PacketHeader.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "network/SnapshotHistory.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -32,18 +35,19 @@ struct SnapshotParseResult
 class SnapshotParser
 {
   public:
-    static std::optional<SnapshotParseResult> parse(const std::vector<std::uint8_t>& data);
+    static std::optional<SnapshotParseResult> parse(const std::vector<std::uint8_t>& data,
+                                                    SnapshotHistory* history = nullptr);
+    static std::optional<SnapshotParseResult> parse(const std::vector<std::uint8_t>& data,
+                                                    const SnapshotHistory& history,
+                                                    std::shared_ptr<const SnapshotHistory::State>& state);
 
   private:
-    static bool hasBit(std::uint16_t mask, int bit);
-    static bool ensureAvailable(std::size_t offset, std::size_t need, std::size_t size);
+    static std::optional<SnapshotParseResult> decode(const std::vector<std::uint8_t>& data,
+                                                     const SnapshotHistory* history,
+                                                     std::shared_ptr<SnapshotHistory::State>* state);
     static bool validateHeader(const std::vector<std::uint8_t>& data, PacketHeader& outHeader);
     static bool validateCrc(const std::vector<std::uint8_t>& data, const PacketHeader& header);
     static bool validateSizes(const std::vector<std::uint8_t>& data, const PacketHeader& header);
-    static std::uint16_t readU16(const std::vector<std::uint8_t>& buf, std::size_t& offset);
-    static std::uint32_t readU32(const std::vector<std::uint8_t>& buf, std::size_t& offset);
-    static std::int32_t readI32(const std::vector<std::uint8_t>& buf, std::size_t& offset);
-    static float readFloat(const std::vector<std::uint8_t>& buf, std::size_t& offset);
-    static std::optional<SnapshotEntity> parseEntity(const std::vector<std::uint8_t>& data, std::size_t& offset,
-                                                     const PacketHeader& header);
+    static SnapshotEntity toEntity(const SnapshotCodec::EntityHeader& header,
+                                   const SnapshotCodec::EntityFields& fields);
 };
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "rollback/ClientStateHistory.hpp"
+#include "rollback/StateHash.hpp"
 
 #include <cstdint>
 #include <functional>
 #include <mutex>
 #include <optional>
+#include <vector>
 
 class Registry;
 
@@ -29,13 +31,15 @@ class ClientRollbackHandler
     void setRollbackCallback(std::function<void(std::uint64_t, std::uint64_t)> callback);
 
   private:
-    std::unordered_map<EntityId, ClientEntityState> extractEntityStates(const Registry& registry) const;
+    void extractEntityStates(const Registry& registry);
 
-    void restoreEntityStates(Registry& registry, const std::unordered_map<EntityId, ClientEntityState>& states) const;
-
-    std::uint32_t computeChecksum(const std::unordered_map<EntityId, ClientEntityState>& states) const;
+    void restoreEntityStates(Registry& registry, const ClientStateSnapshot& snapshot) const;
 
     ClientStateHistory stateHistory_;
+    StateHash stateHash_;
+    std::vector<EntityId> ids_;
+    std::vector<ClientEntityState> states_;
+    ClientStateSnapshot restored_;
     mutable std::mutex historyMutex_;
     std::function<void(std::uint64_t, std::uint64_t)> rollbackCallback_;
     std::mutex callbackMutex_;
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ClientRuntime.hpp"
-#include "concurrency/ThreadSafeQueue.hpp"
+#include "concurrency/SpscQueue.hpp"
 #include "graphics/abstraction/ISound.hpp"
 #include "graphics/abstraction/ISoundBuffer.hpp"
 #include "level/EntityTypeRegistry.hpp"
@@ -19,9 +19,9 @@
 class ReplicationSystem : public ISystem
 {
   public:
-    ReplicationSystem(ThreadSafeQueue<SnapshotParseResult>& snapshots, ThreadSafeQueue<EntitySpawnPacket>& spawns,
-                      ThreadSafeQueue<EntityDestroyedPacket>& destroys, const EntityTypeRegistry& types);
-    ReplicationSystem(ThreadSafeQueue<SnapshotParseResult>& snapshots, const EntityTypeRegistry& types);
+    ReplicationSystem(SpscQueue<SnapshotParseResult>& snapshots, SpscQueue<EntitySpawnPacket>& spawns,
+                      SpscQueue<EntityDestroyedPacket>& destroys, const EntityTypeRegistry& types);
+    ReplicationSystem(SpscQueue<SnapshotParseResult>& snapshots, const EntityTypeRegistry& types);
 
     void initialize() override;
     void update(Registry& registry, float deltaTime) override;
@@ -44,10 +44,13 @@ class ReplicationSystem : public ISystem
     bool isEnemyEntity(const Registry& registry, EntityId id) const;
     bool isPlayerEntity(const Registry& registry, EntityId id) const;
 
-    ThreadSafeQueue<SnapshotParseResult>* snapshots_;
-    ThreadSafeQueue<EntitySpawnPacket>* spawnQueue_;
-    ThreadSafeQueue<EntityDestroyedPacket>* destroyQueue_;
+    SpscQueue<SnapshotParseResult>* snapshots_;
+    SpscQueue<EntitySpawnPacket>* spawnQueue_;
+    SpscQueue<EntityDestroyedPacket>* destroyQueue_;
     const EntityTypeRegistry* types_;
+    std::vector<EntitySpawnPacket> spawnBatch_;
+    std::vector<EntityDestroyedPacket> destroyBatch_;
+    std::vector<SnapshotParseResult> snapshotBatch_;
     std::unordered_map<std::uint32_t, EntityId> remoteToLocal_;
     std::unordered_map<std::uint32_t, std::uint16_t> remoteToType_;
     std::unordered_map<std::uint32_t, std::uint32_t> lastSeenTick_;
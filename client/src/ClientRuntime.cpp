@@ -15,6 +15,7 @@ bool g_networkDebugEnabled         = false;
 bool g_isRoomHost                  = false;
 bool g_joinAsSpectator             = false;
 std::uint8_t g_expectedPlayerCount = 0;
+std::uint32_t g_joinRoomId         = 0;
 ColorFilterMode g_colorFilterMode  = ColorFilterMode::None;
 std::atomic<bool> g_forceExit{false};
 
@@ -4,13 +4,23 @@
 
 #include <iostream>
 
-std::vector<std::uint8_t> buildClientHello(std::uint16_t sequence)
+namespace
+{
+    bool isDroppable(std::uint8_t messageType)
+    {
+        return messageType == static_cast<std::uint8_t>(MessageType::Snapshot) ||
+               messageType == static_cast<std::uint8_t>(MessageType::SnapshotChunk) ||
+               messageType == static_cast<std::uint8_t>(MessageType::ServerPong);
+    }
+} // namespace
+
+std::vector<std::uint8_t> buildClientHello(std::uint16_t sequence, std::uint32_t roomId)
 {
     PacketHeader hdr{};
     hdr.packetType  = static_cast<std::uint8_t>(PacketType::ClientToServer);
     hdr.messageType = static_cast<std::uint8_t>(MessageType::ClientHello);
     hdr.sequenceId  = sequence;
-    hdr.tickId      = 0;
+    hdr.tickId      = roomId;
     hdr.payloadSize = 0;
     auto encoded    = hdr.encode();
     std::vector<std::uint8_t> out(encoded.begin(), encoded.end());
@@ -22,9 +32,9 @@ std::vector<std::uint8_t> buildClientHello(std::uint16_t sequence)
     return out;
 }
 
-void sendClientHelloOnce(const IpEndpoint& server, UdpSocket& socket)
+void sendClientHelloOnce(const IpEndpoint& server, UdpSocket& socket, std::uint32_t roomId)
 {
-    auto pkt = buildClientHello(0);
+    auto pkt = buildClientHello(0, roomId);
     socket.sendTo(pkt.data(), pkt.size(), server);
 }
 
@@ -47,13 +57,13 @@ std::vector<std::uint8_t> buildSimplePacket(std::uint8_t messageType, std::uint1
 }
 
 void sendJoinRequestOnce(const IpEndpoint& server, std::uint16_t sequence, UdpSocket& socket, bool spectator,
-                         std::uint32_t userId)
+                         std::uint32_t userId, std::uint32_t roomId)
 {
     PacketHeader hdr{};
     hdr.packetType  = static_cast<std::uint8_t>(PacketType::ClientToServer);
     hdr.messageType = static_cast<std::uint8_t>(MessageType::ClientJoinRequest);
     hdr.sequenceId  = sequence;
-    hdr.tickId      = 0;
+    hdr.tickId      = roomId;
     hdr.payloadSize = 1 + sizeof(std::uint32_t);
 
     auto encoded = hdr.encode();
@@ -87,12 +97,12 @@ void sendPingOnce(const IpEndpoint& server, std::uint16_t sequence, UdpSocket& s
 }
 
 void sendWelcomeLoop(const IpEndpoint& server, std::atomic<bool>& stopFlag, UdpSocket& socket, bool spectator,
-                     std::uint32_t userId)
+                     std::uint32_t userId, std::uint32_t roomId)
 {
     std::uint16_t seq = 0;
     while (!stopFlag.load()) {
-        sendClientHelloOnce(server, socket);
-        sendJoinRequestOnce(server, ++seq, socket, spectator, userId);
+        sendClientHelloOnce(server, socket, roomId);
+        sendJoinRequestOnce(server, ++seq, socket, spectator, userId, roomId);
         sendPingOnce(server, ++seq, socket);
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
@@ -114,6 +124,27 @@ void sendClientReadyLoop(const IpEndpoint& server, std::atomic<bool>& stopFlag,
     }
 }
 
+void forwardRawPacket(NetPipelines& net, std::vector<std::uint8_t>&& packet)
+{
+    while (!net.rawPending.empty() && net.raw.push(std::move(net.rawPending.front())))
+        net.rawPending.pop_front();
+    if (net.rawPending.empty() && net.raw.push(std::move(packet)))
+        return;
+
+    const auto hdr = PacketHeader::decode(packet.data(), packet.size());
+    if (hdr.has_value() && !isDroppable(hdr->messageType)) {
+        if (net.rawPending.empty())
+            LOG_WARN("[Net]", "Raw packet queue full, holding messageType=", static_cast<int>(hdr->messageType),
+                     " until it drains");
+        net.rawPending.push_back(std::move(packet));
+        return;
+    }
+    const std::uint64_t dropped = net.rawDropped.fetch_add(1, std::memory_order_relaxed) + 1;
+    Logger::instance().addPacketDropped();
+    LOG_DEBUG("[Net]", "Raw packet queue full, dropped messageType=",
+              hdr.has_value() ? static_cast<int>(hdr->messageType) : -1, " total=", dropped);
+}
+
 bool startReceiver(NetPipelines& net, std::uint16_t port, std::atomic<bool>& handshakeFlag,
                    ThreadSafeQueue<NotificationData>* broadcastQueue)
 {
@@ -127,8 +158,8 @@ bool startReceiver(NetPipelines& net, std::uint16_t port, std::atomic<bool>& han
         }
     }
     net.receiver = std::make_unique<NetworkReceiver>(
-        IpEndpoint::v4(0, 0, 0, 0, port), [&](std::vector<std::uint8_t>&& packet) { net.raw.push(std::move(packet)); },
-        net.socket);
+        IpEndpoint::v4(0, 0, 0, 0, port),
+        [&](std::vector<std::uint8_t>&& packet) { forwardRawPacket(net, std::move(packet)); }, net.socket);
     if (!net.receiver->start()) {
         std::cerr << "Failed to start NetworkReceiver on port " << port << '\n';
         return false;
@@ -136,7 +167,7 @@ bool startReceiver(NetPipelines& net, std::uint16_t port, std::atomic<bool>& han
     net.handler = std::make_unique<NetworkMessageHandler>(
         net.raw, net.parsed, net.levelInit, net.levelEvents, net.spawns, net.destroys, &net.disconnectEvents,
         broadcastQueue, &handshakeFlag, &net.allReady, &net.countdownValue, &net.gameStartReceived, &net.joinDenied,
-        &net.joinAccepted, &net.receivedPlayerId);
+        &net.joinAccepted, &net.receivedPlayerId, &net.lastSnapshotTick);
     Logger::instance().info("Receiver started on port " + std::to_string(port));
     return true;
 }
@@ -146,6 +177,7 @@ bool startSender(NetPipelines& net, InputBuffer& inputBuffer, std::uint16_t clie
     net.sender = std::make_unique<NetworkSender>(
         inputBuffer, server, clientId, std::chrono::milliseconds(16), IpEndpoint::v4(0, 0, 0, 0, 0),
         [](const IError& err) { std::cerr << "NetworkSender error: " << err.what() << '\n'; }, net.socket);
+    net.sender->setAcknowledgeSource(&net.lastSnapshotTick);
     if (!net.sender->start()) {
         std::cerr << "Failed to start NetworkSender\n";
         return false;
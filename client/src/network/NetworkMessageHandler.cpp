@@ -8,33 +8,35 @@
 #include "systems/NetworkStatsSystem.hpp"
 
 #include <iostream>
+#include <memory>
 
 NetworkMessageHandler::NetworkMessageHandler(
-    ThreadSafeQueue<std::vector<std::uint8_t>>& rawQueue, ThreadSafeQueue<SnapshotParseResult>& snapshotQueue,
+    SpscQueue<std::vector<std::uint8_t>>& rawQueue, SpscQueue<SnapshotParseResult>& snapshotQueue,
     ThreadSafeQueue<LevelInitData>& levelInitQueue, ThreadSafeQueue<LevelEventData>& levelEventQueue,
-    ThreadSafeQueue<EntitySpawnPacket>& spawnQueue, ThreadSafeQueue<EntityDestroyedPacket>& destroyQueue,
+    SpscQueue<EntitySpawnPacket>& spawnQueue, SpscQueue<EntityDestroyedPacket>& destroyQueue,
     ThreadSafeQueue<std::string>* disconnectQueue, ThreadSafeQueue<NotificationData>* broadcastQueue,
     std::atomic<bool>* handshakeFlag, std::atomic<bool>* allReadyFlag, std::atomic<int>* countdownValueFlag,
     std::atomic<bool>* gameStartFlag, std::atomic<bool>* joinDeniedFlag, std::atomic<bool>* joinAcceptedFlag,
-    std::atomic<std::uint32_t>* receivedPlayerIdFlag)
+    std::atomic<std::uint32_t>* receivedPlayerIdFlag, std::atomic<std::uint32_t>* snapshotTickFlag)
     : rawQueue_(rawQueue), snapshotQueue_(snapshotQueue), levelInitQueue_(levelInitQueue),
       levelEventQueue_(levelEventQueue), spawnQueue_(spawnQueue), destroyQueue_(destroyQueue),
       handshakeFlag_(handshakeFlag), allReadyFlag_(allReadyFlag), countdownValueFlag_(countdownValueFlag),
       gameStartFlag_(gameStartFlag), joinDeniedFlag_(joinDeniedFlag), joinAcceptedFlag_(joinAcceptedFlag),
-      receivedPlayerIdFlag_(receivedPlayerIdFlag), disconnectQueue_(disconnectQueue), broadcastQueue_(broadcastQueue),
+      receivedPlayerIdFlag_(receivedPlayerIdFlag), snapshotTickFlag_(snapshotTickFlag),
+      disconnectQueue_(disconnectQueue), broadcastQueue_(broadcastQueue),
       lastPacketTime_(std::chrono::steady_clock::now())
 {}
 
 namespace
 {
-    ThreadSafeQueue<EntitySpawnPacket>& dummySpawnQueue()
+    SpscQueue<EntitySpawnPacket>& dummySpawnQueue()
     {
-        static ThreadSafeQueue<EntitySpawnPacket> q;
+        static SpscQueue<EntitySpawnPacket> q;
         return q;
     }
-    ThreadSafeQueue<EntityDestroyedPacket>& dummyDestroyQueue()
+    SpscQueue<EntityDestroyedPacket>& dummyDestroyQueue()
     {
-        static ThreadSafeQueue<EntityDestroyedPacket> q;
+        static SpscQueue<EntityDestroyedPacket> q;
         return q;
     }
     ThreadSafeQueue<LevelEventData>& dummyLevelEventQueue()
@@ -42,10 +44,24 @@ namespace
         static ThreadSafeQueue<LevelEventData> q;
         return q;
     }
+
+    template <typename T> void flushPending(SpscQueue<T>& queue, std::deque<T>& pending)
+    {
+        while (!pending.empty() && queue.push(pending.front()))
+            pending.pop_front();
+    }
+
+    template <typename T> void pushLossless(SpscQueue<T>& queue, std::deque<T>& pending, const T& value)
+    {
+        flushPending(queue, pending);
+        if (pending.empty() && queue.push(value))
+            return;
+        pending.push_back(value);
+    }
 } // namespace
 
-NetworkMessageHandler::NetworkMessageHandler(ThreadSafeQueue<std::vector<std::uint8_t>>& rawQueue,
-                                             ThreadSafeQueue<SnapshotParseResult>& snapshotQueue,
+NetworkMessageHandler::NetworkMessageHandler(SpscQueue<std::vector<std::uint8_t>>& rawQueue,
+                                             SpscQueue<SnapshotParseResult>& snapshotQueue,
                                              ThreadSafeQueue<LevelInitData>& levelInitQueue)
     : NetworkMessageHandler(rawQueue, snapshotQueue, levelInitQueue, dummyLevelEventQueue(), dummySpawnQueue(),
                             dummyDestroyQueue(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)
@@ -53,8 +69,11 @@ NetworkMessageHandler::NetworkMessageHandler(ThreadSafeQueue<std::vector<std::ui
 
 void NetworkMessageHandler::poll()
 {
-    std::vector<std::uint8_t> data;
-    while (rawQueue_.tryPop(data)) {
+    flushPending(spawnQueue_, pendingSpawns_);
+    flushPending(destroyQueue_, pendingDestroys_);
+    rawBatch_.clear();
+    rawQueue_.drainInto(rawBatch_);
+    for (const auto& data : rawBatch_) {
         dispatch(data);
     }
     auto now = std::chrono::steady_clock::now();
@@ -84,14 +103,23 @@ std::optional<PacketHeader> NetworkMessageHandler::decodeHeader(const std::vecto
 
 void NetworkMessageHandler::handleSnapshot(const std::vector<std::uint8_t>& data)
 {
-    auto parsed = SnapshotParser::parse(data);
+    std::shared_ptr<const SnapshotHistory::State> state;
+    auto parsed = SnapshotParser::parse(data, snapshotHistory_, state);
     if (!parsed.has_value()) {
         return;
     }
-    snapshotQueue_.push(std::move(*parsed));
     if (handshakeFlag_ != nullptr) {
         handshakeFlag_->store(true);
     }
+    std::uint32_t tick = parsed->header.tickId;
+    if (!snapshotQueue_.push(std::move(*parsed))) {
+        LOG_WARN("[Net]", "Snapshot queue full, tick ", tick, " left unacknowledged");
+        return;
+    }
+    snapshotHistory_.store(tick, std::move(state));
+    if (snapshotTickFlag_ != nullptr) {
+        snapshotTickFlag_->store(tick);
+    }
 }
 
 void NetworkMessageHandler::handleLevelInit(const std::vector<std::uint8_t>& data)
@@ -188,7 +216,7 @@ void NetworkMessageHandler::handleEntitySpawn(const std::vector<std::uint8_t>& d
 {
     auto pkt = EntitySpawnPacket::decode(data.data(), data.size());
     if (pkt.has_value()) {
-        spawnQueue_.push(*pkt);
+        pushLossless(spawnQueue_, pendingSpawns_, *pkt);
     }
 }
 
@@ -196,7 +224,8 @@ void NetworkMessageHandler::handleEntityDestroyed(const std::vector<std::uint8_t
 {
     auto pkt = EntityDestroyedPacket::decode(data.data(), data.size());
     if (pkt.has_value()) {
-        destroyQueue_.push(*pkt);
+        snapshotHistory_.forget(pkt->entityId);
+        pushLossless(destroyQueue_, pendingDestroys_, *pkt);
     }
 }
 
@@ -1,7 +1,5 @@
 #include "network/NetworkReceiver.hpp"
 
-#include <array>
-#include <chrono>
 #include <thread>
 
 NetworkReceiver::NetworkReceiver(const IpEndpoint& bindEndpoint, SnapshotHandler handler,
@@ -29,6 +27,13 @@ bool NetworkReceiver::start()
             return false;
         }
     }
+    auto onDatagram = [this](const std::uint8_t* data, std::size_t size, const IpEndpoint&) {
+        handlePacket(data, size);
+    };
+    if (!reactor_.open() || !reactor_.watch(*socket_, onDatagram)) {
+        reactor_.close();
+        return false;
+    }
     actualEndpoint_ = socket_->localEndpoint();
     running_        = true;
     thread_         = std::thread(&NetworkReceiver::loop, this);
@@ -38,9 +43,11 @@ bool NetworkReceiver::start()
 void NetworkReceiver::stop()
 {
     stopRequested_ = true;
+    reactor_.wake();
     if (thread_.joinable()) {
         thread_.join();
     }
+    reactor_.close();
     if (ownsSocket_ && socket_ != nullptr) {
         socket_->close();
     }
@@ -59,21 +66,8 @@ IpEndpoint NetworkReceiver::endpoint() const
 
 void NetworkReceiver::loop()
 {
-    std::array<std::uint8_t, 2048> buffer{};
-    IpEndpoint src{};
     while (!stopRequested_) {
-        UdpResult res = socket_->recvFrom(buffer.data(), buffer.size(), src);
-        if (!res.ok()) {
-            if (res.error == UdpError::WouldBlock || res.error == UdpError::Interrupted) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                continue;
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(5));
-            continue;
-        }
-        if (handlePacket(buffer.data(), res.size)) {
-            continue;
-        }
+        reactor_.poll(UdpReactor::kInfinite);
     }
     running_ = false;
 }
@@ -3,6 +3,7 @@
 #include "Logger.hpp"
 
 #include <chrono>
+#include <vector>
 
 NetworkSender::NetworkSender(InputBuffer& buffer, IpEndpoint remote, std::uint32_t playerId,
                              std::chrono::milliseconds interval, IpEndpoint bind, ErrorHandler onError,
@@ -70,6 +71,7 @@ void NetworkSender::loop()
         if (cmdOpt) {
             sendCommand(*cmdOpt);
         }
+        sendAcknowledge();
         auto elapsed = std::chrono::steady_clock::now() - startTick;
         if (elapsed < interval_) {
             std::this_thread::sleep_for(interval_ - elapsed);
@@ -88,6 +90,36 @@ void NetworkSender::sendCommand(const InputCommand& cmd)
     }
 }
 
+void NetworkSender::sendAcknowledge()
+{
+    if (ackSource_ == nullptr) {
+        return;
+    }
+    std::uint32_t tick = ackSource_->load();
+    if (tick == lastAcknowledged_) {
+        return;
+    }
+    PacketHeader hdr{};
+    hdr.packetType  = static_cast<std::uint8_t>(PacketType::ClientToServer);
+    hdr.messageType = static_cast<std::uint8_t>(MessageType::ClientAcknowledge);
+    hdr.sequenceId  = ackSequence_++;
+    hdr.tickId      = tick;
+    hdr.payloadSize = 0;
+    auto encoded    = hdr.encode();
+    std::vector<std::uint8_t> data(encoded.begin(), encoded.end());
+    auto crc = PacketHeader::crc32(data.data(), data.size());
+    data.push_back(static_cast<std::uint8_t>((crc >> 24) & 0xFF));
+    data.push_back(static_cast<std::uint8_t>((crc >> 16) & 0xFF));
+    data.push_back(static_cast<std::uint8_t>((crc >> 8) & 0xFF));
+    data.push_back(static_cast<std::uint8_t>(crc & 0xFF));
+    auto res = socket_->sendTo(data.data(), data.size(), remote_);
+    if (!res.ok()) {
+        reportError(NetworkSendSocketError("NetworkSender acknowledge sendTo failed"));
+        return;
+    }
+    lastAcknowledged_ = tick;
+}
+
 InputPacket NetworkSender::buildPacket(const InputCommand& cmd) const
 {
     InputPacket packet{};
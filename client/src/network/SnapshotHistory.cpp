@@ -0,0 +1,42 @@
+#include "network/SnapshotHistory.hpp"
+
+#include <algorithm>
+
+std::shared_ptr<const SnapshotHistory::State> SnapshotHistory::find(std::uint32_t tick) const
+{
+    auto it = std::find_if(entries_.rbegin(), entries_.rend(), [tick](const auto& e) { return e.first == tick; });
+    return it != entries_.rend() ? it->second : nullptr;
+}
+
+std::shared_ptr<SnapshotHistory::State> SnapshotHistory::derive(const std::shared_ptr<const State>& base) const
+{
+    auto state = base ? std::make_shared<State>(*base) : std::make_shared<State>();
+    for (std::uint32_t id : forgotten_)
+        state->erase(id);
+    return state;
+}
+
+void SnapshotHistory::store(std::uint32_t tick, std::shared_ptr<const State> state)
+{
+    std::erase_if(forgotten_, [&state](std::uint32_t id) { return state->contains(id); });
+    std::erase_if(entries_, [tick](const auto& e) { return e.first == tick; });
+    entries_.emplace_back(tick, std::move(state));
+    while (entries_.size() > kCapacity)
+        entries_.pop_front();
+}
+
+void SnapshotHistory::forget(std::uint32_t entityId)
+{
+    forgotten_.insert(entityId);
+}
+
+void SnapshotHistory::clear()
+{
+    entries_.clear();
+    forgotten_.clear();
+}
+
+std::size_t SnapshotHistory::size() const
+{
+    return entries_.size();
+}
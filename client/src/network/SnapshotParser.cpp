@@ -4,11 +4,34 @@
 #include "network/NetworkCompression.hpp"
 #include "network/Packing.hpp"
 
-#include <bit>
 #include <cstddef>
+#include <memory>
 #include <string>
 
-std::optional<SnapshotParseResult> SnapshotParser::parse(const std::vector<std::uint8_t>& data)
+std::optional<SnapshotParseResult> SnapshotParser::parse(const std::vector<std::uint8_t>& data,
+                                                          SnapshotHistory* history)
+{
+    std::shared_ptr<SnapshotHistory::State> state;
+    auto result = decode(data, history, history != nullptr ? &state : nullptr);
+    if (result.has_value() && history != nullptr) {
+        history->store(result->header.tickId, std::move(state));
+    }
+    return result;
+}
+
+std::optional<SnapshotParseResult> SnapshotParser::parse(const std::vector<std::uint8_t>& data,
+                                                          const SnapshotHistory& history,
+                                                          std::shared_ptr<const SnapshotHistory::State>& state)
+{
+    std::shared_ptr<SnapshotHistory::State> decoded;
+    auto result = decode(data, &history, &decoded);
+    state       = std::move(decoded);
+    return result;
+}
+
+std::optional<SnapshotParseResult> SnapshotParser::decode(const std::vector<std::uint8_t>& data,
+                                                           const SnapshotHistory* history,
+                                                           std::shared_ptr<SnapshotHistory::State>* outState)
 {
     PacketHeader header{};
     if (!validateHeader(data, header)) {
@@ -44,33 +67,59 @@ std::optional<SnapshotParseResult> SnapshotParser::parse(const std::vector<std::
         }
     }
 
-    std::size_t offset        = PacketHeader::kSize;
-    std::uint16_t entityCount = readU16(*currentData, offset);
+    const std::size_t payloadEnd = PacketHeader::kSize + currentHeader.payloadSize;
+    if (currentHeader.payloadSize < 2 || currentData->size() < payloadEnd) {
+        return std::nullopt;
+    }
+    const std::uint8_t* payload = currentData->data() + PacketHeader::kSize;
+    std::uint16_t entityCount   = static_cast<std::uint16_t>((payload[0] << 8) | payload[1]);
+    BitReader reader(payload + 2, currentHeader.payloadSize - 2);
+
+    std::optional<std::uint32_t> baselineTick;
+    if (!SnapshotCodec::readBaseline(reader, currentHeader.tickId, baselineTick)) {
+        return std::nullopt;
+    }
+    std::shared_ptr<const SnapshotHistory::State> base;
+    if (baselineTick.has_value()) {
+        base = history != nullptr ? history->find(*baselineTick) : nullptr;
+        if (!base) {
+            Logger::instance().warn("[Net] Snapshot " + std::to_string(currentHeader.tickId) +
+                                    " references unknown baseline " + std::to_string(*baselineTick));
+            return std::nullopt;
+        }
+    }
+    auto state = outState != nullptr ? history->derive(base) : nullptr;
 
     SnapshotParseResult result{};
     result.header = currentHeader;
     result.entities.reserve(entityCount);
 
+    std::uint32_t nextId = 0;
     for (std::uint16_t i = 0; i < entityCount; ++i) {
-        auto entity = parseEntity(*currentData, offset, currentHeader);
-        if (!entity.has_value()) {
+        SnapshotCodec::EntityHeader entity{};
+        SnapshotCodec::EntityFields fields{};
+        if (!SnapshotCodec::readEntityHeader(reader, nextId, baselineTick.has_value(), entity)) {
             return std::nullopt;
         }
-        result.entities.push_back(*entity);
+        const SnapshotCodec::EntityFields* prior = nullptr;
+        if (entity.delta) {
+            auto it = base->find(entity.id);
+            prior   = it != base->end() ? &it->second : nullptr;
+        }
+        if (!SnapshotCodec::readEntityFields(reader, entity, prior, fields)) {
+            return std::nullopt;
+        }
+        if (state) {
+            (*state)[entity.id] = fields;
+        }
+        result.entities.push_back(toEntity(entity, fields));
+    }
+    if (outState != nullptr) {
+        *outState = std::move(state);
     }
     return result;
 }
 
-bool SnapshotParser::hasBit(std::uint16_t mask, int bit)
-{
-    return (mask & (1u << bit)) != 0;
-}
-
-bool SnapshotParser::ensureAvailable(std::size_t offset, std::size_t need, std::size_t size)
-{
-    return offset + need <= size;
-}
-
 bool SnapshotParser::validateHeader(const std::vector<std::uint8_t>& data, PacketHeader& outHeader)
 {
     if (data.size() < PacketHeader::kSize + PacketHeader::kCrcSize) {
@@ -113,101 +162,39 @@ bool SnapshotParser::validateCrc(const std::vector<std::uint8_t>& data, const Pa
     return computedCrc == transmittedCrc;
 }
 
-std::uint16_t SnapshotParser::readU16(const std::vector<std::uint8_t>& buf, std::size_t& offset)
+SnapshotEntity SnapshotParser::toEntity(const SnapshotCodec::EntityHeader& header,
+                                        const SnapshotCodec::EntityFields& fields)
 {
-    std::uint16_t v = (static_cast<std::uint16_t>(buf[offset]) << 8) | static_cast<std::uint16_t>(buf[offset + 1]);
-    offset += 2;
-    return v;
-}
-
-std::uint32_t SnapshotParser::readU32(const std::vector<std::uint8_t>& buf, std::size_t& offset)
-{
-    std::uint32_t v = (static_cast<std::uint32_t>(buf[offset]) << 24) |
-                      (static_cast<std::uint32_t>(buf[offset + 1]) << 16) |
-                      (static_cast<std::uint32_t>(buf[offset + 2]) << 8) | static_cast<std::uint32_t>(buf[offset + 3]);
-    offset += 4;
-    return v;
-}
-
-std::int32_t SnapshotParser::readI32(const std::vector<std::uint8_t>& buf, std::size_t& offset)
-{
-    return static_cast<std::int32_t>(readU32(buf, offset));
-}
-
-float SnapshotParser::readFloat(const std::vector<std::uint8_t>& buf, std::size_t& offset)
-{
-    auto v = readU32(buf, offset);
-    return std::bit_cast<float>(v);
-}
-
-std::optional<SnapshotEntity> SnapshotParser::parseEntity(const std::vector<std::uint8_t>& data, std::size_t& offset,
-                                                          const PacketHeader& header)
-{
-    if (!ensureAvailable(offset, 6, PacketHeader::kSize + header.payloadSize)) {
-        return std::nullopt;
-    }
     SnapshotEntity e{};
-    e.entityId   = readU32(data, offset);
-    e.updateMask = readU16(data, offset);
-    auto mask    = e.updateMask;
-
-    if (hasBit(mask, 0)) {
-        if (!ensureAvailable(offset, 1, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.entityType = data[offset];
-        offset += 1;
+    e.entityId   = header.id;
+    e.updateMask = header.mask;
+    if (header.mask & SnapshotCodec::kFieldType) {
+        e.entityType = fields.type;
     }
-    if (hasBit(mask, 1)) {
-        if (!ensureAvailable(offset, 2, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.posX = Packing::dequantizeFrom16(static_cast<std::int16_t>(readU16(data, offset)), 10.0F);
+    if (header.mask & SnapshotCodec::kFieldPosX) {
+        e.posX = Packing::dequantizeFrom16(fields.posX, SnapshotCodec::kPositionScale);
     }
-    if (hasBit(mask, 2)) {
-        if (!ensureAvailable(offset, 2, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.posY = Packing::dequantizeFrom16(static_cast<std::int16_t>(readU16(data, offset)), 10.0F);
+    if (header.mask & SnapshotCodec::kFieldPosY) {
+        e.posY = Packing::dequantizeFrom16(fields.posY, SnapshotCodec::kPositionScale);
     }
-    if (hasBit(mask, 3)) {
-        if (!ensureAvailable(offset, 2, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.velX = Packing::dequantizeFrom16(static_cast<std::int16_t>(readU16(data, offset)), 10.0F);
+    if (header.mask & SnapshotCodec::kFieldVelX) {
+        e.velX = Packing::dequantizeFrom16(fields.velX, SnapshotCodec::kVelocityScale);
     }
-    if (hasBit(mask, 4)) {
-        if (!ensureAvailable(offset, 2, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.velY = Packing::dequantizeFrom16(static_cast<std::int16_t>(readU16(data, offset)), 10.0F);
+    if (header.mask & SnapshotCodec::kFieldVelY) {
+        e.velY = Packing::dequantizeFrom16(fields.velY, SnapshotCodec::kVelocityScale);
     }
-    if (hasBit(mask, 5)) {
-        if (!ensureAvailable(offset, 2, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        std::uint16_t hv = readU16(data, offset);
-        e.health         = static_cast<std::int16_t>(hv);
+    if (header.mask & SnapshotCodec::kFieldHealth) {
+        e.health = fields.health;
     }
-    if (hasBit(mask, 6)) {
-        if (!ensureAvailable(offset, 1, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        std::uint8_t packed = data[offset];
-        std::uint8_t status, lives;
-        Packing::unpack44(packed, status, lives);
+    if (header.mask & SnapshotCodec::kFieldStatus) {
+        std::uint8_t status = 0;
+        std::uint8_t lives  = 0;
+        Packing::unpack44(fields.status, status, lives);
         e.statusEffects = status;
         e.lives         = static_cast<std::int8_t>(lives);
-        offset += 1;
-    }
-    if (hasBit(mask, 7)) {
-        if (!ensureAvailable(offset, 4, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.orientation = readFloat(data, offset);
     }
-    if (hasBit(mask, 8)) {
-        if (!ensureAvailable(offset, 1, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.dead = data[offset] != 0;
-        offset += 1;
-    }
-    if (hasBit(mask, 10)) {
-        if (!ensureAvailable(offset, 4, PacketHeader::kSize + header.payloadSize))
-            return std::nullopt;
-        e.score = readI32(data, offset);
+    if (header.mask & SnapshotCodec::kFieldScore) {
+        e.score = fields.score;
     }
     return e;
 }
@@ -187,6 +187,7 @@ showLobbyMenuAndGetGameEndpoint(Window& window, const IpEndpoint& lobbyEndpoint,
             g_isRoomHost          = false;
             g_joinAsSpectator     = result.spectator;
             g_expectedPlayerCount = result.expectedPlayerCount;
+            g_joinRoomId          = result.roomId;
             std::vector<PlayerInfo> emptyPlayers;
             if (authenticatedConnection) {
                 emptyPlayers = authenticatedConnection->getLastPlayerList();
@@ -221,6 +222,7 @@ showLobbyMenuAndGetGameEndpoint(Window& window, const IpEndpoint& lobbyEndpoint,
         g_isRoomHost          = result.isHost;
         g_joinAsSpectator     = result.spectator;
         g_expectedPlayerCount = result.expectedPlayerCount;
+        g_joinRoomId          = result.roomId;
 
         std::vector<PlayerInfo> players;
         if (authenticatedConnection) {
@@ -10,10 +10,11 @@ bool setupNetwork(NetPipelines& net, InputBuffer& inputBuffer, const IpEndpoint&
         return false;
 
     auto socketPtr = net.socket;
-    bool spectator = g_joinAsSpectator;
-    welcomeThread  = std::thread([serverEp, &handshakeDone, socketPtr, spectator, userId] {
+    bool spectator       = g_joinAsSpectator;
+    std::uint32_t roomId = g_joinRoomId;
+    welcomeThread        = std::thread([serverEp, &handshakeDone, socketPtr, spectator, userId, roomId] {
         if (socketPtr)
-            sendWelcomeLoop(serverEp, handshakeDone, *socketPtr, spectator, userId);
+            sendWelcomeLoop(serverEp, handshakeDone, *socketPtr, spectator, userId, roomId);
     });
     return true;
 }
@@ -33,22 +33,22 @@
 #include <iostream>
 #include <unordered_set>
 
-ReplicationSystem::ReplicationSystem(ThreadSafeQueue<SnapshotParseResult>& snapshots,
-                                     ThreadSafeQueue<EntitySpawnPacket>& spawns,
-                                     ThreadSafeQueue<EntityDestroyedPacket>& destroys, const EntityTypeRegistry& types)
+ReplicationSystem::ReplicationSystem(SpscQueue<SnapshotParseResult>& snapshots,
+                                     SpscQueue<EntitySpawnPacket>& spawns,
+                                     SpscQueue<EntityDestroyedPacket>& destroys, const EntityTypeRegistry& types)
     : snapshots_(&snapshots), spawnQueue_(&spawns), destroyQueue_(&destroys), types_(&types)
 {}
 
 namespace
 {
-    ThreadSafeQueue<EntitySpawnPacket>& dummySpawnQueue()
+    SpscQueue<EntitySpawnPacket>& dummySpawnQueue()
     {
-        static ThreadSafeQueue<EntitySpawnPacket> q;
+        static SpscQueue<EntitySpawnPacket> q;
         return q;
     }
-    ThreadSafeQueue<EntityDestroyedPacket>& dummyDestroyQueue()
+    SpscQueue<EntityDestroyedPacket>& dummyDestroyQueue()
     {
-        static ThreadSafeQueue<EntityDestroyedPacket> q;
+        static SpscQueue<EntityDestroyedPacket> q;
         return q;
     }
 
@@ -66,7 +66,7 @@ namespace
     }
 } // namespace
 
-ReplicationSystem::ReplicationSystem(ThreadSafeQueue<SnapshotParseResult>& snapshots, const EntityTypeRegistry& types)
+ReplicationSystem::ReplicationSystem(SpscQueue<SnapshotParseResult>& snapshots, const EntityTypeRegistry& types)
     : snapshots_(&snapshots), spawnQueue_(&dummySpawnQueue()), destroyQueue_(&dummyDestroyQueue()), types_(&types)
 {}
 
@@ -97,8 +97,9 @@ void ReplicationSystem::update(Registry& registry, float deltaTime)
     }
     explosionCooldown_ = std::max(0.0F, explosionCooldown_ - deltaTime);
 
-    EntitySpawnPacket spawnPkt;
-    while (spawnQueue_->tryPop(spawnPkt)) {
+    spawnBatch_.clear();
+    spawnQueue_->drainInto(spawnBatch_);
+    for (const auto& spawnPkt : spawnBatch_) {
         if (!types_->has(spawnPkt.entityType)) {
             Logger::instance().warn("[Replication] Unknown type in spawn: " + std::to_string(spawnPkt.entityType));
             continue;
@@ -208,8 +209,9 @@ void ReplicationSystem::update(Registry& registry, float deltaTime)
         }
     }
 
-    EntityDestroyedPacket destroyPkt;
-    while (destroyQueue_->tryPop(destroyPkt)) {
+    destroyBatch_.clear();
+    destroyQueue_->drainInto(destroyBatch_);
+    for (const auto& destroyPkt : destroyBatch_) {
         auto it = remoteToLocal_.find(destroyPkt.entityId);
         if (it != remoteToLocal_.end()) {
             if (registry.isAlive(it->second)) {
@@ -224,8 +226,9 @@ void ReplicationSystem::update(Registry& registry, float deltaTime)
         }
     }
 
-    SnapshotParseResult snapshot;
-    while (snapshots_->tryPop(snapshot)) {
+    snapshotBatch_.clear();
+    snapshots_->drainInto(snapshotBatch_);
+    for (auto& snapshot : snapshotBatch_) {
         auto now = std::chrono::steady_clock::now();
 
         if (stats == nullptr) {
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+import argparse
+import json
+import sys
+
+UNIT_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    with open(path, encoding="utf-8") as handle:
+        data = json.load(handle)
+
+    samples = {}
+    medians = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        name  = entry.get("run_name", entry["name"])
+        value = entry[metric] * UNIT_NS[entry.get("time_unit", "ns")]
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[name] = value
+        else:
+            samples.setdefault(name, []).append(value)
+
+    results = {name: sorted(values)[len(values) // 2] for name, values in samples.items()}
+    results.update(medians)
+    return results
+
+
+def format_ns(value):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= scale:
+            return f"{value / scale:.2f} {unit}"
+    return f"{value:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two rtype_benchmarks JSON runs and flag regressions.")
+    parser.add_argument("baseline", help="JSON output of the reference run")
+    parser.add_argument("contender", help="JSON output of the run to check")
+    parser.add_argument("--threshold", type=float, default=10.0, help="slowdown in percent that counts as a regression")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"), default="cpu_time")
+    args = parser.parse_args()
+
+    baseline  = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    names       = list(baseline) + [name for name in contender if name not in baseline]
+    regressions = []
+    width       = max((len(name) for name in names), default=9)
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'contender':>12} {'change':>9}")
+    for name in names:
+        if name not in contender:
+            print(f"{name:<{width}} {format_ns(baseline[name]):>12} {'missing':>12}")
+            continue
+        if name not in baseline:
+            print(f"{name:<{width}} {'new':>12} {format_ns(contender[name]):>12}")
+            continue
+        change = (contender[name] - baseline[name]) / baseline[name] * 100.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improved"
+        times = f"{format_ns(baseline[name]):>12} {format_ns(contender[name]):>12}"
+        print(f"{name:<{width}} {times} {change:>+8.1f}%{marker}")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) slower than the {args.threshold:.0f}% threshold ({args.metric})")
+        return 1
+    print(f"\nno regression above {args.threshold:.0f}% ({args.metric})")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
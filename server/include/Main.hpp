@@ -1,3 +1,5 @@
 #pragma once
 
-void run_server();
+#include "game/GamePortMode.hpp"
+
+void run_server(GamePortMode gamePortMode = GamePortMode::PerRoom);
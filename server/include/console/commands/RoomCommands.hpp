@@ -19,4 +19,6 @@ class RoomCommands
     static void handleKill(ServerConsole* console, GameInstanceManager* instanceManager, LobbyManager* lobbyManager,
                            const std::string& idArg);
     static void handleKickPlayer(ServerConsole* console, GameInstanceManager* instanceManager, const std::string& args);
+    static void handleProfile(ServerConsole* console, GameInstanceManager* instanceManager, const std::string& args);
+    static void handleTrace(ServerConsole* console, GameInstanceManager* instanceManager, const std::string& args);
 };
@@ -4,6 +4,7 @@
 #include "core/Session.hpp"
 #include "ecs/Registry.hpp"
 #include "game/GameLoopThread.hpp"
+#include "game/RoomScheduler.hpp"
 #include "levels/IntroCinematic.hpp"
 #include "levels/LevelData.hpp"
 #include "levels/LevelDirector.hpp"
@@ -14,6 +15,8 @@
 #include "network/NetworkBridge.hpp"
 #include "network/Packets.hpp"
 #include "network/SendThread.hpp"
+#include "network/SharedGamePort.hpp"
+#include "profiling/TickProfiler.hpp"
 #include "replication/ReplicationManager.hpp"
 #include "rollback/DesyncDetector.hpp"
 #include "rollback/RollbackManager.hpp"
@@ -28,6 +31,7 @@
 #include "systems/MonsterMovementSystem.hpp"
 #include "systems/MovementSystem.hpp"
 #include "systems/PlayerBoundsSystem.hpp"
+#include "systems/PlayerIndex.hpp"
 #include "systems/PlayerInputSystem.hpp"
 #include "systems/ScoreSystem.hpp"
 #include "systems/ShieldSystem.hpp"
@@ -55,7 +59,11 @@ using GameEndCallback =
 class GameInstance
 {
   public:
-    GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag);
+    GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag,
+                 SharedGamePort* sharedPort = nullptr, RoomScheduler* scheduler = nullptr);
+    GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag, StorageMode storageMode,
+                 SharedGamePort* sharedPort = nullptr, RoomScheduler* scheduler = nullptr);
+    ~GameInstance();
     void setRoomConfig(const RoomConfig& config);
     bool start();
     void run();
@@ -93,14 +101,21 @@ class GameInstance
         return gameStarted_;
     }
     bool isEmpty() const;
+    TickProfiler& getProfiler()
+    {
+        return profiler_;
+    }
 
     void handleInput(const ReceivedInput& input);
     void handleControlEvent(const ControlEvent& ctrl);
     void handleTimeout(const ClientTimeoutEvent& timeout);
 
   private:
-    static constexpr double kTickRate                 = 60.0;
-    static constexpr std::uint32_t kFullStateInterval = 60;
+    friend class GameInstanceTestAccess;
+
+    static constexpr double kTickRate                  = 60.0;
+    static constexpr std::uint32_t kFullStateInterval  = 1800;
+    static constexpr std::uint32_t kCompactionInterval = 600;
 
     void handleControl();
     void handleControlMessage(const ControlEvent& ctrl);
@@ -153,10 +168,13 @@ class GameInstance
 
     std::uint32_t roomId_;
     std::uint16_t port_;
+    SharedGamePort* sharedPort_ = nullptr;
+    RoomScheduler* scheduler_   = nullptr;
     GameWorld world_;
     Registry& registry_;
     RoomConfig roomConfig_{RoomConfig::preset(RoomDifficulty::Hell)};
     std::map<std::uint32_t, EntityId> playerEntities_;
+    PlayerIndex playerIndex_;
     std::vector<IpEndpoint> clients_;
     std::unordered_map<std::string, ClientSession> sessions_;
     EventBus eventBus_;
@@ -180,8 +198,8 @@ class GameInstance
     AllySystem allySys_;
     ShieldSystem shieldSys_;
     IntroCinematic introCinematic_;
-    ThreadSafeQueue<ReceivedInput> inputQueue_;
-    ThreadSafeQueue<ControlEvent> controlQueue_;
+    MpscQueue<ReceivedInput> inputQueue_;
+    MpscQueue<ControlEvent> controlQueue_;
     ThreadSafeQueue<ClientTimeoutEvent> timeoutQueue_;
     InputReceiveThread receiveThread_;
     SendThread sendThread_;
@@ -198,8 +216,11 @@ class GameInstance
     std::atomic<bool>* running_{nullptr};
     NetworkBridge networkBridge_;
     ReplicationManager replicationManager_;
+    RelevancyContext relevancy_;
+    CaptureFrame frame_;
     RollbackManager rollbackManager_;
     DesyncDetector desyncDetector_;
+    TickProfiler profiler_;
 
     void captureStateSnapshot();
     void handleDesync(const DesyncInfo& desyncInfo);
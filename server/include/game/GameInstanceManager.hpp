@@ -1,6 +1,8 @@
 #pragma once
 
 #include "game/GameInstance.hpp"
+#include "game/GamePortMode.hpp"
+#include "game/RoomScheduler.hpp"
 #include "lobby/RoomConfig.hpp"
 
 #include <atomic>
@@ -13,7 +15,8 @@
 class GameInstanceManager
 {
   public:
-    GameInstanceManager(std::uint16_t basePort, std::uint32_t maxInstances, std::atomic<bool>& runningFlag);
+    GameInstanceManager(std::uint16_t basePort, std::uint32_t maxInstances, std::atomic<bool>& runningFlag,
+                        GamePortMode portMode = GamePortMode::PerRoom, std::size_t tickWorkers = 0);
 
     std::optional<std::uint32_t> createInstance(const RoomConfig& config = RoomConfig::preset(RoomDifficulty::Hell));
 
@@ -30,6 +33,16 @@ class GameInstanceManager
         return maxInstances_;
     }
 
+    GamePortMode getPortMode() const
+    {
+        return portMode_;
+    }
+
+    std::optional<RoomTickMetrics> getTickMetrics(std::uint32_t roomId) const
+    {
+        return scheduler_.metrics(roomId);
+    }
+
     std::vector<std::uint32_t> getAllRoomIds() const;
 
     void cleanupEmptyInstances();
@@ -50,6 +63,9 @@ class GameInstanceManager
     std::uint32_t maxInstances_;
     std::uint32_t nextRoomId_{1};
     std::atomic<bool>* running_{nullptr};
+    GamePortMode portMode_;
+    std::unique_ptr<SharedGamePort> sharedPort_;
+    RoomScheduler scheduler_;
     mutable std::mutex instancesMutex_;
     std::map<std::uint32_t, std::unique_ptr<GameInstance>> instances_;
     GameEndCallback gameEndCallback_;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "concurrency/ThreadSafeQueue.hpp"
+#include "concurrency/MpscQueue.hpp"
 #include "network/InputReceiveThread.hpp"
 
 #include <atomic>
@@ -15,7 +15,7 @@ class GameLoopThread
     using TickInputs   = std::vector<ReceivedInput>;
     using TickCallback = std::function<void(const TickInputs&)>;
 
-    GameLoopThread(ThreadSafeQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz = 60.0);
+    GameLoopThread(MpscQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz = 60.0);
     ~GameLoopThread();
 
     bool start();
@@ -25,7 +25,7 @@ class GameLoopThread
   private:
     void run();
 
-    ThreadSafeQueue<ReceivedInput>& inputs_;
+    MpscQueue<ReceivedInput>& inputs_;
     TickCallback tick_;
     std::chrono::duration<double> period_;
     std::atomic<bool> running_{false};
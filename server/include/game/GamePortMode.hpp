@@ -0,0 +1,7 @@
+#pragma once
+
+enum class GamePortMode
+{
+    PerRoom,
+    Shared
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "concurrency/MpscQueue.hpp"
+#include "network/InputReceiveThread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct RoomTickMetrics
+{
+    std::uint64_t ticks       = 0;
+    std::uint64_t lateTicks   = 0;
+    std::uint64_t overruns    = 0;
+    std::uint64_t stolenTicks = 0;
+    std::chrono::microseconds lastLateness{0};
+    std::chrono::microseconds maxLateness{0};
+    std::chrono::microseconds totalLateness{0};
+    std::chrono::microseconds lastTickDuration{0};
+    std::chrono::microseconds maxTickDuration{0};
+
+    std::chrono::microseconds meanLateness() const
+    {
+        return ticks == 0 ? std::chrono::microseconds(0) : totalLateness / static_cast<std::int64_t>(ticks);
+    }
+};
+
+class RoomScheduler
+{
+  public:
+    using TickInputs   = std::vector<ReceivedInput>;
+    using TickCallback = std::function<void(const TickInputs&)>;
+
+    static constexpr std::chrono::microseconds kDefaultLateThreshold{1000};
+    static constexpr std::chrono::milliseconds kIdleWait{10};
+
+    explicit RoomScheduler(std::size_t workers                   = 0,
+                           std::chrono::microseconds lateThreshold = kDefaultLateThreshold);
+    ~RoomScheduler();
+
+    RoomScheduler(const RoomScheduler&)            = delete;
+    RoomScheduler& operator=(const RoomScheduler&) = delete;
+
+    bool start();
+    void stop();
+    bool isRunning() const;
+    std::size_t workerCount() const;
+
+    bool add(std::uint32_t roomId, MpscQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz = 60.0);
+    bool remove(std::uint32_t roomId);
+    bool contains(std::uint32_t roomId) const;
+    std::size_t roomCount() const;
+    std::optional<RoomTickMetrics> metrics(std::uint32_t roomId) const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Room
+    {
+        std::uint32_t id                 = 0;
+        MpscQueue<ReceivedInput>* inputs = nullptr;
+        TickCallback tick;
+        Clock::duration period{};
+        std::atomic<bool> active{true};
+        std::mutex runMutex;
+        TickInputs batch;
+        mutable std::mutex metricsMutex;
+        RoomTickMetrics metrics;
+    };
+
+    struct Entry
+    {
+        Clock::time_point deadline;
+        std::shared_ptr<Room> room;
+
+        bool operator>(const Entry& other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
+
+    struct Worker
+    {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::vector<Entry> heap;
+        std::thread thread;
+    };
+
+    void run(std::size_t index);
+    std::optional<Entry> popDue(Worker& worker, Clock::time_point now, bool& backlog);
+    std::optional<Entry> steal(std::size_t thief, Clock::time_point now);
+    void push(std::size_t index, Entry entry);
+    void execute(std::size_t index, Entry entry, bool stolen);
+
+    std::chrono::microseconds lateThreshold_;
+    std::atomic<bool> running_{false};
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<std::size_t> nextWorker_{0};
+    mutable std::mutex roomsMutex_;
+    std::unordered_map<std::uint32_t, std::shared_ptr<Room>> rooms_;
+};
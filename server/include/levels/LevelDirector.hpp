@@ -27,9 +27,9 @@ class LevelDirector
 
     std::vector<DispatchedEvent> consumeEvents();
 
-    void registerSpawn(const std::string& spawnId, EntityId entityId);
+    void registerSpawn(const std::string& spawnId, Entity entity);
     void unregisterSpawn(const std::string& spawnId);
-    void registerBoss(const std::string& bossId, EntityId entityId);
+    void registerBoss(const std::string& bossId, Entity entity);
     void unregisterBoss(const std::string& bossId);
     void registerPlayerInput(EntityId playerId, std::uint16_t flags);
 
@@ -40,6 +40,9 @@ class LevelDirector
     bool finished() const;
     bool isSafeZoneActive() const;
     const std::optional<CameraBounds>& playerBounds() const;
+    const std::optional<CameraBounds>& cameraBounds() const;
+    std::vector<Entity> activeBosses() const;
+    void activeBosses(std::vector<Entity>& out) const;
 
   private:
     struct EventRuntime
@@ -53,7 +56,7 @@ class LevelDirector
 
     struct BossRuntime
     {
-        EntityId entityId        = 0;
+        Entity entity;
         bool registered          = false;
         bool dead                = false;
         bool onDeathFired        = false;
@@ -98,12 +101,13 @@ class LevelDirector
     float segmentDistance_    = 0.0F;
     ScrollSettings activeScroll_;
     std::optional<CameraBounds> activePlayerBounds_;
+    std::optional<CameraBounds> activeCameraBounds_;
     std::vector<EventRuntime> segmentEvents_;
     std::vector<DispatchedEvent> firedEvents_;
 
     struct SpawnGroup
     {
-        std::unordered_set<EntityId> entities;
+        std::vector<Entity> entities;
         bool spawned = false;
     };
 
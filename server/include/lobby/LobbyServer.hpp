@@ -12,6 +12,7 @@
 #include "network/ChatPacket.hpp"
 #include "network/PacketHeader.hpp"
 #include "network/ServerBroadcastPacket.hpp"
+#include "network/UdpReactor.hpp"
 #include "network/UdpSocket.hpp"
 
 #include <atomic>
@@ -27,7 +28,7 @@ class LobbyServer
 {
   public:
     LobbyServer(std::uint16_t lobbyPort, std::uint16_t gameBasePort, std::uint32_t maxInstances,
-                std::atomic<bool>& runningFlag);
+                std::atomic<bool>& runningFlag, GamePortMode gamePortMode = GamePortMode::PerRoom);
     ~LobbyServer();
 
     bool start();
@@ -84,6 +85,7 @@ class LobbyServer
     std::atomic<bool>* running_{nullptr};
 
     UdpSocket lobbySocket_;
+    UdpReactor lobbyReactor_;
     std::atomic<bool> receiveRunning_{false};
     std::thread receiveWorker_;
     std::thread cleanupWorker_;
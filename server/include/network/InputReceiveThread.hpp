@@ -1,9 +1,11 @@
 #pragma once
 
+#include "concurrency/MpscQueue.hpp"
 #include "concurrency/ThreadSafeQueue.hpp"
 #include "events/ClientTimeoutEvent.hpp"
 #include "network/InputParser.hpp"
 #include "network/PacketHeader.hpp"
+#include "network/UdpReactor.hpp"
 #include "network/UdpSocket.hpp"
 
 #include <array>
@@ -35,23 +37,28 @@ struct ControlEvent
     std::vector<std::uint8_t> data{};
 };
 
+class SharedGamePort;
+
 class InputReceiveThread
 {
   public:
-    InputReceiveThread(const IpEndpoint& bindTo, ThreadSafeQueue<ReceivedInput>& outQueue,
-                       ThreadSafeQueue<ControlEvent>& controlQueue,
+    InputReceiveThread(const IpEndpoint& bindTo, MpscQueue<ReceivedInput>& outQueue,
+                       MpscQueue<ControlEvent>& controlQueue,
                        ThreadSafeQueue<ClientTimeoutEvent>* timeoutQueue = nullptr,
                        std::chrono::milliseconds timeout                 = std::chrono::seconds(5));
-    InputReceiveThread(const IpEndpoint& bindTo, ThreadSafeQueue<ReceivedInput>& outQueue,
+    InputReceiveThread(const IpEndpoint& bindTo, MpscQueue<ReceivedInput>& outQueue,
                        ThreadSafeQueue<ClientTimeoutEvent>* timeoutQueue = nullptr,
                        std::chrono::milliseconds timeout                 = std::chrono::seconds(5));
     ~InputReceiveThread();
 
     bool start();
+    bool start(SharedGamePort& port, std::uint32_t roomId);
     void stop();
     bool isRunning() const;
     IpEndpoint endpoint() const;
     std::optional<ClientState> clientState(const IpEndpoint& ep) const;
+    void deliver(const std::uint8_t* data, std::size_t size, const IpEndpoint& src);
+    std::chrono::milliseconds pollTimeouts(std::chrono::steady_clock::time_point now);
 
   private:
     void run();
@@ -78,14 +85,17 @@ class InputReceiveThread
     };
 
     IpEndpoint bind_;
-    std::unique_ptr<ThreadSafeQueue<ControlEvent>> ownedControlQueue_;
-    ThreadSafeQueue<ReceivedInput>& queue_;
-    ThreadSafeQueue<ControlEvent>& controlQueue_;
+    std::unique_ptr<MpscQueue<ControlEvent>> ownedControlQueue_;
+    MpscQueue<ReceivedInput>& queue_;
+    MpscQueue<ControlEvent>& controlQueue_;
     ThreadSafeQueue<ClientTimeoutEvent>* timeoutQueue_;
     std::chrono::milliseconds timeout_;
     std::atomic<bool> running_{false};
     std::thread worker_;
     UdpSocket socket_;
+    UdpReactor reactor_;
+    SharedGamePort* shared_     = nullptr;
+    std::uint32_t sharedRoomId_ = 0;
     mutable std::mutex sessionMutex_;
     std::unordered_map<EndpointKey, ClientState, EndpointKeyHash> sessions_;
     std::optional<EndpointKey> lastAccepted_;
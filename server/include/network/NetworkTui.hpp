@@ -1,7 +1,10 @@
 #pragma once
 
+#include "profiling/TickProfiler.hpp"
+
 #include <chrono>
 #include <deque>
+#include <functional>
 #include <string>
 #ifndef _WIN32
 #include <termios.h>
@@ -28,6 +31,14 @@ class NetworkTui
     {
         _clientCount = count;
     }
+    void setTickProfile(std::vector<ZoneStats> zones)
+    {
+        _zones = std::move(zones);
+    }
+    void setTraceHandler(std::function<std::string()> handler)
+    {
+        _traceHandler = std::move(handler);
+    }
     void addLog(const std::string& log);
     void addAdminLog(const std::string& msg);
     void render();
@@ -47,6 +58,8 @@ class NetworkTui
     std::deque<float> _bandwidthHistory;
     std::deque<std::string> _logs;
     std::deque<std::string> _adminLogs;
+    std::vector<ZoneStats> _zones;
+    std::function<std::string()> _traceHandler;
     std::chrono::steady_clock::time_point _lastUpdate;
     std::chrono::steady_clock::time_point _startTime;
 
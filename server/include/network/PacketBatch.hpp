@@ -0,0 +1,31 @@
+#pragma once
+
+#include "network/UdpSocket.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class PacketBatch
+{
+  public:
+    struct Entry
+    {
+        std::size_t offset;
+        std::size_t size;
+        IpEndpoint dst;
+    };
+
+    void append(std::span<const std::uint8_t> payload, const IpEndpoint& dst);
+    void appendAll(const PacketBatch& other);
+    void clear();
+    bool empty() const;
+    std::size_t size() const;
+    std::size_t send(UdpSocket& socket, int roomId);
+
+  private:
+    std::vector<std::uint8_t> bytes_;
+    std::vector<Entry> entries_;
+    std::vector<UdpDatagram> datagrams_;
+};
@@ -7,19 +7,14 @@
 #include "replication/EntityStateCache.hpp"
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
-struct SnapshotChunkBlock
-{
-    std::vector<std::uint8_t> data;
-};
-
-struct SnapshotChunkPacket
-{
-    std::vector<std::uint8_t> data;
-    std::uint16_t entityCount = 0;
-};
+class ClientBaseline;
+struct CaptureFrame;
+struct ReplicatedEntity;
+struct SnapshotBuffers;
 
 struct LevelArchetype
 {
@@ -61,6 +56,12 @@ std::vector<std::vector<std::uint8_t>> buildSmartDeltaSnapshot(Registry& registr
                                                                EntityStateCache& cache, bool forceFullState,
                                                                std::size_t maxSinglePacketSize = 1400,
                                                                std::size_t maxChunkSize        = 1000);
+ReplicatedEntity replicatedEntity(const CaptureFrame& frame, std::size_t index);
+std::span<std::vector<std::uint8_t>> buildBaselineDeltaSnapshot(const std::vector<ReplicatedEntity>& entities,
+                                                                 uint32_t tick, ClientBaseline& baseline,
+                                                                 bool forceFullState, std::size_t byteBudget,
+                                                                 SnapshotBuffers& buffers,
+                                                                 std::size_t* deferred = nullptr);
 
 std::vector<std::uint8_t> buildPong(const PacketHeader& req);
 std::vector<std::uint8_t> buildServerHello(std::uint16_t sequence);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "network/NetworkConstants.hpp"
+#include "network/PacketHeader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class SendBufferRing
+{
+  public:
+    static constexpr std::size_t kDefaultSlots = 32;
+    static constexpr std::size_t kBufferCapacity =
+        PacketHeader::kSize + Network::kMaxSafePacketPayload + PacketHeader::kCrcSize;
+
+    explicit SendBufferRing(std::size_t slots = kDefaultSlots);
+
+    void begin();
+    std::vector<std::uint8_t>& acquire();
+    std::span<std::vector<std::uint8_t>> batch();
+    std::size_t slots() const;
+
+  private:
+    std::vector<std::vector<std::uint8_t>> buffers_;
+    std::size_t first_ = 0;
+    std::size_t end_   = 0;
+};
@@ -3,14 +3,19 @@
 #include "network/DeltaStatePacket.hpp"
 #include "network/EntityDestroyedPacket.hpp"
 #include "network/EntitySpawnPacket.hpp"
+#include "network/PacketBatch.hpp"
 #include "network/PlayerDisconnectedPacket.hpp"
 #include "network/UdpSocket.hpp"
 
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <vector>
 
+class SharedGamePort;
+
 class SendThread
 {
   public:
@@ -18,12 +23,14 @@ class SendThread
     ~SendThread();
 
     bool start();
+    bool start(SharedGamePort& port);
     void stop();
     bool isRunning() const;
     void setClients(const std::vector<IpEndpoint>& clients);
     void publish(const DeltaStatePacket& packet);
     void publish(const std::vector<std::uint8_t>& payload);
-    void sendTo(const std::vector<std::uint8_t>& payload, const IpEndpoint& dst);
+    void sendTo(std::span<const std::uint8_t> payload, const IpEndpoint& dst);
+    void flush();
     void broadcast(const PlayerDisconnectedPacket& packet);
     void broadcast(const EntitySpawnPacket& packet);
     void broadcast(const EntityDestroyedPacket& packet);
@@ -32,6 +39,8 @@ class SendThread
 
   private:
     void run();
+    void broadcastPayload(std::span<const std::uint8_t> payload);
+    void sendLatest();
 
     IpEndpoint bind_;
     std::mutex clientsMutex_;
@@ -42,5 +51,11 @@ class SendThread
     double hz_;
     std::mutex payloadMutex_;
     std::vector<std::uint8_t> latest_;
+    std::mutex queueMutex_;
+    std::condition_variable wake_;
+    bool flushRequested_ = false;
+    PacketBatch pending_;
+    PacketBatch outgoing_;
+    SharedGamePort* shared_ = nullptr;
     int roomId_;
 };
@@ -14,6 +14,7 @@
 #include "network/NetworkTui.hpp"
 #include "network/Packets.hpp"
 #include "network/SendThread.hpp"
+#include "profiling/TickProfiler.hpp"
 #include "replication/ReplicationManager.hpp"
 #include "simulation/GameWorld.hpp"
 #include "simulation/PlayerCommand.hpp"
@@ -25,6 +26,7 @@
 #include "systems/MonsterMovementSystem.hpp"
 #include "systems/MovementSystem.hpp"
 #include "systems/PlayerBoundsSystem.hpp"
+#include "systems/PlayerIndex.hpp"
 #include "systems/PlayerInputSystem.hpp"
 #include "systems/ScoreSystem.hpp"
 #include "systems/WalkerShotSystem.hpp"
@@ -48,7 +50,7 @@ class ServerApp
 
   private:
     static constexpr double kTickRate                 = 60.0;
-    static constexpr std::uint32_t kFullStateInterval = 60;
+    static constexpr std::uint32_t kFullStateInterval = 1800;
 
     void handleControl();
     void handleControlMessage(const ControlEvent& ctrl);
@@ -92,6 +94,7 @@ class ServerApp
     GameWorld world_;
     Registry& registry_;
     std::map<std::uint32_t, EntityId> playerEntities_;
+    PlayerIndex playerIndex_;
     std::vector<IpEndpoint> clients_;
     std::unordered_map<std::string, ClientSession> sessions_;
     EventBus eventBus_;
@@ -111,8 +114,8 @@ class ServerApp
     BoundarySystem boundarySys_;
     PlayerBoundsSystem playerBoundsSys_;
     IntroCinematic introCinematic_;
-    ThreadSafeQueue<ReceivedInput> inputQueue_;
-    ThreadSafeQueue<ControlEvent> controlQueue_;
+    MpscQueue<ReceivedInput> inputQueue_;
+    MpscQueue<ControlEvent> controlQueue_;
     ThreadSafeQueue<ClientTimeoutEvent> timeoutQueue_;
     InputReceiveThread receiveThread_;
     SendThread sendThread_;
@@ -131,4 +134,6 @@ class ServerApp
     std::unique_ptr<NetworkTui> tui_;
     NetworkBridge networkBridge_;
     ReplicationManager replicationManager_;
+    RelevancyContext relevancy_;
+    TickProfiler profiler_;
 };
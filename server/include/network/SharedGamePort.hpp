@@ -0,0 +1,69 @@
+#pragma once
+
+#include "network/PacketBatch.hpp"
+#include "network/UdpReactor.hpp"
+#include "network/UdpSocket.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+class InputReceiveThread;
+
+class SharedGamePort
+{
+  public:
+    explicit SharedGamePort(const IpEndpoint& bindTo,
+                            std::chrono::milliseconds bindingTimeout = std::chrono::seconds(30));
+    ~SharedGamePort();
+
+    SharedGamePort(const SharedGamePort&)            = delete;
+    SharedGamePort& operator=(const SharedGamePort&) = delete;
+
+    bool start();
+    void stop();
+    bool isRunning() const;
+    IpEndpoint endpoint() const;
+
+    void attach(std::uint32_t roomId, InputReceiveThread& receiver);
+    void detach(std::uint32_t roomId);
+    void submit(PacketBatch& batch);
+    std::optional<std::uint32_t> roomOf(const IpEndpoint& endpoint) const;
+    std::size_t roomCount() const;
+
+  private:
+    struct Binding
+    {
+        std::uint32_t roomId;
+        std::chrono::steady_clock::time_point lastSeen;
+    };
+
+    static constexpr std::chrono::milliseconds kSweepInterval{250};
+
+    static std::uint64_t keyOf(const IpEndpoint& endpoint);
+    void receiveLoop();
+    void sendLoop();
+    void route(const std::uint8_t* data, std::size_t size, const IpEndpoint& src);
+    void sweep(std::chrono::steady_clock::time_point now);
+
+    IpEndpoint bind_;
+    std::chrono::milliseconds bindingTimeout_;
+    UdpSocket socket_;
+    UdpReactor reactor_;
+    std::atomic<bool> running_{false};
+    std::thread receiver_;
+    std::thread sender_;
+    mutable std::mutex routesMutex_;
+    std::unordered_map<std::uint32_t, InputReceiveThread*> rooms_;
+    std::unordered_map<std::uint64_t, Binding> bindings_;
+    std::mutex sendMutex_;
+    std::condition_variable sendWake_;
+    PacketBatch pending_;
+    PacketBatch outgoing_;
+};
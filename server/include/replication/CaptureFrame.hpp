@@ -0,0 +1,25 @@
+#pragma once
+
+#include "ecs/Registry.hpp"
+#include "replication/EntityStateCache.hpp"
+#include "replication/Relevancy.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct CaptureFrame
+{
+    std::uint64_t tick = 0;
+    std::vector<EntityId> ids;
+    std::vector<std::uint32_t> generations;
+    std::vector<std::uint16_t> fields;
+    std::vector<ReplicationPriority> priorities;
+    std::vector<CachedEntityState> states;
+
+    std::size_t size() const;
+    std::ptrdiff_t indexOf(EntityId id) const;
+    void clear();
+};
+
+void captureFrame(const Registry& registry, std::uint64_t tick, CaptureFrame& frame);
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "ecs/Registry.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "replication/Relevancy.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+struct ReplicatedEntity
+{
+    EntityId id                  = 0;
+    std::uint32_t generation     = 0;
+    std::uint16_t fields         = 0;
+    ReplicationPriority priority = ReplicationPriority::Other;
+    SnapshotCodec::EntityFields state{};
+};
+
+struct SentEntityState
+{
+    EntityId id              = 0;
+    std::uint32_t generation = 0;
+    std::uint16_t mask       = 0;
+    bool delta               = false;
+    SnapshotCodec::EntityFields state{};
+};
+
+class ClientBaseline
+{
+  public:
+    static constexpr std::size_t kMaxPendingFrames = 64;
+
+    bool acknowledged() const;
+    std::uint32_t ackedTick() const;
+    std::optional<std::uint32_t> baselineTick() const;
+    std::size_t pendingFrames() const;
+
+    const SnapshotCodec::EntityFields* find(EntityId id, std::uint32_t generation) const;
+    std::uint16_t pendingMask(EntityId id) const;
+    EntityId rotation(ReplicationPriority priority) const;
+    void setRotation(ReplicationPriority priority, EntityId next);
+
+    void record(std::uint32_t tick, bool againstBaseline, const std::vector<SentEntityState>& entities);
+    bool acknowledge(std::uint32_t tick);
+    void retain(const CaptureFrame& frame);
+    void reset();
+
+  private:
+    struct BaselineEntry
+    {
+        bool present             = false;
+        std::uint32_t generation = 0;
+        SnapshotCodec::EntityFields state{};
+    };
+
+    using BaselineMap = std::vector<BaselineEntry>;
+
+    struct Frame
+    {
+        std::uint32_t tick = 0;
+        std::shared_ptr<const BaselineMap> base;
+        std::vector<SentEntityState> entities;
+    };
+
+    std::shared_ptr<BaselineMap> acquireMap();
+    Frame& frame(std::size_t index);
+    void dropFrames(std::size_t count);
+    void rebuildPending();
+    static void mergeMask(std::vector<std::uint16_t>& masks, EntityId id, std::uint16_t mask);
+
+    bool acknowledged_       = false;
+    std::uint32_t ackedTick_ = 0;
+    std::shared_ptr<const BaselineMap> baseline_;
+    std::vector<std::shared_ptr<BaselineMap>> maps_;
+    std::vector<std::uint16_t> carried_;
+    std::vector<std::uint16_t> pending_;
+    std::array<Frame, kMaxPendingFrames> frames_{};
+    std::size_t firstFrame_ = 0;
+    std::size_t frameCount_ = 0;
+    std::array<EntityId, kReplicationPriorityCount> rotation_{};
+};
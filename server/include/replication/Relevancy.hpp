@@ -0,0 +1,36 @@
+#pragma once
+
+#include "components/TransformComponent.hpp"
+#include "ecs/Registry.hpp"
+#include "levels/LevelData.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class ReplicationPriority : std::uint8_t
+{
+    Player     = 0,
+    Boss       = 1,
+    Enemy      = 2,
+    Projectile = 3,
+    Other      = 4
+};
+
+constexpr std::size_t kReplicationPriorityCount = 5;
+
+struct RelevancyContext
+{
+    static constexpr float kDefaultMargin        = 256.0F;
+    static constexpr CameraBounds kDefaultCamera = {0.0F, 1280.0F, 0.0F, 720.0F};
+
+    CameraBounds camera = kDefaultCamera;
+    float margin = kDefaultMargin;
+    std::vector<Entity> bosses;
+};
+
+ReplicationPriority tagPriority(const Registry& registry, EntityId id);
+ReplicationPriority replicationPriority(Entity entity, ReplicationPriority tagged, const RelevancyContext& context);
+ReplicationPriority replicationPriority(const Registry& registry, EntityId id, const RelevancyContext& context);
+bool isRelevant(float x, float y, ReplicationPriority priority, const RelevancyContext& context);
+bool isRelevant(const TransformComponent& transform, ReplicationPriority priority, const RelevancyContext& context);
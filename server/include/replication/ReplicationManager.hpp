@@ -2,10 +2,16 @@
 
 #include "ecs/Registry.hpp"
 #include "network/NetworkConstants.hpp"
-#include "replication/EntityStateCache.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "replication/ClientBaseline.hpp"
+#include "replication/Relevancy.hpp"
+#include "replication/SnapshotBuffers.hpp"
 
+#include <cstddef>
 #include <cstdint>
-#include <unordered_set>
+#include <span>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 class ReplicationManager
@@ -13,17 +19,35 @@ class ReplicationManager
   public:
     ReplicationManager();
 
+    static constexpr std::uint32_t kBaselinePruneInterval = 60;
+    static constexpr std::size_t kClientByteBudget        = Network::kMaxSafePacketPayload;
+
     struct SyncResult
     {
-        std::vector<std::vector<std::uint8_t>> packets;
+        std::span<std::vector<std::uint8_t>> packets;
         bool wasFull;
+        std::size_t deferred = 0;
     };
 
-    SyncResult synchronize(const Registry& registry, std::uint32_t currentTick);
-    SyncResult synchronize(const Registry& registry, std::uint32_t currentTick, bool forceFull);
+    void capture(const Registry& registry, std::uint32_t currentTick);
+    void capture(const Registry& registry, std::uint32_t currentTick, const RelevancyContext& context);
+    void capture(const CaptureFrame& frame, const RelevancyContext& context);
+    void setByteBudget(std::size_t bytes);
+    std::size_t replicatedCount() const;
+    SyncResult synchronize(const std::string& client);
+    SyncResult synchronize(const std::string& client, bool forceFull);
+
+    bool acknowledge(const std::string& client, std::uint32_t tick);
+    void removeClient(const std::string& client);
+    const ClientBaseline* baseline(const std::string& client) const;
 
     void clear();
 
   private:
-    EntityStateCache entityStateCache_;
+    std::uint32_t currentTick_ = 0;
+    std::size_t byteBudget_    = kClientByteBudget;
+    std::vector<ReplicatedEntity> entities_;
+    std::unordered_map<std::string, ClientBaseline> clients_;
+    CaptureFrame frame_;
+    SnapshotBuffers buffers_;
 };
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "network/BitStream.hpp"
+#include "network/SendBufferRing.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/ClientBaseline.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct WireEntity
+{
+    SnapshotCodec::EntityHeader header{};
+    SnapshotCodec::EntityFields fields{};
+    const SnapshotCodec::EntityFields* base = nullptr;
+};
+
+struct SnapshotBuffers
+{
+    std::vector<WireEntity> entities;
+    std::vector<SentEntityState> sent;
+    std::vector<std::size_t> entityOffsets;
+    BitWriter stream;
+    std::vector<std::uint8_t> payload;
+    SendBufferRing packets;
+};
@@ -8,7 +8,6 @@
 #include <memory>
 #include <mutex>
 #include <optional>
-#include <unordered_map>
 
 class Registry;
 using EntityId = std::uint32_t;
@@ -16,11 +15,13 @@ using EntityId = std::uint32_t;
 class RollbackManager
 {
   public:
-    RollbackManager();
+    explicit RollbackManager(std::size_t historyTicks = StateHistory::HISTORY_SIZE);
 
     std::uint32_t captureState(std::uint64_t tick, const Registry& registry);
 
-    std::optional<std::reference_wrapper<const StateSnapshot>> getSnapshot(std::uint64_t tick) const;
+    std::uint32_t captureState(const CaptureFrame& frame);
+
+    bool getSnapshot(std::uint64_t tick, StateSnapshot& out) const;
 
     bool canRollbackTo(std::uint64_t tick) const;
 
@@ -35,10 +36,11 @@ class RollbackManager
     std::size_t getHistorySize() const;
 
   private:
-    std::unordered_map<EntityId, CachedEntityState> extractEntityStates(const Registry& registry) const;
-
-    void restoreEntityStates(Registry& registry, const std::unordered_map<EntityId, CachedEntityState>& states) const;
+    void restoreEntityStates(Registry& registry, const StateSnapshot& snapshot) const;
 
     StateHistory stateHistory_;
+    StateHash stateHash_;
+    CaptureFrame frame_;
+    StateSnapshot restored_;
     mutable std::mutex historyMutex_;
 };
@@ -1,33 +1,23 @@
 #pragma once
 
-#include <cstdint>
-#include <cstring>
-#include <unordered_map>
-#include <vector>
+#include "rollback/StateHash.hpp"
 
-using EntityId = std::uint32_t;
+#include <cstdint>
 
 struct CachedEntityState;
+struct CaptureFrame;
 
 class StateChecksum
 {
   public:
-    static std::uint32_t compute(const std::unordered_map<EntityId, CachedEntityState>& entities);
+    static StateHashFields fields(const CachedEntityState& state);
 
-    static std::uint32_t computeCritical(const std::unordered_map<EntityId, CachedEntityState>& entities);
+    static std::uint32_t compute(const CaptureFrame& frame);
+
+    static void update(StateHash& hash, const CaptureFrame& frame);
 
     static bool verify(std::uint32_t checksum1, std::uint32_t checksum2)
     {
         return checksum1 == checksum2;
     }
-
-  private:
-    static const std::uint32_t CRC32_TABLE[256];
-
-    static std::uint32_t updateCRC32(std::uint32_t crc, const void* data, std::size_t length);
-
-    static std::uint32_t finalizeCRC32(std::uint32_t crc)
-    {
-        return ~crc;
-    }
 };
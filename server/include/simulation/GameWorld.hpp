@@ -16,6 +16,7 @@
 #include "systems/MonsterMovementSystem.hpp"
 #include "systems/MovementSystem.hpp"
 #include "systems/PlayerBoundsSystem.hpp"
+#include "systems/PlayerIndex.hpp"
 #include "systems/PlayerInputSystem.hpp"
 #include "systems/ScoreSystem.hpp"
 
@@ -28,6 +29,9 @@ class GameWorld
 {
   public:
     GameWorld();
+    explicit GameWorld(StorageMode mode);
+
+    static StorageMode defaultStorageMode();
 
     void tick(float deltaTime, const std::vector<PlayerCommand>& commands,
               const std::map<std::uint32_t, EntityId>& playerEntities);
@@ -94,6 +98,7 @@ class GameWorld
     EventBus eventBus_;
     std::vector<GameEvent> pendingEvents_;
     std::unordered_set<EntityId> knownEntities_;
+    PlayerIndex playerIndex_;
 
     PlayerInputSystem playerInputSys_;
     MovementSystem movementSys_;
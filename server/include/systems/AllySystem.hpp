@@ -1,12 +1,13 @@
 #pragma once
 
 #include "ecs/Registry.hpp"
+#include "systems/PlayerIndex.hpp"
 
 class AllySystem
 {
   public:
     AllySystem() = default;
-    void update(Registry& registry, float deltaTime);
+    void update(Registry& registry, const PlayerIndex& players, float deltaTime);
 
   private:
     static constexpr float kVerticalOffset       = 30.0F;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+struct CollisionBatch
+{
+    const float* minX    = nullptr;
+    const float* maxX    = nullptr;
+    const float* minY    = nullptr;
+    const float* maxY    = nullptr;
+    const float* centerX = nullptr;
+    const float* centerY = nullptr;
+    const float* radius  = nullptr;
+};
+
+namespace CollisionKernels
+{
+    const char* backend();
+    std::size_t lanes();
+
+    void overlapAabb(const CollisionBatch& batch, std::size_t begin, std::size_t end, const std::array<float, 4>& box,
+                     std::uint8_t* hits);
+    void overlapCircle(const CollisionBatch& batch, std::size_t begin, std::size_t end, float centerX, float centerY,
+                       float radius, std::uint8_t* hits);
+
+    void overlapAabbScalar(const CollisionBatch& batch, std::size_t begin, std::size_t end,
+                           const std::array<float, 4>& box, std::uint8_t* hits);
+    void overlapCircleScalar(const CollisionBatch& batch, std::size_t begin, std::size_t end, float centerX,
+                             float centerY, float radius, std::uint8_t* hits);
+} // namespace CollisionKernels
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "components/ColliderComponent.hpp"
+#include "components/CollisionLayer.hpp"
+#include "components/HitboxComponent.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+struct CollisionPoint
+{
+    float x = 0.0F;
+    float y = 0.0F;
+};
+
+struct CollisionShape
+{
+    static constexpr std::size_t kMaxPoints = ColliderComponent::kMaxPoints;
+
+    ColliderComponent::Shape type = ColliderComponent::Shape::Box;
+    bool active                   = false;
+    std::array<CollisionPoint, kMaxPoints> points{};
+    std::array<CollisionPoint, kMaxPoints> normals{};
+    std::uint8_t pointCount  = 0;
+    std::uint8_t normalCount = 0;
+    CollisionPoint center{};
+    float radius = 0.0F;
+    std::array<float, 4> aabb{};
+    std::uint32_t layer = CollisionLayer::All;
+    std::uint32_t mask  = CollisionLayer::All;
+};
+
+struct CollisionShapeSource
+{
+    float x                       = 0.0F;
+    float y                       = 0.0F;
+    float scaleX                  = 1.0F;
+    float scaleY                  = 1.0F;
+    bool hasCollider              = false;
+    ColliderComponent::Shape type = ColliderComponent::Shape::Box;
+    bool active                   = false;
+    float width                   = 0.0F;
+    float height                  = 0.0F;
+    float offsetX                 = 0.0F;
+    float offsetY                 = 0.0F;
+    float radius                  = 0.0F;
+    std::size_t pointCount        = 0;
+    std::array<std::array<float, 2>, CollisionShape::kMaxPoints> points{};
+};
+
+struct CachedCollisionShape
+{
+    bool initialized         = false;
+    bool valid               = false;
+    std::uint32_t generation = 0;
+    CollisionShapeSource source;
+    CollisionShape shape;
+};
+
+struct CollisionStats
+{
+    std::size_t shapesRebuilt = 0;
+    std::size_t shapesReused  = 0;
+    std::size_t batchedPairs  = 0;
+    std::size_t satPairs      = 0;
+    std::size_t allocations   = 0;
+};
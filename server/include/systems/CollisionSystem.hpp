@@ -2,6 +2,9 @@
 
 #include "components/Components.hpp"
 #include "ecs/Registry.hpp"
+#include "levels/LevelData.hpp"
+#include "systems/CollisionKernels.hpp"
+#include "systems/CollisionShape.hpp"
 
 #include <array>
 #include <vector>
@@ -15,5 +18,67 @@ struct Collision
 class CollisionSystem
 {
   public:
-    std::vector<Collision> detect(Registry& registry) const;
+    static constexpr float kDefaultCellSize = 64.0F;
+
+    CollisionSystem();
+
+    void setBounds(const CameraBounds& bounds, float cellSize = kDefaultCellSize);
+    const std::vector<Collision>& detect(Registry& registry);
+    const CollisionStats& stats() const;
+
+  private:
+    struct CellRange
+    {
+        int minX = 0;
+        int maxX = 0;
+        int minY = 0;
+        int maxY = 0;
+    };
+
+    struct Candidate
+    {
+        std::size_t a = 0;
+        std::size_t b = 0;
+        bool resolved = false;
+    };
+
+    static constexpr int kMaxGridCells = 4096;
+
+    CollisionShape* cachedShape(const Registry& registry, EntityId id, const TransformComponent& transform,
+                                const ColliderComponent* collider, const HitboxComponent* hitbox);
+    void gatherShapes(Registry& registry);
+    void buildGrid();
+    void collectCandidates();
+    void collectCell(std::size_t begin, std::size_t end, int x, int y);
+    CollisionBatch cellBatch() const;
+    template <typename T> void reserveTracked(std::vector<T>& values, std::size_t count);
+    template <typename T> void pushTracked(std::vector<T>& values, const T& value);
+
+    float originX_  = 0.0F;
+    float originY_  = 0.0F;
+    float cellSize_ = kDefaultCellSize;
+    int columns_    = 1;
+    int rows_       = 1;
+
+    std::vector<CachedCollisionShape> cache_;
+    std::vector<EntityId> ids_;
+    std::vector<CollisionShape*> shapes_;
+    std::vector<CellRange> ranges_;
+    std::vector<std::size_t> unbounded_;
+    std::vector<std::uint8_t> isUnbounded_;
+    std::vector<std::size_t> cellStart_;
+    std::vector<std::size_t> cellCursor_;
+    std::vector<std::size_t> cellItems_;
+    std::vector<float> cellMinX_;
+    std::vector<float> cellMaxX_;
+    std::vector<float> cellMinY_;
+    std::vector<float> cellMaxY_;
+    std::vector<float> cellCenterX_;
+    std::vector<float> cellCenterY_;
+    std::vector<float> cellRadius_;
+    std::vector<std::uint8_t> aabbHits_;
+    std::vector<std::uint8_t> circleHits_;
+    std::vector<Candidate> candidates_;
+    std::vector<Collision> collisions_;
+    CollisionStats stats_;
 };
@@ -2,10 +2,11 @@
 
 #include "components/Components.hpp"
 #include "ecs/Registry.hpp"
+#include "systems/PlayerIndex.hpp"
 
 class EnemyShootingSystem
 {
   public:
     EnemyShootingSystem() = default;
-    void update(Registry& registry, float deltaTime);
+    void update(Registry& registry, const PlayerIndex& players, float deltaTime);
 };
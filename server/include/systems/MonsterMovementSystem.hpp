@@ -2,9 +2,10 @@
 
 #include "components/Components.hpp"
 #include "ecs/Registry.hpp"
+#include "systems/PlayerIndex.hpp"
 
 class MonsterMovementSystem
 {
   public:
-    void update(Registry& registry, float deltaTime) const;
+    void update(Registry& registry, const PlayerIndex& players, float deltaTime) const;
 };
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "components/Components.hpp"
+#include "ecs/Registry.hpp"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+struct PlayerTarget
+{
+    EntityId id           = 0;
+    float x               = 0.0F;
+    float y               = 0.0F;
+    float distanceSquared = 0.0F;
+};
+
+class PlayerIndex
+{
+  public:
+    void rebuild(const Registry& registry, const std::map<std::uint32_t, EntityId>& playerEntities);
+    void refresh(const Registry& registry);
+    void clear();
+
+    std::optional<PlayerTarget> nearest(float x, float y) const;
+    std::optional<EntityId> findByOwner(std::uint32_t ownerId) const;
+
+    std::size_t size() const;
+    bool empty() const;
+    const std::vector<EntityId>& ids() const;
+
+  private:
+    static bool isPlayer(const Registry& registry, EntityId id);
+    void readPositions(const Registry& registry);
+
+    std::vector<EntityId> ids_;
+    std::vector<float> xs_;
+    std::vector<float> ys_;
+    std::vector<std::uint32_t> owners_;
+    std::vector<std::uint8_t> hasOwner_;
+};
@@ -5,7 +5,7 @@
 
 void GameInstance::captureStateSnapshot()
 {
-    std::uint32_t checksum = rollbackManager_.captureState(currentTick_, registry_);
+    std::uint32_t checksum = rollbackManager_.captureState(frame_);
 
     if (currentTick_ % 60 == 0) {
         Logger::instance().info("[Rollback] Captured state snapshot at tick " + std::to_string(currentTick_) +
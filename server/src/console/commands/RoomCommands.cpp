@@ -5,9 +5,22 @@
 #include "game/GameInstanceManager.hpp"
 #include "lobby/LobbyManager.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <sstream>
 #include <vector>
 
+namespace
+{
+    std::string formatMicros(std::chrono::nanoseconds value)
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(1) << static_cast<double>(value.count()) / 1000.0 << "us";
+        return ss.str();
+    }
+} // namespace
+
 bool RoomCommands::handleCommand(ServerConsole* console, GameInstanceManager* instanceManager,
                                  LobbyManager* lobbyManager, const std::string& cmd)
 {
@@ -29,6 +42,14 @@ bool RoomCommands::handleCommand(ServerConsole* console, GameInstanceManager* in
         handleKickPlayer(console, instanceManager, cmd.substr(5));
         return true;
     }
+    if (CommandUtils::startsWithIgnoreCase(cmd, "profile ")) {
+        handleProfile(console, instanceManager, cmd.substr(8));
+        return true;
+    }
+    if (CommandUtils::startsWithIgnoreCase(cmd, "trace ")) {
+        handleTrace(console, instanceManager, cmd.substr(6));
+        return true;
+    }
     return false;
 }
 
@@ -47,10 +68,16 @@ void RoomCommands::handleList(ServerConsole* console, GameInstanceManager* insta
     for (auto roomId : roomIds) {
         auto* instance = instanceManager->getInstance(roomId);
         if (instance != nullptr) {
+            std::string lateness;
+            if (auto metrics = instanceManager->getTickMetrics(roomId)) {
+                lateness = " | Late: " + std::to_string(metrics->lateTicks) + "/" + std::to_string(metrics->ticks) +
+                           " ticks (avg " + std::to_string(metrics->meanLateness().count()) + "us, max " +
+                           std::to_string(metrics->maxLateness.count()) + "us)";
+            }
             console->addAdminLog("  Room " + std::to_string(roomId) +
                                  " | Port: " + std::to_string(instance->getPort()) +
                                  " | Players: " + std::to_string(instance->getPlayerCount()) +
-                                 (instance->isGameStarted() ? " | PLAYING" : " | WAITING"));
+                                 (instance->isGameStarted() ? " | PLAYING" : " | WAITING") + lateness);
         }
     }
 }
@@ -140,3 +167,65 @@ void RoomCommands::handleKickPlayer(ServerConsole* console, GameInstanceManager*
         console->addAdminLog("[Error] Invalid arguments. Usage: kick <room_id> <player_id>");
     }
 }
+
+void RoomCommands::handleProfile(ServerConsole* console, GameInstanceManager* instanceManager, const std::string& args)
+{
+    std::stringstream ss(args);
+    std::string idArg;
+    std::string action;
+    ss >> idArg >> action;
+    try {
+        std::uint32_t roomId = std::stoul(idArg);
+        auto* instance       = instanceManager != nullptr ? instanceManager->getInstance(roomId) : nullptr;
+        if (instance == nullptr) {
+            console->addAdminLog("[Error] Room " + std::to_string(roomId) + " not found");
+            return;
+        }
+        if (CommandUtils::toLower(action) == "reset") {
+            instance->getProfiler().reset();
+            console->addAdminLog("[Profile] Room " + std::to_string(roomId) + " histograms reset");
+            return;
+        }
+
+        auto zones = instance->getProfiler().stats();
+        if (zones.empty()) {
+            console->addAdminLog("[Profile] Room " + std::to_string(roomId) + " has no samples yet");
+            return;
+        }
+        std::sort(zones.begin(), zones.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.p99 > b.p99; });
+        console->addAdminLog("[Profile] Room " + std::to_string(roomId) + " over " +
+                             std::to_string(instance->getProfiler().ticks()) + " ticks (p50 / p99 / max):");
+        for (const auto& zone : zones) {
+            std::ostringstream line;
+            line << "  " << std::left << std::setw(22) << zone.name << " " << formatMicros(zone.p50) << " / "
+                 << formatMicros(zone.p99) << " / " << formatMicros(zone.max);
+            console->addAdminLog(line.str());
+        }
+    } catch (...) {
+        console->addAdminLog("[Error] Invalid room ID: " + idArg);
+    }
+}
+
+void RoomCommands::handleTrace(ServerConsole* console, GameInstanceManager* instanceManager, const std::string& args)
+{
+    std::stringstream ss(args);
+    std::string idArg;
+    std::string path;
+    ss >> idArg >> path;
+    try {
+        std::uint32_t roomId = std::stoul(idArg);
+        auto* instance       = instanceManager != nullptr ? instanceManager->getInstance(roomId) : nullptr;
+        if (instance == nullptr) {
+            console->addAdminLog("[Error] Room " + std::to_string(roomId) + " not found");
+            return;
+        }
+        if (path.empty())
+            path = "logs/trace_room_" + std::to_string(roomId) + ".json";
+        if (instance->getProfiler().writeChromeTrace(path, static_cast<int>(roomId), "Room " + std::to_string(roomId)))
+            console->addAdminLog("[Profile] Chrome trace written to " + path);
+        else
+            console->addAdminLog("[Error] Could not write trace to " + path);
+    } catch (...) {
+        console->addAdminLog("[Error] Invalid room ID: " + idArg);
+    }
+}
@@ -46,6 +46,8 @@ void SystemCommands::handleHelp(ServerConsole* console)
     console->addAdminLog("Available commands:");
     console->addAdminLog("  rooms       - List all active rooms");
     console->addAdminLog("  kill <id>   - Force-stop a room");
+    console->addAdminLog("  profile <id> [reset] - Tick zone p50/p99/max for a room");
+    console->addAdminLog("  trace <id> [path]    - Dump the last ticks of a room as a Chrome trace");
     console->addAdminLog("  logs <id>   - Filter logs to room");
     console->addAdminLog("  logs all    - Show all logs");
     console->addAdminLog("  tags list   - List enabled/available tags");
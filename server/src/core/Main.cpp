@@ -16,10 +16,13 @@ int main(int argc, char* argv[])
 #ifdef _WIN32
     timeBeginPeriod(1);
 #endif
-    (void) argc;
-    (void) argv;
+    GamePortMode gamePortMode = GamePortMode::PerRoom;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--shared-game-port")
+            gamePortMode = GamePortMode::Shared;
+    }
     Logger::instance().setVerbose(true);
     Logger::instance().loadTagConfig("server.log.config");
-    run_server();
+    run_server(gamePortMode);
     return 0;
 }
@@ -16,15 +16,17 @@ namespace
     }
 } // namespace
 
-void run_server()
+void run_server(GamePortMode gamePortMode)
 {
     std::signal(SIGINT, signalHandler);
 
-    constexpr std::uint16_t kLobbyPort    = 50010;
-    constexpr std::uint16_t kGameBasePort = 50100;
-    constexpr std::uint32_t kMaxInstances = 10;
+    constexpr std::uint16_t kLobbyPort          = 50010;
+    constexpr std::uint16_t kGameBasePort       = 50100;
+    constexpr std::uint32_t kMaxInstances       = 10;
+    constexpr std::uint32_t kMaxSharedInstances = 256;
 
-    LobbyServer server(kLobbyPort, kGameBasePort, kMaxInstances, g_running);
+    const std::uint32_t maxInstances = gamePortMode == GamePortMode::Shared ? kMaxSharedInstances : kMaxInstances;
+    LobbyServer server(kLobbyPort, kGameBasePort, maxInstances, g_running, gamePortMode);
 
     if (!server.start()) {
         Logger::instance().error("[Net] Failed to start lobby server");
@@ -103,8 +103,15 @@ namespace
     }
 } // namespace
 
-GameInstance::GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag)
-    : roomId_(roomId), port_(port), world_(), registry_(world_.getRegistry()),
+GameInstance::GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag,
+                           SharedGamePort* sharedPort, RoomScheduler* scheduler)
+    : GameInstance(roomId, port, runningFlag, GameWorld::defaultStorageMode(), sharedPort, scheduler)
+{}
+
+GameInstance::GameInstance(std::uint32_t roomId, std::uint16_t port, std::atomic<bool>& runningFlag,
+                           StorageMode storageMode, SharedGamePort* sharedPort, RoomScheduler* scheduler)
+    : roomId_(roomId), port_(port), sharedPort_(sharedPort), scheduler_(scheduler), world_(storageMode),
+      registry_(world_.getRegistry()),
       playerInputSys_(kBasePlayerSpeed, kBaseMissileSpeed, kBaseMissileLifetime, kBaseMissileDamage), movementSys_(),
       monsterMovementSys_(), enemyShootingSys_(), damageSys_(eventBus_), scoreSys_(eventBus_, registry_),
       destructionSys_(eventBus_), receiveThread_(IpEndpoint{.addr = {0, 0, 0, 0}, .port = port}, inputQueue_,
@@ -188,14 +195,18 @@ bool GameInstance::start()
         logError("[Level] Server start aborted: level not loaded");
         return false;
     }
-    if (!receiveThread_.start()) {
+    bool receiving = sharedPort_ ? receiveThread_.start(*sharedPort_, roomId_) : receiveThread_.start();
+    if (!receiving) {
         return false;
     }
-    if (!sendThread_.start()) {
+    bool sending = sharedPort_ ? sendThread_.start(*sharedPort_) : sendThread_.start();
+    if (!sending) {
         receiveThread_.stop();
         return false;
     }
-    if (!gameLoop_.start()) {
+    auto onTick  = [this](const std::vector<ReceivedInput>& inputs) { tick(inputs); };
+    bool ticking = scheduler_ ? scheduler_->add(roomId_, inputQueue_, onTick, kTickRate) : gameLoop_.start();
+    if (!ticking) {
         sendThread_.stop();
         receiveThread_.stop();
         return false;
@@ -211,9 +222,18 @@ void GameInstance::run()
     }
 }
 
+GameInstance::~GameInstance()
+{
+    if (scheduler_)
+        scheduler_->remove(roomId_);
+    gameLoop_.stop();
+}
+
 void GameInstance::stop(const std::string& reason)
 {
     notifyDisconnection(reason);
+    if (scheduler_)
+        scheduler_->remove(roomId_);
     gameLoop_.stop();
     sendThread_.stop();
     receiveThread_.stop();
@@ -428,6 +448,7 @@ void GameInstance::resetGame()
     clients_.clear();
     sendThread_.setClients(clients_);
     sendThread_.clearLatest();
+    replicationManager_.clear();
     currentTick_ = 0;
     gameStarted_ = false;
     gameEnded_   = false;
@@ -594,114 +615,122 @@ void GameInstance::spawnPlayerDeathFx(float x, float y)
 
 void GameInstance::handleDeathAndRespawn()
 {
-    std::vector<EntityId> toDestroy;
-    std::vector<std::pair<float, float>> deathFxToSpawn;
+    std::vector<EntityId> dying;
     for (EntityId id : registry_.view<HealthComponent>()) {
         if (!registry_.isAlive(id))
             continue;
-        auto& health = registry_.get<HealthComponent>(id);
-        if (health.current <= 0) {
-            const bool isPlayer =
-                registry_.has<TagComponent>(id) && registry_.get<TagComponent>(id).hasTag(EntityTag::Player);
-            float deathX      = 0.0F;
-            float deathY      = 0.0F;
-            bool hadTransform = false;
-            if (registry_.has<TransformComponent>(id)) {
-                auto& t      = registry_.get<TransformComponent>(id);
-                deathX       = t.x;
-                deathY       = t.y;
-                hadTransform = true;
-            }
-            if (registry_.has<LivesComponent>(id)) {
-                auto& lives = registry_.get<LivesComponent>(id);
-                if (lives.current > 0) {
-                    if (!registry_.has<RespawnTimerComponent>(id)) {
-                        lives.loseLife();
-                        if (isPlayer) {
-                            Logger::instance().warn("[Game] Player Entity " + std::to_string(id) +
-                                                    " lost a life. Remaining: " + std::to_string(lives.current));
-                        }
-                        if (isPlayer && hadTransform) {
-                            deathFxToSpawn.emplace_back(deathX, deathY);
-                        }
-                        registry_.emplace<RespawnTimerComponent>(id, RespawnTimerComponent::create(kRespawnDelay));
-                        if (registry_.has<TransformComponent>(id)) {
-                            registry_.get<TransformComponent>(id).y = kOffscreenRespawnPlaceholder;
-                        }
-                        if (registry_.has<VelocityComponent>(id)) {
-                            auto& v = registry_.get<VelocityComponent>(id);
-                            v.vx    = 0.0F;
-                            v.vy    = 0.0F;
-                        }
+        if (registry_.get<HealthComponent>(id).current <= 0) {
+            dying.push_back(id);
+        }
+    }
 
-                        if (lives.current == 0 && !gameEnded_) {
-                            bool anyAlive = false;
-                            for (const auto& [pId, eId] : playerEntities_) {
-                                if (registry_.has<LivesComponent>(eId)) {
-                                    if (registry_.get<LivesComponent>(eId).current > 0) {
-                                        anyAlive = true;
-                                        break;
-                                    }
-                                } else if (registry_.isAlive(eId)) {
+    std::vector<EntityId> toDestroy;
+    std::vector<std::pair<float, float>> deathFxToSpawn;
+    for (EntityId id : dying) {
+        const bool isPlayer =
+            registry_.has<TagComponent>(id) && registry_.get<TagComponent>(id).hasTag(EntityTag::Player);
+        float deathX      = 0.0F;
+        float deathY      = 0.0F;
+        bool hadTransform = false;
+        if (registry_.has<TransformComponent>(id)) {
+            const auto& t = registry_.get<TransformComponent>(id);
+            deathX        = t.x;
+            deathY        = t.y;
+            hadTransform  = true;
+        }
+        if (registry_.has<LivesComponent>(id)) {
+            auto& lives = registry_.get<LivesComponent>(id);
+            if (lives.current > 0) {
+                if (!registry_.has<RespawnTimerComponent>(id)) {
+                    lives.loseLife();
+                    const int livesLeft = lives.current;
+                    if (isPlayer) {
+                        Logger::instance().warn("[Game] Player Entity " + std::to_string(id) +
+                                                " lost a life. Remaining: " + std::to_string(livesLeft));
+                    }
+                    if (isPlayer && hadTransform) {
+                        deathFxToSpawn.emplace_back(deathX, deathY);
+                    }
+                    registry_.emplace<RespawnTimerComponent>(id, RespawnTimerComponent::create(kRespawnDelay));
+                    if (registry_.has<TransformComponent>(id)) {
+                        registry_.get<TransformComponent>(id).y = kOffscreenRespawnPlaceholder;
+                    }
+                    if (registry_.has<VelocityComponent>(id)) {
+                        auto& v = registry_.get<VelocityComponent>(id);
+                        v.vx    = 0.0F;
+                        v.vy    = 0.0F;
+                    }
+
+                    if (livesLeft == 0 && !gameEnded_) {
+                        bool anyAlive = false;
+                        for (const auto& [pId, eId] : playerEntities_) {
+                            if (registry_.has<LivesComponent>(eId)) {
+                                if (registry_.get<LivesComponent>(eId).current > 0) {
                                     anyAlive = true;
                                     break;
                                 }
+                            } else if (registry_.isAlive(eId)) {
+                                anyAlive = true;
+                                break;
                             }
+                        }
 
-                            if (!anyAlive) {
-                                gameEnded_ = true;
-                                if (gameEndCallback_) {
-                                    std::vector<PlayerGameResult> results;
-                                    for (const auto& [pId, eId] : playerEntities_) {
-                                        int scoreVal = 0;
-                                        if (registry_.has<ScoreComponent>(eId)) {
-                                            scoreVal = registry_.get<ScoreComponent>(eId).value;
-                                        }
+                        if (!anyAlive) {
+                            gameEnded_ = true;
+                            if (gameEndCallback_) {
+                                std::vector<PlayerGameResult> results;
+                                for (const auto& [pId, eId] : playerEntities_) {
+                                    int scoreVal = 0;
+                                    if (registry_.has<ScoreComponent>(eId)) {
+                                        scoreVal = registry_.get<ScoreComponent>(eId).value;
+                                    }
 
-                                        std::uint32_t finalId = pId;
-                                        for (const auto& [key, sess] : sessions_) {
-                                            if (sess.playerId == pId && sess.userId.has_value()) {
-                                                finalId = sess.userId.value();
-                                                break;
-                                            }
+                                    std::uint32_t finalId = pId;
+                                    for (const auto& [key, sess] : sessions_) {
+                                        if (sess.playerId == pId && sess.userId.has_value()) {
+                                            finalId = sess.userId.value();
+                                            break;
                                         }
-                                        results.push_back({finalId, scoreVal});
                                     }
-                                    gameEndCallback_(roomId_, results, false);
+                                    results.push_back({finalId, scoreVal});
                                 }
+                                gameEndCallback_(roomId_, results, false);
                             }
                         }
+                    }
 
-                        if (isPlayer && registry_.has<OwnershipComponent>(id)) {
-                            std::uint32_t playerId = registry_.get<OwnershipComponent>(id).ownerId;
-                            for (EntityId allyId : registry_.view<AllyComponent>()) {
-                                if (!registry_.isAlive(allyId))
-                                    continue;
-                                const auto& ally = registry_.get<AllyComponent>(allyId);
-                                if (ally.ownerId == playerId) {
-                                    if (registry_.has<TransformComponent>(allyId)) {
-                                        const auto& allyT = registry_.get<TransformComponent>(allyId);
-                                        deathFxToSpawn.emplace_back(allyT.x, allyT.y);
-                                    }
-                                    if (!registry_.has<RespawnTimerComponent>(allyId)) {
-                                        registry_.emplace<RespawnTimerComponent>(
-                                            allyId, RespawnTimerComponent::create(kRespawnDelay));
-                                        if (registry_.has<TransformComponent>(allyId)) {
-                                            registry_.get<TransformComponent>(allyId).y = kOffscreenRespawnPlaceholder;
-                                        }
-                                    }
+                    if (isPlayer && registry_.has<OwnershipComponent>(id)) {
+                        std::uint32_t playerId = registry_.get<OwnershipComponent>(id).ownerId;
+                        std::vector<EntityId> allies;
+                        for (EntityId allyId : registry_.view<AllyComponent>()) {
+                            if (!registry_.isAlive(allyId))
+                                continue;
+                            if (registry_.get<AllyComponent>(allyId).ownerId == playerId) {
+                                allies.push_back(allyId);
+                            }
+                        }
+                        for (EntityId allyId : allies) {
+                            if (registry_.has<TransformComponent>(allyId)) {
+                                const auto& allyT = registry_.get<TransformComponent>(allyId);
+                                deathFxToSpawn.emplace_back(allyT.x, allyT.y);
+                            }
+                            if (!registry_.has<RespawnTimerComponent>(allyId)) {
+                                registry_.emplace<RespawnTimerComponent>(
+                                    allyId, RespawnTimerComponent::create(kRespawnDelay));
+                                if (registry_.has<TransformComponent>(allyId)) {
+                                    registry_.get<TransformComponent>(allyId).y = kOffscreenRespawnPlaceholder;
                                 }
                             }
                         }
                     }
-                    continue;
                 }
+                continue;
             }
-            if (isPlayer && hadTransform) {
-                deathFxToSpawn.emplace_back(deathX, deathY);
-            }
-            toDestroy.push_back(id);
         }
+        if (isPlayer && hadTransform) {
+            deathFxToSpawn.emplace_back(deathX, deathY);
+        }
+        toDestroy.push_back(id);
     }
     for (const auto& pos : deathFxToSpawn) {
         spawnPlayerDeathFx(pos.first, pos.second);
@@ -29,6 +29,11 @@ void GameInstance::handleControlMessage(const ControlEvent& ctrl)
         return;
     }
 
+    if (type == static_cast<std::uint8_t>(MessageType::ClientAcknowledge)) {
+        replicationManager_.acknowledge(key, ctrl.header.tickId);
+        return;
+    }
+
     auto& sess    = sessions_[key];
     sess.endpoint = ctrl.from;
     if (sess.playerId == 0) {
@@ -307,6 +312,7 @@ void GameInstance::onDisconnect(const IpEndpoint& endpoint)
     }
     std::erase_if(clients_, [&](const IpEndpoint& ep) { return endpointKey(ep) == endpointKey(endpoint); });
     sendThread_.setClients(clients_);
+    replicationManager_.removeClient(endpointKey(endpoint));
 
     if (gameEnded_) {
         Logger::instance().info("[Game] Game ended and player disconnected, resetting for retry");
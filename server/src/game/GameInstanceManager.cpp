@@ -5,10 +5,16 @@
 #include <algorithm>
 
 GameInstanceManager::GameInstanceManager(std::uint16_t basePort, std::uint32_t maxInstances,
-                                         std::atomic<bool>& runningFlag)
-    : basePort_(basePort), maxInstances_(maxInstances), running_(&runningFlag)
+                                         std::atomic<bool>& runningFlag, GamePortMode portMode, std::size_t tickWorkers)
+    : basePort_(basePort), maxInstances_(maxInstances), running_(&runningFlag), portMode_(portMode),
+      scheduler_(tickWorkers)
 {
-    Logger::instance().info("[InstanceManager] Initialized with max instances: " + std::to_string(maxInstances));
+    if (portMode_ == GamePortMode::Shared)
+        sharedPort_ = std::make_unique<SharedGamePort>(IpEndpoint{.addr = {0, 0, 0, 0}, .port = basePort_});
+    scheduler_.start();
+    Logger::instance().info("[InstanceManager] Initialized with max instances: " + std::to_string(maxInstances) +
+                            ", " + std::to_string(scheduler_.workerCount()) + " tick workers" +
+                            (sharedPort_ ? " on shared game port " + std::to_string(basePort_) : ""));
 }
 
 std::optional<std::uint32_t> GameInstanceManager::createInstance(const RoomConfig& config)
@@ -21,11 +27,16 @@ std::optional<std::uint32_t> GameInstanceManager::createInstance(const RoomConfi
         return std::nullopt;
     }
 
+    if (sharedPort_ && !sharedPort_->isRunning() && !sharedPort_->start()) {
+        Logger::instance().error("[InstanceManager] Failed to open shared game port " + std::to_string(basePort_));
+        return std::nullopt;
+    }
+
     std::uint32_t roomId = nextRoomId_++;
 
-    std::uint16_t instancePort = basePort_ + static_cast<std::uint16_t>(roomId);
+    std::uint16_t instancePort = sharedPort_ ? basePort_ : basePort_ + static_cast<std::uint16_t>(roomId);
 
-    auto instance = std::make_unique<GameInstance>(roomId, instancePort, *running_);
+    auto instance = std::make_unique<GameInstance>(roomId, instancePort, *running_, sharedPort_.get(), &scheduler_);
     instance->setRoomConfig(config);
     if (gameEndCallback_) {
         Logger::instance().warn("[GameInstanceManager] Setting GameEndCallback for Room " + std::to_string(roomId));
@@ -149,4 +160,6 @@ void GameInstanceManager::stopAll(const std::string& reason)
         instance->stop(reason);
     }
     instances_.clear();
+    if (sharedPort_)
+        sharedPort_->stop();
 }
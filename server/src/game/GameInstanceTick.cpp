@@ -28,13 +28,17 @@ void GameInstance::updateGameplay(float dt, const std::vector<ReceivedInput>& in
 {
     updateSystems(dt, inputs);
 
-    auto collisions = collisionSys_.detect(registry_);
+    const auto& collisions = collisionSys_.detect(registry_);
     logCollisions(collisions);
     damageSys_.apply(registry_, collisions);
 
-    handleDeathAndRespawn();
-    cleanupExpiredMissiles(dt);
+    {
+        PROFILE_ZONE("gameplay.deathRespawn");
+        handleDeathAndRespawn();
+        cleanupExpiredMissiles(dt);
+    }
 
+    PROFILE_ZONE("gameplay.events");
     world_.trackEntityLifecycle();
     auto events = world_.consumeEvents();
     networkBridge_.processEvents(events);
@@ -43,27 +47,52 @@ void GameInstance::updateGameplay(float dt, const std::vector<ReceivedInput>& in
 void GameInstance::tick(const std::vector<ReceivedInput>& inputs)
 {
     constexpr float dt = 1.0F / kTickRate;
+    ProfileTick profileTick(profiler_, currentTick_);
 
     updateNetworkStats(dt);
-    handleControl();
-    maybeStartGame();
-    updateCountdown(dt);
+    {
+        PROFILE_ZONE("control");
+        handleControl();
+        maybeStartGame();
+        updateCountdown(dt);
+    }
 
     if (gameStarted_) {
-        updateGameplay(dt, inputs);
-        sendSnapshots();
-
-        captureStateSnapshot();
+        {
+            PROFILE_ZONE("gameplay");
+            updateGameplay(dt, inputs);
+        }
+        {
+            PROFILE_ZONE("replication.capture");
+            captureFrame(registry_, currentTick_, frame_);
+        }
+        {
+            PROFILE_ZONE("replication.send");
+            sendSnapshots();
+        }
+        {
+            PROFILE_ZONE("rollback.capture");
+            captureStateSnapshot();
+        }
 
         if (currentTick_ % 60 == 0) {
             desyncDetector_.checkTimeouts(currentTick_);
         }
+        if (currentTick_ % kCompactionInterval == 0) {
+            PROFILE_ZONE("registry.compact");
+            registry_.compact();
+        }
+    }
+    {
+        PROFILE_ZONE("send.flush");
+        sendThread_.flush();
     }
     currentTick_++;
 }
 
 void GameInstance::updateSystems(float deltaTime, const std::vector<ReceivedInput>& inputs)
 {
+    PROFILE_ZONE("systems");
     introCinematic_.update(registry_, playerEntities_, deltaTime);
     const bool introActive = introCinematic_.active();
 
@@ -76,7 +105,8 @@ void GameInstance::updateSystems(float deltaTime, const std::vector<ReceivedInpu
 
     movementSys_.update(registry_, deltaTime);
     boundarySys_.update(registry_);
-    monsterMovementSys_.update(registry_, deltaTime);
+    playerIndex_.rebuild(registry_, playerEntities_);
+    monsterMovementSys_.update(registry_, playerIndex_, deltaTime);
 
     if (levelLoaded_) {
         for (const auto& cmd : commands) {
@@ -90,6 +120,8 @@ void GameInstance::updateSystems(float deltaTime, const std::vector<ReceivedInpu
         sendLevelEvents(events);
         sendSegmentState();
         playerBoundsSys_.update(registry_, levelDirector_->playerBounds());
+        if (const auto& bounds = levelDirector_->playerBounds())
+            collisionSys_.setBounds(*bounds);
 
         if (levelDirector_->isSafeZoneActive()) {
             processAllyPurchase(commands);
@@ -147,16 +179,20 @@ void GameInstance::updateSystems(float deltaTime, const std::vector<ReceivedInpu
             }
         }
 
-        allySys_.update(registry_, deltaTime);
-        shieldSys_.update(registry_, deltaTime);
+        playerIndex_.refresh(registry_);
+        allySys_.update(registry_, playerIndex_, deltaTime);
+        shieldSys_.update(registry_, playerIndex_, deltaTime);
 
-        enemyShootingSys_.update(registry_, deltaTime);
+        enemyShootingSys_.update(registry_, playerIndex_, deltaTime);
         walkerShotSys_.update(registry_, deltaTime);
 
         updateRespawnTimers(deltaTime);
         updateInvincibilityTimers(deltaTime);
 
-        cleanupOffscreenEntities();
+        {
+            PROFILE_ZONE("gameplay.offscreen");
+            cleanupOffscreenEntities();
+        }
 
         if (!gameEnded_ && !playerEntities_.empty()) {
             bool allDead = true;
@@ -237,34 +273,45 @@ std::unordered_set<EntityId> GameInstance::collectCurrentEntities()
 void GameInstance::logSnapshotSummary(std::size_t totalBytes, std::size_t payloadSize, bool forceFull)
 {
     auto& reg = world_.getRegistry();
-    Logger::instance().info("[Snapshot] tick=" + std::to_string(currentTick_) + " size=" + std::to_string(totalBytes) +
-                            " payload=" + std::to_string(payloadSize) +
-                            " entities=" + std::to_string(reg.entityCount()) + (forceFull ? " (FULL)" : " (delta)"));
+    LOG_DEBUG("[Snapshot]", "tick=", currentTick_, " size=", totalBytes, " payload=", payloadSize,
+              " entities=", reg.entityCount(), forceFull ? " (FULL)" : " (delta)");
 }
 
 void GameInstance::sendSnapshots()
 {
     bool forceFull = (currentTick_ % kFullStateInterval == 0);
-    auto result    = replicationManager_.synchronize(world_.getRegistry(), currentTick_, forceFull);
-
-    if (result.packets.empty())
-        return;
-
-    std::size_t totalSize = 0;
-    for (const auto& p : result.packets)
-        totalSize += p.size();
-
-    if (result.packets.size() > 1) {
-        Logger::instance().info("[Snapshot] tick=" + std::to_string(currentTick_) +
-                                " chunks=" + std::to_string(result.packets.size()) +
-                                " total_size=" + std::to_string(totalSize) + (result.wasFull ? " (FULL)" : " (delta)"));
-    } else {
-        logSnapshotSummary(result.packets[0].size(), 0, result.wasFull);
+    relevancy_.camera = RelevancyContext::kDefaultCamera;
+    relevancy_.bosses.clear();
+    if (levelDirector_) {
+        if (const auto& camera = levelDirector_->cameraBounds())
+            relevancy_.camera = *camera;
+        levelDirector_->activeBosses(relevancy_.bosses);
     }
+    replicationManager_.capture(frame_, relevancy_);
 
+    std::size_t packetCount = 0;
+    std::size_t totalSize   = 0;
+    std::size_t deferred    = 0;
+    bool wasFull            = false;
     for (const auto& c : clients_) {
-        for (const auto& p : result.packets)
+        auto result = replicationManager_.synchronize(endpointKey(c), forceFull);
+        for (const auto& p : result.packets) {
+            totalSize += p.size();
             sendThread_.sendTo(p, c);
+        }
+        packetCount += result.packets.size();
+        deferred += result.deferred;
+        wasFull = wasFull || (result.wasFull && !result.packets.empty());
+    }
+
+    if (packetCount == 0)
+        return;
+
+    if (packetCount > 1) {
+        LOG_DEBUG("[Snapshot]", "tick=", currentTick_, " packets=", packetCount, " clients=", clients_.size(),
+                  " total_size=", totalSize, " deferred=", deferred, wasFull ? " (FULL)" : " (delta)");
+    } else {
+        logSnapshotSummary(totalSize, 0, wasFull);
     }
 }
 
@@ -284,7 +331,7 @@ void GameInstance::cleanupExpiredMissiles(float deltaTime)
     if (expired.empty()) {
         return;
     }
-    Logger::instance().info("[Replication] Cleaning up " + std::to_string(expired.size()) + " expired missile(s)");
+    LOG_DEBUG("[Replication]", "Cleaning up ", expired.size(), " expired missile(s)");
     for (EntityId id : expired) {
         EntityDestroyedPacket pkt{};
         pkt.entityId = id;
@@ -296,19 +343,18 @@ void GameInstance::cleanupExpiredMissiles(float deltaTime)
 void GameInstance::cleanupOffscreenEntities()
 {
     std::vector<EntityId> offscreenEntities;
-    for (EntityId id : registry_.view<TransformComponent, TagComponent>()) {
-        if (!registry_.isAlive(id)) {
-            continue;
-        }
-        auto& t   = registry_.get<TransformComponent>(id);
-        auto& tag = registry_.get<TagComponent>(id);
-        if ((tag.hasTag(EntityTag::Enemy) || tag.hasTag(EntityTag::Projectile)) && (t.x < -100.0F || t.x > 2000.0F)) {
-            offscreenEntities.push_back(id);
+    for (EntityTag tag : {EntityTag::Enemy, EntityTag::Projectile}) {
+        for (EntityId id : registry_.viewTagged<TransformComponent>(tag)) {
+            if (tag == EntityTag::Projectile && registry_.hasTag(id, EntityTag::Enemy))
+                continue;
+            const auto& t = registry_.get<TransformComponent>(id);
+            if (t.x < -100.0F || t.x > 2000.0F)
+                offscreenEntities.push_back(id);
         }
     }
+    std::sort(offscreenEntities.begin(), offscreenEntities.end());
     if (!offscreenEntities.empty()) {
-        Logger::instance().info("[Replication] Cleaning up " + std::to_string(offscreenEntities.size()) +
-                                " offscreen entity(ies)");
+        LOG_DEBUG("[Replication]", "Cleaning up ", offscreenEntities.size(), " offscreen entity(ies)");
         for (EntityId id : offscreenEntities) {
             EntityDestroyedPacket pkt{};
             pkt.entityId = id;
@@ -344,20 +390,10 @@ void GameInstance::logCollisions(const std::vector<Collision>& collisions)
     if (collisions.empty()) {
         return;
     }
-    Logger::instance().info("[Collision] Detected " + std::to_string(collisions.size()) + " collision(s)");
+    LOG_DEBUG("[Collision]", "Detected ", collisions.size(), " collision(s)");
     for (const auto& col : collisions) {
-        std::string aTag = getEntityTagName(col.a);
-        std::string bTag = getEntityTagName(col.b);
-        std::string msg  = "  Collision: ";
-        msg += aTag;
-        msg += " (ID:";
-        msg += std::to_string(col.a);
-        msg += ") <-> ";
-        msg += bTag;
-        msg += " (ID:";
-        msg += std::to_string(col.b);
-        msg += ")";
-        Logger::instance().info("[Collision] " + msg);
+        LOG_DEBUG("[Collision]", "  Collision: ", getEntityTagName(col.a), " (ID:", col.a, ") <-> ",
+                  getEntityTagName(col.b), " (ID:", col.b, ")");
     }
 }
 
@@ -433,12 +469,12 @@ void GameInstance::processAllyPurchase(const std::vector<PlayerCommand>& command
         score.subtract(AllyComponent::kAllyCost);
 
         const auto& playerTransform = registry_.get<TransformComponent>(playerEntity);
+        const float allyX           = playerTransform.x;
+        const float allyY           = playerTransform.y + 30.0F;
 
         EntityId allyEntity = registry_.createEntity();
 
-        auto& at = registry_.emplace<TransformComponent>(allyEntity);
-        at.x     = playerTransform.x;
-        at.y     = playerTransform.y + 30.0F;
+        registry_.emplace<TransformComponent>(allyEntity, TransformComponent::create(allyX, allyY));
 
         registry_.emplace<VelocityComponent>(allyEntity, VelocityComponent::create(0.0F, 0.0F));
         registry_.emplace<AllyComponent>(allyEntity, AllyComponent::create(ownerId));
@@ -450,13 +486,13 @@ void GameInstance::processAllyPurchase(const std::vector<PlayerCommand>& command
         spawnPkt.entityId   = allyEntity;
         spawnPkt.ownerId    = ownerId;
         spawnPkt.entityType = static_cast<std::uint8_t>(kAllyRenderTypeId);
-        spawnPkt.posX       = at.x;
-        spawnPkt.posY       = at.y;
+        spawnPkt.posX       = allyX;
+        spawnPkt.posY       = allyY;
         sendThread_.broadcast(spawnPkt);
 
         Logger::instance().info("[Ally] Spawned ally entity " + std::to_string(allyEntity) +
-                                " for ownerId=" + std::to_string(ownerId) + " at (" + std::to_string(at.x) + ", " +
-                                std::to_string(at.y) + ")");
+                                " for ownerId=" + std::to_string(ownerId) + " at (" + std::to_string(allyX) + ", " +
+                                std::to_string(allyY) + ")");
     }
 }
 
@@ -518,12 +554,12 @@ void GameInstance::processShieldPurchase(const std::vector<PlayerCommand>& comma
         score.subtract(ShieldComponent::kShieldCost);
 
         const auto& playerTransform = registry_.get<TransformComponent>(playerEntity);
+        const float shieldX         = playerTransform.x + 40.0F;
+        const float shieldY         = playerTransform.y;
 
         EntityId shieldEntity = registry_.createEntity();
 
-        auto& st = registry_.emplace<TransformComponent>(shieldEntity);
-        st.x     = playerTransform.x + 40.0F;
-        st.y     = playerTransform.y;
+        registry_.emplace<TransformComponent>(shieldEntity, TransformComponent::create(shieldX, shieldY));
 
         registry_.emplace<VelocityComponent>(shieldEntity, VelocityComponent::create(0.0F, 0.0F));
         registry_.emplace<ShieldComponent>(shieldEntity, ShieldComponent::create(ownerId));
@@ -535,12 +571,12 @@ void GameInstance::processShieldPurchase(const std::vector<PlayerCommand>& comma
         spawnPkt.entityId   = shieldEntity;
         spawnPkt.ownerId    = ownerId;
         spawnPkt.entityType = static_cast<std::uint8_t>(kShieldRenderTypeId);
-        spawnPkt.posX       = st.x;
-        spawnPkt.posY       = st.y;
+        spawnPkt.posX       = shieldX;
+        spawnPkt.posY       = shieldY;
         sendThread_.broadcast(spawnPkt);
 
         Logger::instance().info("[Shield] Spawned shield entity " + std::to_string(shieldEntity) +
-                                " for ownerId=" + std::to_string(ownerId) + " at (" + std::to_string(st.x) + ", " +
-                                std::to_string(st.y) + ")");
+                                " for ownerId=" + std::to_string(ownerId) + " at (" + std::to_string(shieldX) + ", " +
+                                std::to_string(shieldY) + ")");
     }
 }
@@ -3,7 +3,7 @@
 #include <chrono>
 #include <thread>
 
-GameLoopThread::GameLoopThread(ThreadSafeQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz)
+GameLoopThread::GameLoopThread(MpscQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz)
     : inputs_(inputs), tick_(std::move(tick)), period_(1.0 / tickRateHz)
 {}
 
@@ -38,12 +38,10 @@ bool GameLoopThread::isRunning() const
 void GameLoopThread::run()
 {
     auto nextTick = std::chrono::steady_clock::now() + period_;
+    TickInputs batch;
     while (running_) {
-        TickInputs batch;
-        ReceivedInput item{};
-        while (inputs_.tryPop(item)) {
-            batch.push_back(std::move(item));
-        }
+        batch.clear();
+        inputs_.drainInto(batch);
         tick_(batch);
         auto now = std::chrono::steady_clock::now();
         if (now < nextTick) {
@@ -0,0 +1,217 @@
+#include "game/RoomScheduler.hpp"
+
+#include <algorithm>
+
+RoomScheduler::RoomScheduler(std::size_t workers, std::chrono::microseconds lateThreshold)
+    : lateThreshold_(lateThreshold)
+{
+    if (workers == 0)
+        workers = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    workers_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+        workers_.push_back(std::make_unique<Worker>());
+}
+
+RoomScheduler::~RoomScheduler()
+{
+    stop();
+}
+
+bool RoomScheduler::start()
+{
+    if (running_)
+        return false;
+    running_ = true;
+    for (std::size_t i = 0; i < workers_.size(); ++i)
+        workers_[i]->thread = std::thread([this, i] { run(i); });
+    return true;
+}
+
+void RoomScheduler::stop()
+{
+    if (!running_)
+        return;
+    running_ = false;
+    for (auto& worker : workers_) {
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+        }
+        worker->wake.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+}
+
+bool RoomScheduler::isRunning() const
+{
+    return running_;
+}
+
+std::size_t RoomScheduler::workerCount() const
+{
+    return workers_.size();
+}
+
+bool RoomScheduler::add(std::uint32_t roomId, MpscQueue<ReceivedInput>& inputs, TickCallback tick, double tickRateHz)
+{
+    auto room    = std::make_shared<Room>();
+    room->id     = roomId;
+    room->inputs = &inputs;
+    room->tick   = std::move(tick);
+    room->period = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / tickRateHz));
+    {
+        std::lock_guard<std::mutex> lock(roomsMutex_);
+        if (!rooms_.emplace(roomId, room).second)
+            return false;
+    }
+    push(nextWorker_++ % workers_.size(), Entry{Clock::now(), std::move(room)});
+    return true;
+}
+
+bool RoomScheduler::remove(std::uint32_t roomId)
+{
+    std::shared_ptr<Room> room;
+    {
+        std::lock_guard<std::mutex> lock(roomsMutex_);
+        auto it = rooms_.find(roomId);
+        if (it == rooms_.end())
+            return false;
+        room = std::move(it->second);
+        rooms_.erase(it);
+    }
+    room->active = false;
+    std::lock_guard<std::mutex> inFlight(room->runMutex);
+    return true;
+}
+
+bool RoomScheduler::contains(std::uint32_t roomId) const
+{
+    std::lock_guard<std::mutex> lock(roomsMutex_);
+    return rooms_.contains(roomId);
+}
+
+std::size_t RoomScheduler::roomCount() const
+{
+    std::lock_guard<std::mutex> lock(roomsMutex_);
+    return rooms_.size();
+}
+
+std::optional<RoomTickMetrics> RoomScheduler::metrics(std::uint32_t roomId) const
+{
+    std::shared_ptr<Room> room;
+    {
+        std::lock_guard<std::mutex> lock(roomsMutex_);
+        auto it = rooms_.find(roomId);
+        if (it == rooms_.end())
+            return std::nullopt;
+        room = it->second;
+    }
+    std::lock_guard<std::mutex> lock(room->metricsMutex);
+    return room->metrics;
+}
+
+void RoomScheduler::run(std::size_t index)
+{
+    Worker& self = *workers_[index];
+    while (running_) {
+        auto now     = Clock::now();
+        bool backlog = false;
+        if (auto entry = popDue(self, now, backlog)) {
+            if (backlog && workers_.size() > 1)
+                workers_[(index + 1) % workers_.size()]->wake.notify_one();
+            execute(index, std::move(*entry), false);
+            continue;
+        }
+        if (auto entry = steal(index, now)) {
+            execute(index, std::move(*entry), true);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(self.mutex);
+        if (!running_)
+            break;
+        auto wakeAt = now + kIdleWait;
+        if (!self.heap.empty())
+            wakeAt = std::min(wakeAt, self.heap.front().deadline);
+        self.wake.wait_until(lock, wakeAt);
+    }
+}
+
+std::optional<RoomScheduler::Entry> RoomScheduler::popDue(Worker& worker, Clock::time_point now, bool& backlog)
+{
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.heap.empty() || worker.heap.front().deadline > now)
+        return std::nullopt;
+    std::pop_heap(worker.heap.begin(), worker.heap.end(), std::greater<>{});
+    Entry entry = std::move(worker.heap.back());
+    worker.heap.pop_back();
+    backlog = !worker.heap.empty() && worker.heap.front().deadline <= now;
+    return entry;
+}
+
+std::optional<RoomScheduler::Entry> RoomScheduler::steal(std::size_t thief, Clock::time_point now)
+{
+    for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+        Worker& victim = *workers_[(thief + offset) % workers_.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.heap.empty() || victim.heap.front().deadline > now)
+            continue;
+        std::pop_heap(victim.heap.begin(), victim.heap.end(), std::greater<>{});
+        Entry entry = std::move(victim.heap.back());
+        victim.heap.pop_back();
+        return entry;
+    }
+    return std::nullopt;
+}
+
+void RoomScheduler::push(std::size_t index, Entry entry)
+{
+    Worker& worker = *workers_[index];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.heap.push_back(std::move(entry));
+        std::push_heap(worker.heap.begin(), worker.heap.end(), std::greater<>{});
+    }
+    worker.wake.notify_one();
+}
+
+void RoomScheduler::execute(std::size_t index, Entry entry, bool stolen)
+{
+    Room& room = *entry.room;
+    Clock::time_point next;
+    {
+        std::lock_guard<std::mutex> run(room.runMutex);
+        if (!room.active)
+            return;
+        const auto start = Clock::now();
+        room.batch.clear();
+        room.inputs->drainInto(room.batch);
+        room.tick(room.batch);
+        const auto end = Clock::now();
+
+        next         = entry.deadline + room.period;
+        bool overrun = next < end;
+        if (overrun)
+            next = end;
+
+        auto lateness = std::chrono::duration_cast<std::chrono::microseconds>(start - entry.deadline);
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        std::lock_guard<std::mutex> lock(room.metricsMutex);
+        auto& m = room.metrics;
+        m.ticks++;
+        if (lateness > lateThreshold_)
+            m.lateTicks++;
+        if (overrun)
+            m.overruns++;
+        if (stolen)
+            m.stolenTicks++;
+        m.totalLateness += lateness;
+
+        m.lastLateness     = lateness;
+        m.maxLateness      = std::max(m.maxLateness, lateness);
+        m.lastTickDuration = duration;
+        m.maxTickDuration  = std::max(m.maxTickDuration, duration);
+    }
+    push(index, Entry{next, std::move(entry.room)});
+}
@@ -2,6 +2,7 @@
 
 #include "components/TransformComponent.hpp"
 #include "components/VelocityComponent.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -49,6 +50,7 @@ bool IntroCinematic::active() const
 
 void IntroCinematic::update(Registry& registry, const std::map<std::uint32_t, EntityId>& players, float deltaTime)
 {
+    PROFILE_ZONE("level.intro");
     if (!active_) {
         return;
     }
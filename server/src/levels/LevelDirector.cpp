@@ -6,6 +6,7 @@
 #include "components/TagComponent.hpp"
 #include "components/TransformComponent.hpp"
 #include "network/InputPacket.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <cmath>
 #include <utility>
@@ -25,6 +26,7 @@ void LevelDirector::reset()
     bossStates_.clear();
     checkpoints_.clear();
     activePlayerBounds_.reset();
+    activeCameraBounds_.reset();
     readyPlayers_.clear();
     readyInputHeld_.clear();
     finished_ = data_.segments.empty();
@@ -40,17 +42,19 @@ void LevelDirector::enterSegment(std::size_t index)
     segmentDistance_ = 0.0F;
     activeScroll_    = data_.segments[index].scroll;
     activePlayerBounds_.reset();
+    if (data_.segments[index].cameraBounds.has_value())
+        activeCameraBounds_ = data_.segments[index].cameraBounds;
     readyPlayers_.clear();
     readyInputHeld_.clear();
     segmentEvents_ = makeEventRuntime(data_.segments[index].events);
 }
 
-void LevelDirector::registerSpawn(const std::string& spawnId, EntityId entityId)
+void LevelDirector::registerSpawn(const std::string& spawnId, Entity entity)
 {
     if (!spawnId.empty()) {
         auto& group   = spawnEntities_[spawnId];
         group.spawned = true;
-        group.entities.insert(entityId);
+        group.entities.push_back(entity);
     }
 }
 
@@ -59,12 +63,12 @@ void LevelDirector::unregisterSpawn(const std::string& spawnId)
     spawnEntities_.erase(spawnId);
 }
 
-void LevelDirector::registerBoss(const std::string& bossId, EntityId entityId)
+void LevelDirector::registerBoss(const std::string& bossId, Entity entity)
 {
     if (bossId.empty())
         return;
     auto& state        = bossStates_[bossId];
-    state.entityId     = entityId;
+    state.entity       = entity;
     state.registered   = true;
     state.dead         = false;
     state.onDeathFired = false;
@@ -133,6 +137,27 @@ const std::optional<CameraBounds>& LevelDirector::playerBounds() const
     return activePlayerBounds_;
 }
 
+const std::optional<CameraBounds>& LevelDirector::cameraBounds() const
+{
+    return activeCameraBounds_;
+}
+
+std::vector<Entity> LevelDirector::activeBosses() const
+{
+    std::vector<Entity> bosses;
+    activeBosses(bosses);
+    return bosses;
+}
+
+void LevelDirector::activeBosses(std::vector<Entity>& out) const
+{
+    out.clear();
+    for (const auto& [bossId, state] : bossStates_) {
+        if (state.registered && !state.dead)
+            out.push_back(state.entity);
+    }
+}
+
 float LevelDirector::currentScrollSpeed() const
 {
     if (activeScroll_.mode == ScrollMode::Stopped)
@@ -153,6 +178,7 @@ float LevelDirector::currentScrollSpeed() const
 
 void LevelDirector::update(Registry& registry, float deltaTime)
 {
+    PROFILE_ZONE("level.director");
     if (finished_ || data_.segments.empty())
         return;
 
@@ -195,9 +221,9 @@ bool LevelDirector::isSpawnDead(const std::string& spawnId, Registry& registry)
     for (const auto& entity : group.entities) {
         if (!registry.isAlive(entity))
             continue;
-        if (!registry.has<SpawnGroupComponent>(entity))
+        if (!registry.has<SpawnGroupComponent>(entity.index))
             continue;
-        const auto& marker = registry.get<SpawnGroupComponent>(entity);
+        const auto& marker = registry.get<SpawnGroupComponent>(entity.index);
         if (marker.spawnId != spawnId)
             continue;
         return false;
@@ -212,7 +238,7 @@ bool LevelDirector::isBossDead(const std::string& bossId, Registry& registry) co
         return false;
     if (!it->second.registered)
         return false;
-    return !registry.isAlive(it->second.entityId);
+    return !registry.isAlive(it->second.entity);
 }
 
 bool LevelDirector::isBossHpBelow(const std::string& bossId, std::int32_t value, Registry& registry) const
@@ -222,25 +248,17 @@ bool LevelDirector::isBossHpBelow(const std::string& bossId, std::int32_t value,
         return false;
     if (!it->second.registered)
         return false;
-    if (!registry.isAlive(it->second.entityId))
+    if (!registry.isAlive(it->second.entity))
         return false;
-    if (!registry.has<HealthComponent>(it->second.entityId))
+    if (!registry.has<HealthComponent>(it->second.entity.index))
         return false;
-    const auto& h = registry.get<HealthComponent>(it->second.entityId);
+    const auto& h = registry.get<HealthComponent>(it->second.entity.index);
     return h.current <= value;
 }
 
 std::int32_t LevelDirector::countEnemies(Registry& registry) const
 {
-    std::int32_t count = 0;
-    for (EntityId id : registry.view<TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        const auto& tag = registry.get<TagComponent>(id);
-        if (tag.hasTag(EntityTag::Enemy))
-            count++;
-    }
-    return count;
+    return static_cast<std::int32_t>(registry.tagged(EntityTag::Enemy).size());
 }
 
 bool LevelDirector::isPlayerInZone(const Trigger& trigger, Registry& registry) const
@@ -250,12 +268,7 @@ bool LevelDirector::isPlayerInZone(const Trigger& trigger, Registry& registry) c
     const auto& bounds   = *trigger.zone;
     std::int32_t players = 0;
     std::int32_t inside  = 0;
-    for (EntityId id : registry.view<TransformComponent, TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        const auto& tag = registry.get<TagComponent>(id);
-        if (!tag.hasTag(EntityTag::Player))
-            continue;
+    for (EntityId id : registry.viewTagged<TransformComponent>(EntityTag::Player)) {
         if (registry.has<RespawnTimerComponent>(id))
             continue;
         players++;
@@ -274,12 +287,7 @@ bool LevelDirector::arePlayersReady(Registry& registry) const
 {
     std::int32_t players = 0;
     std::int32_t ready   = 0;
-    for (EntityId id : registry.view<TransformComponent, TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        const auto& tag = registry.get<TagComponent>(id);
-        if (!tag.hasTag(EntityTag::Player))
-            continue;
+    for (EntityId id : registry.viewTagged<TransformComponent>(EntityTag::Player)) {
         if (registry.has<RespawnTimerComponent>(id))
             continue;
         players++;
@@ -364,6 +372,8 @@ void LevelDirector::applyEventEffects(const LevelEvent& event)
         }
     } else if (event.type == EventType::Checkpoint && event.checkpoint) {
         checkpoints_.insert(event.checkpoint->checkpointId);
+    } else if (event.type == EventType::SetCameraBounds && event.cameraBounds) {
+        activeCameraBounds_ = *event.cameraBounds;
     } else if (event.type == EventType::SetPlayerBounds && event.playerBounds) {
         activePlayerBounds_ = *event.playerBounds;
     } else if (event.type == EventType::ClearPlayerBounds) {
@@ -447,7 +457,7 @@ void LevelDirector::updateBossEvents(Registry& registry)
     for (auto& [bossId, state] : bossStates_) {
         if (!state.registered)
             continue;
-        bool alive = registry.isAlive(state.entityId);
+        bool alive = registry.isAlive(state.entity);
         if (!alive && !state.onDeathFired) {
             state.dead         = true;
             state.onDeathFired = true;
@@ -1,5 +1,6 @@
 #include "levels/LevelLoader.hpp"
 
+#include "components/CollisionLayer.hpp"
 #include "components/HitboxComponent.hpp"
 #include "components/MovementComponent.hpp"
 #include "components/ScoreComponent.hpp"
@@ -12,6 +13,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -285,6 +287,10 @@ namespace
                 setError(error, LevelLoadErrorCode::SchemaError, "Polygon needs at least 3 points", "", path);
                 return false;
             }
+            if (pts.size() > ColliderComponent::kMaxPoints) {
+                setError(error, LevelLoadErrorCode::SchemaError, "Polygon has too many points", "", path);
+                return false;
+            }
             std::vector<std::array<float, 2>> points;
             points.reserve(pts.size());
             for (std::size_t i = 0; i < pts.size(); ++i) {
@@ -301,6 +307,76 @@ namespace
         return false;
     }
 
+    std::optional<std::uint32_t> collisionLayerFromName(const std::string& name)
+    {
+        static const std::unordered_map<std::string, std::uint32_t> layers = {
+            {"player", CollisionLayer::Player},
+            {"enemy", CollisionLayer::Enemy},
+            {"playerProjectile", CollisionLayer::PlayerProjectile},
+            {"enemyProjectile", CollisionLayer::EnemyProjectile},
+            {"obstacle", CollisionLayer::Obstacle},
+            {"pickup", CollisionLayer::Pickup},
+            {"background", CollisionLayer::Background},
+            {"neutral", CollisionLayer::Neutral},
+            {"all", CollisionLayer::All},
+        };
+        const auto it = layers.find(name);
+        if (it == layers.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    bool readCollisionLayers(const Json& obj, const std::string& key, std::uint32_t& out, const std::string& path,
+                             LevelLoadError& error)
+    {
+        if (!obj.contains(key))
+            return true;
+        Json list = obj[key];
+        if (!list.isArray()) {
+            setError(error, LevelLoadErrorCode::SchemaError, "Expected array: " + key, "", joinPath(path, key));
+            return false;
+        }
+        std::uint32_t layers = CollisionLayer::None;
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            Json item = list[i];
+            std::optional<std::uint32_t> layer;
+            if (item.isString())
+                layer = collisionLayerFromName(item.get<std::string>());
+            if (!layer.has_value()) {
+                setError(error, LevelLoadErrorCode::SchemaError, "Unknown collision layer", "",
+                         joinPath(joinPath(path, key), std::to_string(i)));
+                return false;
+            }
+            layers |= *layer;
+        }
+        out = layers;
+        return true;
+    }
+
+    bool parseCollisionFilter(const Json& j, HitboxComponent& hitbox, ColliderComponent& collider,
+                              const std::string& path, LevelLoadError& error)
+    {
+        std::uint32_t layer = CollisionLayer::None;
+        std::uint32_t mask  = CollisionLayer::All;
+        if (!readCollisionLayers(j, "collisionLayer", layer, path, error))
+            return false;
+        if (!readCollisionLayers(j, "collidesWith", mask, path, error))
+            return false;
+        if (layer == CollisionLayer::None) {
+            if (j.contains("collidesWith")) {
+                setError(error, LevelLoadErrorCode::SchemaError, "collidesWith requires collisionLayer", "",
+                         joinPath(path, "collidesWith"));
+                return false;
+            }
+            return true;
+        }
+        hitbox.collisionLayer   = layer;
+        hitbox.collisionMask    = mask;
+        collider.collisionLayer = layer;
+        collider.collisionMask  = mask;
+        return true;
+    }
+
     bool parseShooting(const Json& j, EnemyShootingComponent& out, const std::string& path, LevelLoadError& error)
     {
         if (!j.isObject()) {
@@ -969,6 +1045,7 @@ namespace
                         else
                             setError(error, LevelLoadErrorCode::SchemaError, "Unknown collider: " + colKey, "", path);
                     }
+                    parseCollisionFilter(e, et.hitbox, et.collider, joinPath(path, "enemies/" + key), error);
                     readInt(e, "health", et.health, path, error, false);
                     readInt(e, "score", et.score, path, error, false);
 
@@ -1014,6 +1091,8 @@ namespace
                             setError(error, LevelLoadErrorCode::SchemaError, "Unknown collider: " + colKey, "", path);
                     }
 
+                    parseCollisionFilter(o, ot.hitbox, ot.collider, joinPath(path, "obstacles/" + key), error);
+
                     readInt(o, "health", ot.health, path, error, false);
 
                     std::string anchorStr;
@@ -5,6 +5,7 @@
 #include "components/SpawnGroupComponent.hpp"
 #include "components/TagComponent.hpp"
 #include "components/VelocityComponent.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -26,6 +27,7 @@ void LevelSpawnSystem::reset()
 
 void LevelSpawnSystem::update(Registry& registry, float deltaTime, const std::vector<DispatchedEvent>& events)
 {
+    PROFILE_ZONE("level.spawn");
     time_ += deltaTime;
     spawnPending(registry);
     dispatchEvents(registry, events);
@@ -192,7 +194,7 @@ void LevelSpawnSystem::spawnEnemy(Registry& registry, const PendingEnemySpawn& s
         registry.emplace<SpawnGroupComponent>(e, SpawnGroupComponent::create(spawn.spawnGroupId));
     }
     if (director_ != nullptr && !spawn.spawnGroupId.empty()) {
-        director_->registerSpawn(spawn.spawnGroupId, e);
+        director_->registerSpawn(spawn.spawnGroupId, registry.handle(e));
     }
 }
 
@@ -247,7 +249,7 @@ void LevelSpawnSystem::spawnObstacle(Registry& registry, const SpawnObstacleSett
         registry.emplace<SpawnGroupComponent>(e, SpawnGroupComponent::create(spawnId));
     }
     if (director_ != nullptr && !spawnId.empty()) {
-        director_->registerSpawn(spawnId, e);
+        director_->registerSpawn(spawnId, registry.handle(e));
     }
 }
 
@@ -287,9 +289,9 @@ void LevelSpawnSystem::spawnBoss(Registry& registry, const SpawnBossSettings& se
         registry.emplace<SpawnGroupComponent>(e, SpawnGroupComponent::create(settings.spawnId));
     }
     if (director_ != nullptr) {
-        director_->registerBoss(settings.bossId, e);
+        director_->registerBoss(settings.bossId, registry.handle(e));
         if (!settings.spawnId.empty()) {
-            director_->registerSpawn(settings.spawnId, e);
+            director_->registerSpawn(settings.spawnId, registry.handle(e));
         }
     }
 }
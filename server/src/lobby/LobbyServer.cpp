@@ -73,9 +73,9 @@ namespace
 } // namespace
 
 LobbyServer::LobbyServer(std::uint16_t lobbyPort, std::uint16_t gameBasePort, std::uint32_t maxInstances,
-                         std::atomic<bool>& runningFlag)
+                         std::atomic<bool>& runningFlag, GamePortMode gamePortMode)
     : lobbyPort_(lobbyPort), gameBasePort_(gameBasePort), maxInstances_(maxInstances), running_(&runningFlag),
-      instanceManager_(gameBasePort, maxInstances, runningFlag)
+      instanceManager_(gameBasePort, maxInstances, runningFlag, gamePortMode)
 {
     Logger::instance().info("[LobbyServer] Initialized on port " + std::to_string(lobbyPort) + " with game base port " +
                             std::to_string(gameBasePort));
@@ -120,6 +120,19 @@ bool LobbyServer::start()
 
     lobbySocket_.setNonBlocking(true);
 
+    auto onDatagram = [this](const std::uint8_t* data, std::size_t size, const IpEndpoint& from) {
+        if (size == 0)
+            return;
+        Logger::instance().addPacketReceived();
+        Logger::instance().addBytesReceived(size);
+        handlePacket(data, size, from);
+    };
+    if (!lobbyReactor_.open() || !lobbyReactor_.watch(lobbySocket_, onDatagram)) {
+        Logger::instance().error("[LobbyServer] Failed to set up the lobby socket reactor");
+        lobbySocket_.close();
+        return false;
+    }
+
     Logger::instance().info("[LobbyServer] Lobby socket opened on port " + std::to_string(lobbyPort_));
 
     receiveRunning_ = true;
@@ -256,10 +269,12 @@ void LobbyServer::stop()
     instanceManager_.stopAll("Server disconnected");
 
     receiveRunning_ = false;
+    lobbyReactor_.wake();
 
     if (receiveWorker_.joinable()) {
         receiveWorker_.join();
     }
+    lobbyReactor_.close();
 
     if (cleanupWorker_.joinable()) {
         cleanupWorker_.join();
@@ -338,21 +353,8 @@ void LobbyServer::receiveThread()
 {
     Logger::instance().info("[LobbyServer] Receive thread started");
 
-    std::array<std::uint8_t, 2048> buffer{};
-
     while (receiveRunning_) {
-        IpEndpoint from{};
-        auto result = lobbySocket_.recvFrom(buffer.data(), buffer.size(), from);
-
-        if (!result.ok() || result.size == 0) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            continue;
-        }
-
-        Logger::instance().addPacketReceived();
-        Logger::instance().addBytesReceived(result.size);
-
-        handlePacket(buffer.data(), result.size, from);
+        lobbyReactor_.poll(UdpReactor::kInfinite);
     }
 
     Logger::instance().info("[LobbyServer] Receive thread stopped");
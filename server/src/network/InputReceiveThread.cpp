@@ -2,8 +2,8 @@
 
 #include "Logger.hpp"
 #include "core/Session.hpp"
+#include "network/SharedGamePort.hpp"
 
-#include <array>
 #include <chrono>
 #include <sstream>
 #include <string>
@@ -12,8 +12,6 @@
 
 namespace
 {
-    constexpr std::chrono::milliseconds kPollDelay(1);
-
     std::string parseStatusToString(InputParseStatus status)
     {
         switch (status) {
@@ -38,8 +36,8 @@ namespace
     }
 } // namespace
 
-InputReceiveThread::InputReceiveThread(const IpEndpoint& bindTo, ThreadSafeQueue<ReceivedInput>& outQueue,
-                                       ThreadSafeQueue<ControlEvent>& controlQueue,
+InputReceiveThread::InputReceiveThread(const IpEndpoint& bindTo, MpscQueue<ReceivedInput>& outQueue,
+                                       MpscQueue<ControlEvent>& controlQueue,
                                        ThreadSafeQueue<ClientTimeoutEvent>* timeoutQueue,
                                        std::chrono::milliseconds timeout)
     : bind_(bindTo), ownedControlQueue_(nullptr), queue_(outQueue), controlQueue_(controlQueue),
@@ -53,10 +51,10 @@ InputReceiveThread::~InputReceiveThread()
     stop();
 }
 
-InputReceiveThread::InputReceiveThread(const IpEndpoint& bindTo, ThreadSafeQueue<ReceivedInput>& outQueue,
+InputReceiveThread::InputReceiveThread(const IpEndpoint& bindTo, MpscQueue<ReceivedInput>& outQueue,
                                        ThreadSafeQueue<ClientTimeoutEvent>* timeoutQueue,
                                        std::chrono::milliseconds timeout)
-    : bind_(bindTo), ownedControlQueue_(std::make_unique<ThreadSafeQueue<ControlEvent>>()), queue_(outQueue),
+    : bind_(bindTo), ownedControlQueue_(std::make_unique<MpscQueue<ControlEvent>>()), queue_(outQueue),
       controlQueue_(*ownedControlQueue_), timeoutQueue_(timeoutQueue), timeout_(timeout)
 {
     lastTimeoutCheck_ = std::chrono::steady_clock::now();
@@ -68,19 +66,46 @@ bool InputReceiveThread::start()
         return false;
     if (!socket_.open(bind_))
         return false;
+    auto handler = [this](const std::uint8_t* data, std::size_t size, const IpEndpoint& src) {
+        processIncomingPacket(data, size, src);
+    };
+    if (!reactor_.open() || !reactor_.watch(socket_, handler)) {
+        reactor_.close();
+        socket_.close();
+        return false;
+    }
     lastTimeoutCheck_ = std::chrono::steady_clock::now();
     running_          = true;
     worker_           = std::thread([this] { run(); });
     return true;
 }
 
+bool InputReceiveThread::start(SharedGamePort& port, std::uint32_t roomId)
+{
+    if (running_)
+        return false;
+    lastTimeoutCheck_ = std::chrono::steady_clock::now();
+    shared_           = &port;
+    sharedRoomId_     = roomId;
+    running_          = true;
+    port.attach(roomId, *this);
+    return true;
+}
+
 void InputReceiveThread::stop()
 {
     if (!running_)
         return;
     running_ = false;
+    if (shared_ != nullptr) {
+        shared_->detach(sharedRoomId_);
+        shared_ = nullptr;
+        return;
+    }
+    reactor_.wake();
     if (worker_.joinable())
         worker_.join();
+    reactor_.close();
     socket_.close();
 }
 
@@ -91,6 +116,8 @@ bool InputReceiveThread::isRunning() const
 
 IpEndpoint InputReceiveThread::endpoint() const
 {
+    if (shared_ != nullptr)
+        return shared_->endpoint();
     return socket_.localEndpoint();
 }
 
@@ -112,30 +139,26 @@ std::optional<ClientState> InputReceiveThread::clientState(const IpEndpoint& ep)
 
 void InputReceiveThread::run()
 {
-    std::array<std::uint8_t, 1024> buf{};
     while (running_) {
-        auto now = std::chrono::steady_clock::now();
-        if (timeoutQueue_ && now - lastTimeoutCheck_ >= timeout_) {
-            checkTimeouts(now);
-            lastTimeoutCheck_ = now;
-        }
-
-        IpEndpoint src{};
-        auto r = socket_.recvFrom(buf.data(), buf.size(), src);
-        if (!r.ok()) {
-            if (r.error == UdpError::WouldBlock) {
-                std::this_thread::sleep_for(kPollDelay);
-                continue;
-            }
-            if (r.error == UdpError::Interrupted)
-                continue;
-
-            Logger::instance().warn("[Input] recvFrom failed: error=" + std::to_string(static_cast<int>(r.error)));
-            continue;
-        }
+        auto wait = UdpReactor::kInfinite;
+        if (timeoutQueue_)
+            wait = pollTimeouts(std::chrono::steady_clock::now());
+        reactor_.poll(wait);
+    }
+}
 
-        processIncomingPacket(buf.data(), r.size, src);
+std::chrono::milliseconds InputReceiveThread::pollTimeouts(std::chrono::steady_clock::time_point now)
+{
+    if (now - lastTimeoutCheck_ >= timeout_) {
+        checkTimeouts(now);
+        lastTimeoutCheck_ = now;
     }
+    return std::chrono::ceil<std::chrono::milliseconds>(lastTimeoutCheck_ + timeout_ - now);
+}
+
+void InputReceiveThread::deliver(const std::uint8_t* data, std::size_t size, const IpEndpoint& src)
+{
+    processIncomingPacket(data, size, src);
 }
 
 void InputReceiveThread::processIncomingPacket(const std::uint8_t* data, std::size_t size, const IpEndpoint& src)
@@ -204,7 +227,10 @@ void InputReceiveThread::handleInputPacket(const PacketHeader& hdr, const std::u
         state.lastPacketTime = std::chrono::steady_clock::now();
         lastAccepted_        = key;
     }
-    queue_.push(ReceivedInput{*parsed.input, src});
+    if (!queue_.push(ReceivedInput{*parsed.input, src})) {
+        Logger::instance().addPacketDropped();
+        Logger::instance().warn("[Input] input_drop status=queue_full from=" + endpointKey(src));
+    }
 }
 
 void InputReceiveThread::handleControlPacket(const PacketHeader& hdr, const std::uint8_t* data, std::size_t size,
@@ -231,11 +257,15 @@ void InputReceiveThread::handleControlPacket(const PacketHeader& hdr, const std:
         hdr.messageType == static_cast<std::uint8_t>(MessageType::ClientJoinRequest) ||
         hdr.messageType == static_cast<std::uint8_t>(MessageType::ClientReady) ||
         hdr.messageType == static_cast<std::uint8_t>(MessageType::ClientPing) ||
+        hdr.messageType == static_cast<std::uint8_t>(MessageType::ClientAcknowledge) ||
         hdr.messageType == static_cast<std::uint8_t>(MessageType::RoomForceStart) ||
         hdr.messageType == static_cast<std::uint8_t>(MessageType::RoomSetPlayerCount) ||
         hdr.messageType == static_cast<std::uint8_t>(MessageType::ClientDisconnect)) {
         std::vector<std::uint8_t> packetData(data, data + size);
-        controlQueue_.push(ControlEvent{hdr, src, packetData});
+        if (!controlQueue_.push(ControlEvent{hdr, src, std::move(packetData)})) {
+            Logger::instance().addPacketDropped();
+            Logger::instance().warn("[Input] input_drop status=control_queue_full from=" + endpointKey(src));
+        }
     } else {
         Logger::instance().addPacketDropped();
         Logger::instance().warn("[Input] input_drop status=decode_failed from=" + endpointKey(src));
@@ -60,6 +60,13 @@ namespace
         return ss.str();
     }
 
+    std::string formatMs(std::chrono::nanoseconds value)
+    {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(2) << static_cast<double>(value.count()) / 1e6 << "ms";
+        return ss.str();
+    }
+
     std::string formatBytes(size_t bytes)
     {
         if (bytes < 1024)
@@ -139,6 +146,19 @@ void NetworkTui::processCommand(const std::string& cmd)
     addAdminLog("> " + cmd);
     if (cmd == "/ping") {
         addAdminLog("[Pong] Server is alive!");
+    } else if (cmd == "/profile") {
+        if (_zones.empty())
+            addAdminLog("[Profile] No samples yet");
+        for (const auto& zone : _zones) {
+            addAdminLog("[Profile] " + std::string(zone.name) + " p50 " + formatMs(zone.p50) + " p99 " +
+                        formatMs(zone.p99) + " max " + formatMs(zone.max));
+        }
+    } else if (cmd == "/trace") {
+        std::string path = _traceHandler ? _traceHandler() : "";
+        if (path.empty())
+            addAdminLog("[Admin] Error: Could not write trace");
+        else
+            addAdminLog("[Profile] Chrome trace written to " + path);
     } else {
         addAdminLog("[Admin] Error: Unknown command: " + cmd);
     }
@@ -238,7 +258,14 @@ void NetworkTui::drawStats(std::ostringstream& frame)
           << formatBytes(_currentStats.bytesOut) << BOLD << FG_CYAN << " PACKETS: " << RESET << std::setw(8)
           << std::left << _currentStats.packetsOut << " | " << BOLD << FG_RED << "LOSS: " << RESET
           << _currentStats.packetsLost << clr() << "\n";
-    frame << pos(4, 1) << clr() << "\n";
+    frame << pos(4, 1);
+    for (const auto& zone : _zones) {
+        if (std::string(zone.name) != "tick")
+            continue;
+        frame << "  " << BOLD << FG_YELLOW << "TICK: " << RESET << "p50 " << formatMs(zone.p50) << "  p99 "
+              << formatMs(zone.p99) << "  max " << formatMs(zone.max) << DIM << "  (/profile for zones)" << RESET;
+    }
+    frame << clr() << "\n";
 }
 
 void NetworkTui::drawGraph(std::ostringstream& frame)
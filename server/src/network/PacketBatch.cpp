@@ -0,0 +1,70 @@
+#include "network/PacketBatch.hpp"
+
+#include "Logger.hpp"
+#include "core/Session.hpp"
+
+#include <string>
+
+void PacketBatch::append(std::span<const std::uint8_t> payload, const IpEndpoint& dst)
+{
+    entries_.push_back(Entry{bytes_.size(), payload.size(), dst});
+    bytes_.insert(bytes_.end(), payload.begin(), payload.end());
+}
+
+void PacketBatch::appendAll(const PacketBatch& other)
+{
+    const std::size_t base = bytes_.size();
+    bytes_.insert(bytes_.end(), other.bytes_.begin(), other.bytes_.end());
+    for (const auto& entry : other.entries_)
+        entries_.push_back(Entry{base + entry.offset, entry.size, entry.dst});
+}
+
+void PacketBatch::clear()
+{
+    bytes_.clear();
+    entries_.clear();
+}
+
+bool PacketBatch::empty() const
+{
+    return entries_.empty();
+}
+
+std::size_t PacketBatch::size() const
+{
+    return entries_.size();
+}
+
+std::size_t PacketBatch::send(UdpSocket& socket, int roomId)
+{
+    if (entries_.empty())
+        return 0;
+    datagrams_.clear();
+    for (const auto& entry : entries_)
+        datagrams_.push_back(UdpDatagram{bytes_.data() + entry.offset, entry.size, entry.dst});
+
+    std::span<const UdpDatagram> rest(datagrams_);
+    std::size_t sentPackets = 0;
+    std::size_t sentBytes   = 0;
+    while (!rest.empty()) {
+        auto res = socket.sendBatch(rest);
+        for (std::size_t i = 0; i < res.size; ++i)
+            sentBytes += rest[i].size;
+        sentPackets += res.size;
+        rest = rest.subspan(res.size);
+        if (!res.ok()) {
+            Logger::instance().warn("[Packets] Failed to send to " + endpointKey(rest.front().dst) +
+                                    " error=" + std::to_string(static_cast<int>(res.error)));
+            rest = rest.subspan(1);
+        }
+    }
+    clear();
+    if (sentPackets == 0)
+        return 0;
+
+    Logger::instance().addBytesSent(sentBytes);
+    for (std::size_t i = 0; i < sentPackets; ++i)
+        Logger::instance().addPacketSent();
+    LOG_ROOM(LogLevel::Debug, roomId, "[Packets]", "Sent ", sentPackets, " packets (", sentBytes, " bytes)");
+    return sentPackets;
+}
@@ -0,0 +1,40 @@
+#include "network/SendBufferRing.hpp"
+
+#include <algorithm>
+
+SendBufferRing::SendBufferRing(std::size_t slots) : buffers_(std::max<std::size_t>(slots, 1))
+{
+    for (auto& buffer : buffers_)
+        buffer.reserve(kBufferCapacity);
+}
+
+void SendBufferRing::begin()
+{
+    first_ = end_;
+}
+
+std::vector<std::uint8_t>& SendBufferRing::acquire()
+{
+    if (end_ == buffers_.size()) {
+        if (first_ > 0) {
+            std::rotate(buffers_.begin(), buffers_.begin() + static_cast<std::ptrdiff_t>(first_), buffers_.end());
+            end_ -= first_;
+            first_ = 0;
+        } else {
+            buffers_.emplace_back().reserve(kBufferCapacity);
+        }
+    }
+    auto& buffer = buffers_[end_++];
+    buffer.clear();
+    return buffer;
+}
+
+std::span<std::vector<std::uint8_t>> SendBufferRing::batch()
+{
+    return {buffers_.data() + first_, end_ - first_};
+}
+
+std::size_t SendBufferRing::slots() const
+{
+    return buffers_.size();
+}
@@ -2,9 +2,11 @@
 
 #include "Logger.hpp"
 #include "core/Session.hpp"
+#include "network/SharedGamePort.hpp"
 
 #include <chrono>
 #include <thread>
+#include <utility>
 
 SendThread::SendThread(const IpEndpoint& bindTo, std::vector<IpEndpoint> clients, double hz, int roomId)
     : bind_(bindTo), clients_(std::move(clients)), hz_(hz), roomId_(roomId)
@@ -26,11 +28,31 @@ bool SendThread::start()
     return true;
 }
 
+bool SendThread::start(SharedGamePort& port)
+{
+    if (running_)
+        return false;
+    shared_  = &port;
+    running_ = true;
+    return true;
+}
+
 void SendThread::stop()
 {
     if (!running_)
         return;
-    running_ = false;
+    if (shared_ != nullptr) {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        shared_->submit(pending_);
+        running_ = false;
+        shared_  = nullptr;
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        running_ = false;
+    }
+    wake_.notify_one();
     if (worker_.joinable())
         worker_.join();
     socket_.close();
@@ -59,92 +81,55 @@ void SendThread::publish(const std::vector<std::uint8_t>& payload)
     latest_ = payload;
 }
 
-void SendThread::sendTo(const std::vector<std::uint8_t>& payload, const IpEndpoint& dst)
+void SendThread::sendTo(std::span<const std::uint8_t> payload, const IpEndpoint& dst)
 {
     if (!running_)
         return;
-    auto res = socket_.sendTo(payload.data(), payload.size(), dst);
-    if (!res.ok()) {
-        Logger::instance().warn("[Packets] Failed to send to " + endpointKey(dst) +
-                                " error=" + std::to_string(static_cast<int>(res.error)));
-        return;
-    }
-    Logger::instance().addBytesSent(payload.size());
-    Logger::instance().addPacketSent();
-    Logger::instance().logToRoom(roomId_, "INFO",
-                                 "[Packets] Sent " + std::to_string(payload.size()) + " bytes to " + endpointKey(dst));
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    pending_.append(payload, dst);
 }
 
-void SendThread::broadcast(const PlayerDisconnectedPacket& packet)
+void SendThread::flush()
 {
-    auto payload = packet.encode();
-    if (!running_)
-        return;
-    std::vector<IpEndpoint> clients;
     {
-        std::lock_guard<std::mutex> lock(clientsMutex_);
-        clients = clients_;
-    }
-    for (const auto& c : clients) {
-        auto res = socket_.sendTo(payload.data(), payload.size(), c);
-        if (!res.ok()) {
-            Logger::instance().warn("[Packets] Failed to broadcast to " + endpointKey(c) +
-                                    " error=" + std::to_string(static_cast<int>(res.error)));
-            continue;
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        if (pending_.empty())
+            return;
+        if (shared_ != nullptr) {
+            shared_->submit(pending_);
+            return;
         }
-        Logger::instance().addBytesSent(payload.size());
-        Logger::instance().addPacketSent();
-        Logger::instance().logToRoom(
-            roomId_, "INFO", "[Packets] Broadcasted " + std::to_string(payload.size()) + " bytes to " + endpointKey(c));
+        flushRequested_ = true;
     }
+    wake_.notify_one();
 }
 
-void SendThread::broadcast(const EntitySpawnPacket& packet)
+void SendThread::broadcastPayload(std::span<const std::uint8_t> payload)
 {
-    auto payload = packet.encode();
     if (!running_)
         return;
-    std::vector<IpEndpoint> clients;
-    {
-        std::lock_guard<std::mutex> lock(clientsMutex_);
-        clients = clients_;
-    }
-    for (const auto& c : clients) {
-        auto res = socket_.sendTo(payload.data(), payload.size(), c);
-        if (!res.ok()) {
-            Logger::instance().warn("[Packets] Failed to broadcast to " + endpointKey(c) +
-                                    " error=" + std::to_string(static_cast<int>(res.error)));
-            continue;
-        }
-        Logger::instance().addBytesSent(payload.size());
-        Logger::instance().addPacketSent();
-        Logger::instance().logToRoom(
-            roomId_, "INFO", "[Packets] Broadcasted " + std::to_string(payload.size()) + " bytes to " + endpointKey(c));
-    }
+    std::lock_guard<std::mutex> clientsLock(clientsMutex_);
+    std::lock_guard<std::mutex> lock(queueMutex_);
+    for (const auto& c : clients_)
+        pending_.append(payload, c);
+}
+
+void SendThread::broadcast(const PlayerDisconnectedPacket& packet)
+{
+    auto payload = packet.encode();
+    broadcastPayload(payload);
+}
+
+void SendThread::broadcast(const EntitySpawnPacket& packet)
+{
+    auto payload = packet.encode();
+    broadcastPayload(payload);
 }
 
 void SendThread::broadcast(const EntityDestroyedPacket& packet)
 {
     auto payload = packet.encode();
-    if (!running_)
-        return;
-    std::vector<IpEndpoint> clients;
-    {
-        std::lock_guard<std::mutex> lock(clientsMutex_);
-        clients = clients_;
-    }
-    for (const auto& c : clients) {
-        auto res = socket_.sendTo(payload.data(), payload.size(), c);
-        if (!res.ok()) {
-            Logger::instance().warn("[Packets] Failed to broadcast to " + endpointKey(c) +
-                                    " error=" + std::to_string(static_cast<int>(res.error)));
-            continue;
-        }
-        Logger::instance().addBytesSent(payload.size());
-        Logger::instance().addPacketSent();
-        Logger::instance().logToRoom(
-            roomId_, "INFO", "[Packets] Broadcasted " + std::to_string(payload.size()) + " bytes to " + endpointKey(c));
-    }
+    broadcastPayload(payload);
 }
 
 void SendThread::clearLatest()
@@ -155,43 +140,58 @@ void SendThread::clearLatest()
 
 IpEndpoint SendThread::endpoint() const
 {
+    if (shared_ != nullptr)
+        return shared_->endpoint();
     return socket_.localEndpoint();
 }
 
+void SendThread::sendLatest()
+{
+    std::vector<std::uint8_t> payload;
+    {
+        std::lock_guard<std::mutex> lock(payloadMutex_);
+        if (latest_.empty())
+            return;
+        payload = latest_;
+    }
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex_);
+        for (const auto& c : clients_)
+            outgoing_.append(payload, c);
+    }
+    outgoing_.send(socket_, roomId_);
+}
+
 void SendThread::run()
 {
     using namespace std::chrono;
-    auto interval = duration<double>(1.0 / hz_);
-    auto next     = steady_clock::now() + interval;
+    auto interval       = duration_cast<steady_clock::duration>(duration<double>(1.0 / hz_));
+    auto next           = steady_clock::now() + interval;
+    bool flushedInFrame = false;
     while (running_) {
-        std::vector<std::uint8_t> payload;
+        bool flushed = false;
         {
-            std::lock_guard<std::mutex> lock(payloadMutex_);
-            payload = latest_;
-        }
-        if (!payload.empty()) {
-            std::vector<IpEndpoint> clients;
-            {
-                std::lock_guard<std::mutex> lock(clientsMutex_);
-                clients = clients_;
-            }
-            for (const auto& c : clients) {
-                auto res = socket_.sendTo(payload.data(), payload.size(), c);
-                if (!res.ok()) {
-                    Logger::instance().warn("[Packets] Failed to send to " + endpointKey(c) +
-                                            " error=" + std::to_string(static_cast<int>(res.error)));
-                    continue;
-                }
-                Logger::instance().addBytesSent(payload.size());
-                Logger::instance().addPacketSent();
-                Logger::instance().logToRoom(roomId_, "INFO",
-                                             "[Packets] Sent " + std::to_string(payload.size()) + " bytes to " +
-                                                 endpointKey(c));
-            }
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            flushed         = wake_.wait_until(lock, next, [this] { return flushRequested_ || !running_; });
+            flushRequested_ = false;
+            if (flushed || !flushedInFrame)
+                std::swap(outgoing_, pending_);
         }
+        outgoing_.send(socket_, roomId_);
+        flushedInFrame = flushedInFrame || flushed;
+
         auto now = steady_clock::now();
-        if (now < next)
-            std::this_thread::sleep_until(next);
-        next += interval;
+        if (now >= next) {
+            sendLatest();
+            flushedInFrame = false;
+            next += interval;
+            if (next < now)
+                next = now + interval;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        std::swap(outgoing_, pending_);
     }
+    outgoing_.send(socket_, roomId_);
 }
@@ -26,6 +26,11 @@ void ServerApp::handleControlMessage(const ControlEvent& ctrl)
         }
     }
 
+    if (type == static_cast<std::uint8_t>(MessageType::ClientAcknowledge)) {
+        replicationManager_.acknowledge(key, ctrl.header.tickId);
+        return;
+    }
+
     auto& sess    = sessions_[key];
     sess.endpoint = ctrl.from;
     if (sess.playerId == 0) {
@@ -213,6 +218,7 @@ void ServerApp::onDisconnect(const IpEndpoint& endpoint)
     }
     std::erase_if(clients_, [&](const IpEndpoint& ep) { return endpointKey(ep) == endpointKey(endpoint); });
     sendThread_.setClients(clients_);
+    replicationManager_.removeClient(endpointKey(endpoint));
     if (sessions_.empty()) {
         Logger::instance().info("[Game] No more clients connected, resetting game");
         resetGame();
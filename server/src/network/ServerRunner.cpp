@@ -107,6 +107,10 @@ ServerApp::ServerApp(std::uint16_t port, std::atomic<bool>& runningFlag, bool en
 {
     if (interactive_) {
         tui_ = std::make_unique<NetworkTui>(showNetwork_, showAdmin_);
+        tui_->setTraceHandler([this]() -> std::string {
+            const std::string path = "logs/trace_server.json";
+            return profiler_.writeChromeTrace(path, 0, "Server") ? path : "";
+        });
         Logger::instance().setConsoleOutputEnabled(false);
         Logger::instance().setPostLogCallback([this](const std::string& msg) {
             if (tui_)
@@ -166,6 +170,7 @@ void ServerApp::run()
             stats.packetsLost = Logger::instance().getTotalPacketsDropped();
 
             tui_->setClientCount(clients_.size());
+            tui_->setTickProfile(profiler_.stats());
             tui_->update(stats);
             tui_->render();
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
@@ -192,6 +197,7 @@ void ServerApp::resetGame()
     clients_.clear();
     sendThread_.setClients(clients_);
     sendThread_.clearLatest();
+    replicationManager_.clear();
     currentTick_ = 0;
     gameStarted_ = false;
     introCinematic_.reset();
@@ -24,7 +24,7 @@ void ServerApp::updateGameplay(float dt, const std::vector<ReceivedInput>& input
 {
     updateSystems(dt, inputs);
 
-    auto collisions = collisionSys_.detect(registry_);
+    const auto& collisions = collisionSys_.detect(registry_);
     logCollisions(collisions);
     damageSys_.apply(registry_, collisions);
 
@@ -38,21 +38,36 @@ void ServerApp::updateGameplay(float dt, const std::vector<ReceivedInput>& input
 void ServerApp::tick(const std::vector<ReceivedInput>& inputs)
 {
     constexpr float dt = 1.0F / kTickRate;
+    ProfileTick profileTick(profiler_, currentTick_);
 
     updateNetworkStats(dt);
-    handleControl();
-    maybeStartGame();
-    updateCountdown(dt);
+    {
+        PROFILE_ZONE("control");
+        handleControl();
+        maybeStartGame();
+        updateCountdown(dt);
+    }
 
     if (gameStarted_) {
-        updateGameplay(dt, inputs);
-        sendSnapshots();
+        {
+            PROFILE_ZONE("gameplay");
+            updateGameplay(dt, inputs);
+        }
+        {
+            PROFILE_ZONE("replication.send");
+            sendSnapshots();
+        }
+    }
+    {
+        PROFILE_ZONE("send.flush");
+        sendThread_.flush();
     }
     currentTick_++;
 }
 
 void ServerApp::updateSystems(float deltaTime, const std::vector<ReceivedInput>& inputs)
 {
+    PROFILE_ZONE("systems");
     introCinematic_.update(registry_, playerEntities_, deltaTime);
     const bool introActive = introCinematic_.active();
 
@@ -65,7 +80,8 @@ void ServerApp::updateSystems(float deltaTime, const std::vector<ReceivedInput>&
 
     movementSys_.update(registry_, deltaTime);
     boundarySys_.update(registry_);
-    monsterMovementSys_.update(registry_, deltaTime);
+    playerIndex_.rebuild(registry_, playerEntities_);
+    monsterMovementSys_.update(registry_, playerIndex_, deltaTime);
 
     if (levelLoaded_) {
         const auto* segment = levelDirector_->currentSegment();
@@ -81,11 +97,14 @@ void ServerApp::updateSystems(float deltaTime, const std::vector<ReceivedInput>&
         sendLevelEvents(events);
         sendSegmentState();
         playerBoundsSys_.update(registry_, levelDirector_->playerBounds());
+        if (const auto& bounds = levelDirector_->playerBounds())
+            collisionSys_.setBounds(*bounds);
     } else {
         playerBoundsSys_.update(registry_, std::nullopt);
     }
 
-    enemyShootingSys_.update(registry_, deltaTime);
+    playerIndex_.refresh(registry_);
+    enemyShootingSys_.update(registry_, playerIndex_, deltaTime);
     walkerShotSys_.update(registry_, deltaTime);
 
     updateRespawnTimers(deltaTime);
@@ -110,35 +129,37 @@ std::unordered_set<EntityId> ServerApp::collectCurrentEntities()
 void ServerApp::logSnapshotSummary(std::size_t totalBytes, std::size_t payloadSize, bool forceFull)
 {
     auto& reg = world_.getRegistry();
-    Logger::instance().info("[Snapshot] tick=" + std::to_string(currentTick_) + " size=" + std::to_string(totalBytes) +
-                            " payload=" + std::to_string(payloadSize) +
-                            " entities=" + std::to_string(reg.entityCount()) + (forceFull ? " (FULL)" : " (delta)"));
+    LOG_DEBUG("[Snapshot]", "tick=", currentTick_, " size=", totalBytes, " payload=", payloadSize,
+              " entities=", reg.entityCount(), forceFull ? " (FULL)" : " (delta)");
 }
 
 void ServerApp::sendSnapshots()
 {
     bool forceFull = (currentTick_ % kFullStateInterval == 0);
-    auto result    = replicationManager_.synchronize(world_.getRegistry(), currentTick_, forceFull);
-
-    if (result.packets.empty())
-        return;
-
-    std::size_t totalSize = 0;
-    for (const auto& p : result.packets)
-        totalSize += p.size();
-
-    if (result.packets.size() > 1) {
-        Logger::instance().info("[Snapshot] tick=" + std::to_string(currentTick_) +
-                                " chunks=" + std::to_string(result.packets.size()) +
-                                " total_size=" + std::to_string(totalSize) + (result.wasFull ? " (FULL)" : " (delta)"));
-    } else {
-        logSnapshotSummary(result.packets[0].size(), 0, result.wasFull);
+    relevancy_.camera = RelevancyContext::kDefaultCamera;
+    relevancy_.bosses.clear();
+    if (levelDirector_) {
+        if (const auto& camera = levelDirector_->cameraBounds())
+            relevancy_.camera = *camera;
+        levelDirector_->activeBosses(relevancy_.bosses);
     }
+    replicationManager_.capture(world_.getRegistry(), currentTick_, relevancy_);
 
+    std::size_t packetCount = 0;
+    std::size_t totalSize   = 0;
+    std::size_t deferred    = 0;
+    bool wasFull            = false;
     for (const auto& c : clients_) {
         std::uint16_t lastSeq = 0;
         std::string key       = endpointKey(c);
-        auto itSess           = sessions_.find(key);
+        auto result           = replicationManager_.synchronize(key, forceFull);
+        if (result.packets.empty())
+            continue;
+        packetCount += result.packets.size();
+        deferred += result.deferred;
+        wasFull = wasFull || result.wasFull;
+
+        auto itSess = sessions_.find(key);
         if (itSess != sessions_.end()) {
             auto itEnt = playerEntities_.find(itSess->second.playerId);
             if (itEnt != playerEntities_.end() && registry_.isAlive(itEnt->second)) {
@@ -148,7 +169,7 @@ void ServerApp::sendSnapshots()
             }
         }
 
-        for (auto p : result.packets) {
+        for (auto& p : result.packets) {
             if (p.size() >= PacketHeader::kSize) {
                 p[7] = static_cast<std::uint8_t>((lastSeq >> 8) & 0xFF);
                 p[8] = static_cast<std::uint8_t>(lastSeq & 0xFF);
@@ -161,9 +182,20 @@ void ServerApp::sendSnapshots()
                     p[p.size() - 1]      = static_cast<std::uint8_t>(newCrc & 0xFF);
                 }
             }
+            totalSize += p.size();
             sendThread_.sendTo(p, c);
         }
     }
+
+    if (packetCount == 0)
+        return;
+
+    if (packetCount > 1) {
+        LOG_DEBUG("[Snapshot]", "tick=", currentTick_, " packets=", packetCount, " clients=", clients_.size(),
+                  " total_size=", totalSize, " deferred=", deferred, wasFull ? " (FULL)" : " (delta)");
+    } else {
+        logSnapshotSummary(totalSize, 0, wasFull);
+    }
 }
 
 void ServerApp::cleanupExpiredMissiles(float deltaTime)
@@ -182,7 +214,7 @@ void ServerApp::cleanupExpiredMissiles(float deltaTime)
     if (expired.empty()) {
         return;
     }
-    Logger::instance().info("[Replication] Cleaning up " + std::to_string(expired.size()) + " expired missile(s)");
+    LOG_DEBUG("[Replication]", "Cleaning up ", expired.size(), " expired missile(s)");
     for (EntityId id : expired) {
         EntityDestroyedPacket pkt{};
         pkt.entityId = id;
@@ -194,19 +226,18 @@ void ServerApp::cleanupExpiredMissiles(float deltaTime)
 void ServerApp::cleanupOffscreenEntities()
 {
     std::vector<EntityId> offscreenEntities;
-    for (EntityId id : registry_.view<TransformComponent, TagComponent>()) {
-        if (!registry_.isAlive(id)) {
-            continue;
-        }
-        auto& t   = registry_.get<TransformComponent>(id);
-        auto& tag = registry_.get<TagComponent>(id);
-        if ((tag.hasTag(EntityTag::Enemy) || tag.hasTag(EntityTag::Projectile)) && (t.x < -100.0F || t.x > 2000.0F)) {
-            offscreenEntities.push_back(id);
+    for (EntityTag tag : {EntityTag::Enemy, EntityTag::Projectile}) {
+        for (EntityId id : registry_.viewTagged<TransformComponent>(tag)) {
+            if (tag == EntityTag::Projectile && registry_.hasTag(id, EntityTag::Enemy))
+                continue;
+            const auto& t = registry_.get<TransformComponent>(id);
+            if (t.x < -100.0F || t.x > 2000.0F)
+                offscreenEntities.push_back(id);
         }
     }
+    std::sort(offscreenEntities.begin(), offscreenEntities.end());
     if (!offscreenEntities.empty()) {
-        Logger::instance().info("[Replication] Cleaning up " + std::to_string(offscreenEntities.size()) +
-                                " offscreen entity(ies)");
+        LOG_DEBUG("[Replication]", "Cleaning up ", offscreenEntities.size(), " offscreen entity(ies)");
         for (EntityId id : offscreenEntities) {
             EntityDestroyedPacket pkt{};
             pkt.entityId = id;
@@ -242,20 +273,10 @@ void ServerApp::logCollisions(const std::vector<Collision>& collisions)
     if (collisions.empty()) {
         return;
     }
-    Logger::instance().info("[Collision] Detected " + std::to_string(collisions.size()) + " collision(s)");
+    LOG_DEBUG("[Collision]", "Detected ", collisions.size(), " collision(s)");
     for (const auto& col : collisions) {
-        std::string aTag = getEntityTagName(col.a);
-        std::string bTag = getEntityTagName(col.b);
-        std::string msg  = "  Collision: ";
-        msg += aTag;
-        msg += " (ID:";
-        msg += std::to_string(col.a);
-        msg += ") <-> ";
-        msg += bTag;
-        msg += " (ID:";
-        msg += std::to_string(col.b);
-        msg += ")";
-        Logger::instance().info("[Collision] " + msg);
+        LOG_DEBUG("[Collision]", "  Collision: ", getEntityTagName(col.a), " (ID:", col.a, ") <-> ",
+                  getEntityTagName(col.b), " (ID:", col.b, ")");
     }
 }
 
@@ -0,0 +1,188 @@
+#include "network/SharedGamePort.hpp"
+
+#include "Logger.hpp"
+#include "core/Session.hpp"
+#include "network/InputReceiveThread.hpp"
+#include "network/PacketHeader.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+SharedGamePort::SharedGamePort(const IpEndpoint& bindTo, std::chrono::milliseconds bindingTimeout)
+    : bind_(bindTo), bindingTimeout_(bindingTimeout)
+{}
+
+SharedGamePort::~SharedGamePort()
+{
+    stop();
+}
+
+bool SharedGamePort::start()
+{
+    if (running_)
+        return false;
+    if (!socket_.open(bind_))
+        return false;
+    auto onDatagram = [this](const std::uint8_t* data, std::size_t size, const IpEndpoint& src) {
+        route(data, size, src);
+    };
+    if (!reactor_.open() || !reactor_.watch(socket_, onDatagram)) {
+        reactor_.close();
+        socket_.close();
+        return false;
+    }
+    running_  = true;
+    receiver_ = std::thread([this] { receiveLoop(); });
+    sender_   = std::thread([this] { sendLoop(); });
+    Logger::instance().info("[GamePort] Shared game port listening on " + std::to_string(endpoint().port));
+    return true;
+}
+
+void SharedGamePort::stop()
+{
+    if (!running_)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        running_ = false;
+    }
+    sendWake_.notify_one();
+    reactor_.wake();
+    if (receiver_.joinable())
+        receiver_.join();
+    if (sender_.joinable())
+        sender_.join();
+    reactor_.close();
+    socket_.close();
+}
+
+bool SharedGamePort::isRunning() const
+{
+    return running_;
+}
+
+IpEndpoint SharedGamePort::endpoint() const
+{
+    return socket_.localEndpoint();
+}
+
+void SharedGamePort::attach(std::uint32_t roomId, InputReceiveThread& receiver)
+{
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    rooms_[roomId] = &receiver;
+}
+
+void SharedGamePort::detach(std::uint32_t roomId)
+{
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    rooms_.erase(roomId);
+    std::erase_if(bindings_, [roomId](const auto& entry) { return entry.second.roomId == roomId; });
+}
+
+void SharedGamePort::submit(PacketBatch& batch)
+{
+    if (batch.empty())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        pending_.appendAll(batch);
+    }
+    batch.clear();
+    sendWake_.notify_one();
+}
+
+std::optional<std::uint32_t> SharedGamePort::roomOf(const IpEndpoint& endpoint) const
+{
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    auto it = bindings_.find(keyOf(endpoint));
+    if (it == bindings_.end())
+        return std::nullopt;
+    return it->second.roomId;
+}
+
+std::size_t SharedGamePort::roomCount() const
+{
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    return rooms_.size();
+}
+
+std::uint64_t SharedGamePort::keyOf(const IpEndpoint& endpoint)
+{
+    return (static_cast<std::uint64_t>(endpoint.addr[0]) << 40) | (static_cast<std::uint64_t>(endpoint.addr[1]) << 32) |
+           (static_cast<std::uint64_t>(endpoint.addr[2]) << 24) | (static_cast<std::uint64_t>(endpoint.addr[3]) << 16) |
+           endpoint.port;
+}
+
+void SharedGamePort::receiveLoop()
+{
+    auto nextSweep = std::chrono::steady_clock::now() + kSweepInterval;
+    while (running_) {
+        auto now  = std::chrono::steady_clock::now();
+        auto wait = std::chrono::ceil<std::chrono::milliseconds>(nextSweep - now);
+        reactor_.poll(std::max(wait, std::chrono::milliseconds(0)));
+        now = std::chrono::steady_clock::now();
+        if (now >= nextSweep) {
+            sweep(now);
+            nextSweep = now + kSweepInterval;
+        }
+    }
+}
+
+void SharedGamePort::sendLoop()
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(sendMutex_);
+            sendWake_.wait(lock, [this] { return !pending_.empty() || !running_; });
+            if (pending_.empty())
+                return;
+            std::swap(outgoing_, pending_);
+        }
+        outgoing_.send(socket_, -1);
+    }
+}
+
+void SharedGamePort::route(const std::uint8_t* data, std::size_t size, const IpEndpoint& src)
+{
+    auto hdr = PacketHeader::decode(data, size);
+    if (!hdr) {
+        Logger::instance().addBytesReceived(size);
+        Logger::instance().addPacketReceived();
+        Logger::instance().addPacketDropped();
+        return;
+    }
+
+    const auto key = keyOf(src);
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    if (hdr->messageType == static_cast<std::uint8_t>(MessageType::ClientHello) ||
+        hdr->messageType == static_cast<std::uint8_t>(MessageType::ClientJoinRequest)) {
+        if (rooms_.contains(hdr->tickId))
+            bindings_[key] = Binding{hdr->tickId, now};
+    }
+
+    auto binding = bindings_.find(key);
+    auto room    = binding == bindings_.end() ? rooms_.end() : rooms_.find(binding->second.roomId);
+    if (room == rooms_.end()) {
+        if (binding != bindings_.end())
+            bindings_.erase(binding);
+        Logger::instance().addBytesReceived(size);
+        Logger::instance().addPacketReceived();
+        Logger::instance().addPacketDropped();
+        LOG_DEBUG("[GamePort]", "drop status=unrouted from=", endpointKey(src), " room=", hdr->tickId);
+        return;
+    }
+    binding->second.lastSeen = now;
+    room->second->deliver(data, size, src);
+}
+
+void SharedGamePort::sweep(std::chrono::steady_clock::time_point now)
+{
+    std::lock_guard<std::mutex> lock(routesMutex_);
+    for (auto& [roomId, receiver] : rooms_)
+        receiver->pollTimeouts(now);
+    std::erase_if(bindings_, [&](const auto& entry) {
+        return now - entry.second.lastSeen >= bindingTimeout_ || !rooms_.contains(entry.second.roomId);
+    });
+}
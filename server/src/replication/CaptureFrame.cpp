@@ -0,0 +1,91 @@
+#include "replication/CaptureFrame.hpp"
+
+#include "components/HealthComponent.hpp"
+#include "components/InvincibilityComponent.hpp"
+#include "components/LivesComponent.hpp"
+#include "components/ScoreComponent.hpp"
+#include "components/TransformComponent.hpp"
+#include "components/VelocityComponent.hpp"
+#include "core/EntityTypeResolver.hpp"
+#include "network/SnapshotCodec.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    CachedEntityState captureState(const Registry& registry, EntityId id)
+    {
+        CachedEntityState s{};
+        const auto& t = registry.get<TransformComponent>(id);
+        s.posX        = t.x;
+        s.posY        = t.y;
+        s.entityType  = static_cast<std::uint8_t>(resolveEntityType(registry, id));
+
+        if (registry.has<VelocityComponent>(id)) {
+            const auto& v = registry.get<VelocityComponent>(id);
+            s.velX        = v.vx;
+            s.velY        = v.vy;
+        }
+        if (registry.has<HealthComponent>(id))
+            s.health = static_cast<std::int16_t>(registry.get<HealthComponent>(id).current);
+        if (registry.has<LivesComponent>(id))
+            s.lives = static_cast<std::int8_t>(registry.get<LivesComponent>(id).current);
+        if (registry.has<ScoreComponent>(id))
+            s.score = registry.get<ScoreComponent>(id).value;
+        if (registry.has<InvincibilityComponent>(id))
+            s.status |= (1 << 1);
+
+        s.initialized = true;
+        return s;
+    }
+
+    std::uint16_t presentFields(const Registry& registry, EntityId id)
+    {
+        std::uint16_t mask = SnapshotCodec::kFieldType | SnapshotCodec::kFieldPosX | SnapshotCodec::kFieldPosY;
+        if (registry.has<VelocityComponent>(id))
+            mask |= SnapshotCodec::kFieldVelX | SnapshotCodec::kFieldVelY;
+        if (registry.has<HealthComponent>(id))
+            mask |= SnapshotCodec::kFieldHealth;
+        if (registry.has<InvincibilityComponent>(id) || registry.has<LivesComponent>(id))
+            mask |= SnapshotCodec::kFieldStatus;
+        if (registry.has<ScoreComponent>(id))
+            mask |= SnapshotCodec::kFieldScore;
+        return mask;
+    }
+} // namespace
+
+std::size_t CaptureFrame::size() const
+{
+    return ids.size();
+}
+
+std::ptrdiff_t CaptureFrame::indexOf(EntityId id) const
+{
+    auto it = std::lower_bound(ids.begin(), ids.end(), id);
+    return it != ids.end() && *it == id ? it - ids.begin() : -1;
+}
+
+void CaptureFrame::clear()
+{
+    ids.clear();
+    generations.clear();
+    fields.clear();
+    priorities.clear();
+    states.clear();
+}
+
+void captureFrame(const Registry& registry, std::uint64_t tick, CaptureFrame& frame)
+{
+    frame.clear();
+    frame.tick = tick;
+    for (EntityId id : const_cast<Registry&>(registry).view<TransformComponent>())
+        frame.ids.push_back(id);
+    std::sort(frame.ids.begin(), frame.ids.end());
+
+    for (EntityId id : frame.ids) {
+        frame.generations.push_back(registry.handle(id).generation);
+        frame.fields.push_back(presentFields(registry, id));
+        frame.priorities.push_back(tagPriority(registry, id));
+        frame.states.push_back(captureState(registry, id));
+    }
+}
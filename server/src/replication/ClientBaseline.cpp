@@ -0,0 +1,188 @@
+#include "replication/ClientBaseline.hpp"
+
+#include <algorithm>
+
+bool ClientBaseline::acknowledged() const
+{
+    return acknowledged_;
+}
+
+std::uint32_t ClientBaseline::ackedTick() const
+{
+    return ackedTick_;
+}
+
+std::optional<std::uint32_t> ClientBaseline::baselineTick() const
+{
+    if (!acknowledged_)
+        return std::nullopt;
+    return ackedTick_;
+}
+
+std::size_t ClientBaseline::pendingFrames() const
+{
+    return frameCount_;
+}
+
+const SnapshotCodec::EntityFields* ClientBaseline::find(EntityId id, std::uint32_t generation) const
+{
+    if (!baseline_ || id >= baseline_->size())
+        return nullptr;
+    const auto& entry = (*baseline_)[id];
+    if (!entry.present || entry.generation != generation)
+        return nullptr;
+    return &entry.state;
+}
+
+std::uint16_t ClientBaseline::pendingMask(EntityId id) const
+{
+    return id < pending_.size() ? pending_[id] : 0;
+}
+
+EntityId ClientBaseline::rotation(ReplicationPriority priority) const
+{
+    return rotation_[static_cast<std::size_t>(priority)];
+}
+
+void ClientBaseline::setRotation(ReplicationPriority priority, EntityId next)
+{
+    rotation_[static_cast<std::size_t>(priority)] = next;
+}
+
+void ClientBaseline::record(std::uint32_t tick, bool againstBaseline, const std::vector<SentEntityState>& entities)
+{
+    auto base = againstBaseline ? baseline_ : nullptr;
+    if (frameCount_ >= kMaxPendingFrames)
+        reset();
+
+    auto& next = frames_[(firstFrame_ + frameCount_) % kMaxPendingFrames];
+    next.tick  = tick;
+    next.base  = std::move(base);
+    next.entities.assign(entities.begin(), entities.end());
+    ++frameCount_;
+    for (const auto& sent : entities)
+        mergeMask(pending_, sent.id, sent.mask);
+}
+
+bool ClientBaseline::acknowledge(std::uint32_t tick)
+{
+    if (acknowledged_ && tick <= ackedTick_)
+        return false;
+    std::size_t index = 0;
+    while (index < frameCount_ && frame(index).tick != tick)
+        ++index;
+    if (index == frameCount_)
+        return false;
+
+    const Frame& match = frame(index);
+    auto next          = acquireMap();
+    if (match.base)
+        next->assign(match.base->begin(), match.base->end());
+    else
+        next->clear();
+    for (const auto& sent : match.entities) {
+        if (sent.id >= next->size())
+            next->resize(static_cast<std::size_t>(sent.id) + 1);
+        auto& entry = (*next)[sent.id];
+        if (!sent.delta)
+            entry = BaselineEntry{true, sent.generation, {}};
+        SnapshotCodec::apply(entry.state, sent.state, sent.mask);
+    }
+
+    for (std::size_t i = 0; i < index; ++i) {
+        for (const auto& sent : frame(i).entities)
+            mergeMask(carried_, sent.id, sent.mask);
+    }
+    for (const auto& sent : match.entities) {
+        if (sent.id < carried_.size())
+            carried_[sent.id] &= static_cast<std::uint16_t>(~sent.mask);
+    }
+
+    dropFrames(index + 1);
+    baseline_     = std::move(next);
+    ackedTick_    = tick;
+    acknowledged_ = true;
+    rebuildPending();
+    return true;
+}
+
+void ClientBaseline::retain(const CaptureFrame& frame)
+{
+    for (EntityId id = 0; id < carried_.size(); ++id) {
+        if (carried_[id] != 0 && frame.indexOf(id) < 0)
+            carried_[id] = 0;
+    }
+    rebuildPending();
+    if (!baseline_)
+        return;
+    auto dead = [&frame](const BaselineMap& map, EntityId id) {
+        if (!map[id].present)
+            return false;
+        auto index = frame.indexOf(id);
+        return index < 0 || frame.generations[static_cast<std::size_t>(index)] != map[id].generation;
+    };
+    EntityId id = 0;
+    while (id < baseline_->size() && !dead(*baseline_, id))
+        ++id;
+    if (id == baseline_->size())
+        return;
+    auto next = acquireMap();
+    next->assign(baseline_->begin(), baseline_->end());
+    for (; id < next->size(); ++id) {
+        if (dead(*next, id))
+            (*next)[id].present = false;
+    }
+    baseline_ = std::move(next);
+}
+
+void ClientBaseline::reset()
+{
+    acknowledged_ = false;
+    ackedTick_    = 0;
+    baseline_.reset();
+    std::fill(carried_.begin(), carried_.end(), std::uint16_t{0});
+    std::fill(pending_.begin(), pending_.end(), std::uint16_t{0});
+    dropFrames(frameCount_);
+    firstFrame_ = 0;
+    rotation_.fill(0);
+}
+
+std::shared_ptr<ClientBaseline::BaselineMap> ClientBaseline::acquireMap()
+{
+    auto spare = std::find_if(maps_.begin(), maps_.end(), [](const auto& map) { return map.use_count() == 1; });
+    if (spare != maps_.end())
+        return *spare;
+    return maps_.emplace_back(std::make_shared<BaselineMap>());
+}
+
+ClientBaseline::Frame& ClientBaseline::frame(std::size_t index)
+{
+    return frames_[(firstFrame_ + index) % kMaxPendingFrames];
+}
+
+void ClientBaseline::dropFrames(std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& dropped = frame(i);
+        dropped.base.reset();
+        dropped.entities.clear();
+    }
+    firstFrame_ = (firstFrame_ + count) % kMaxPendingFrames;
+    frameCount_ -= count;
+}
+
+void ClientBaseline::rebuildPending()
+{
+    pending_.assign(carried_.begin(), carried_.end());
+    for (std::size_t i = 0; i < frameCount_; ++i) {
+        for (const auto& sent : frame(i).entities)
+            mergeMask(pending_, sent.id, sent.mask);
+    }
+}
+
+void ClientBaseline::mergeMask(std::vector<std::uint16_t>& masks, EntityId id, std::uint16_t mask)
+{
+    if (id >= masks.size())
+        masks.resize(static_cast<std::size_t>(id) + 1, 0);
+    masks[id] |= mask;
+}
@@ -0,0 +1,42 @@
+#include "replication/Relevancy.hpp"
+
+#include "components/TagComponent.hpp"
+
+#include <algorithm>
+
+ReplicationPriority tagPriority(const Registry& registry, EntityId id)
+{
+    if (registry.hasTag(id, EntityTag::Player))
+        return ReplicationPriority::Player;
+    if (registry.hasTag(id, EntityTag::Enemy))
+        return ReplicationPriority::Enemy;
+    if (registry.hasTag(id, EntityTag::Projectile))
+        return ReplicationPriority::Projectile;
+    return ReplicationPriority::Other;
+}
+
+ReplicationPriority replicationPriority(Entity entity, ReplicationPriority tagged, const RelevancyContext& context)
+{
+    if (std::find(context.bosses.begin(), context.bosses.end(), entity) != context.bosses.end())
+        return ReplicationPriority::Boss;
+    return tagged;
+}
+
+ReplicationPriority replicationPriority(const Registry& registry, EntityId id, const RelevancyContext& context)
+{
+    return replicationPriority(registry.handle(id), tagPriority(registry, id), context);
+}
+
+bool isRelevant(float x, float y, ReplicationPriority priority, const RelevancyContext& context)
+{
+    if (priority == ReplicationPriority::Player || priority == ReplicationPriority::Boss)
+        return true;
+    const auto& camera = context.camera;
+    return x >= camera.minX - context.margin && x <= camera.maxX + context.margin &&
+           y >= camera.minY - context.margin && y <= camera.maxY + context.margin;
+}
+
+bool isRelevant(const TransformComponent& transform, ReplicationPriority priority, const RelevancyContext& context)
+{
+    return isRelevant(transform.x, transform.y, priority, context);
+}
@@ -2,23 +2,92 @@
 
 #include "network/Packets.hpp"
 
+#include <algorithm>
+
 ReplicationManager::ReplicationManager() = default;
 
-ReplicationManager::SyncResult ReplicationManager::synchronize(const Registry& registry, std::uint32_t currentTick)
+void ReplicationManager::capture(const Registry& registry, std::uint32_t currentTick)
+{
+    capture(registry, currentTick, RelevancyContext{});
+}
+
+void ReplicationManager::capture(const Registry& registry, std::uint32_t currentTick, const RelevancyContext& context)
+{
+    captureFrame(registry, currentTick, frame_);
+    capture(frame_, context);
+}
+
+void ReplicationManager::capture(const CaptureFrame& frame, const RelevancyContext& context)
+{
+    currentTick_ = static_cast<std::uint32_t>(frame.tick);
+    entities_.clear();
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+        auto priority = replicationPriority(Entity{frame.ids[i], frame.generations[i]}, frame.priorities[i], context);
+        if (!isRelevant(frame.states[i].posX, frame.states[i].posY, priority, context))
+            continue;
+        auto entity     = replicatedEntity(frame, i);
+        entity.priority = priority;
+        entities_.push_back(entity);
+    }
+    std::sort(entities_.begin(), entities_.end(), [](const ReplicatedEntity& a, const ReplicatedEntity& b) {
+        return a.priority != b.priority ? a.priority < b.priority : a.id < b.id;
+    });
+
+    if (currentTick_ % kBaselinePruneInterval == 0) {
+        for (auto& [client, baseline] : clients_)
+            baseline.retain(frame);
+    }
+}
+
+void ReplicationManager::setByteBudget(std::size_t bytes)
+{
+    byteBudget_ = bytes;
+}
+
+std::size_t ReplicationManager::replicatedCount() const
 {
-    return synchronize(registry, currentTick, false);
+    return entities_.size();
 }
 
-ReplicationManager::SyncResult ReplicationManager::synchronize(const Registry& registry, std::uint32_t currentTick,
-                                                               bool forceFull)
+ReplicationManager::SyncResult ReplicationManager::synchronize(const std::string& client)
 {
-    std::vector<std::vector<std::uint8_t>> packets = buildSmartDeltaSnapshot(
-        const_cast<Registry&>(registry), currentTick, entityStateCache_, forceFull, Network::kMaxSafePacketPayload);
+    return synchronize(client, false);
+}
+
+ReplicationManager::SyncResult ReplicationManager::synchronize(const std::string& client, bool forceFull)
+{
+    auto& baseline = clients_[client];
+    bool wasFull   = forceFull || !baseline.acknowledged();
+
+    std::size_t deferred = 0;
+
+    auto packets =
+        buildBaselineDeltaSnapshot(entities_, currentTick_, baseline, forceFull, byteBudget_, buffers_, &deferred);
+
+    return SyncResult{packets, wasFull, deferred};
+}
 
-    return SyncResult{std::move(packets), forceFull};
+bool ReplicationManager::acknowledge(const std::string& client, std::uint32_t tick)
+{
+    auto it = clients_.find(client);
+    if (it == clients_.end())
+        return false;
+    return it->second.acknowledge(tick);
+}
+
+void ReplicationManager::removeClient(const std::string& client)
+{
+    clients_.erase(client);
+}
+
+const ClientBaseline* ReplicationManager::baseline(const std::string& client) const
+{
+    auto it = clients_.find(client);
+    return it != clients_.end() ? &it->second : nullptr;
 }
 
 void ReplicationManager::clear()
 {
-    entityStateCache_.clear();
+    entities_.clear();
+    clients_.clear();
 }
@@ -1,286 +1,187 @@
-#include "components/InvincibilityComponent.hpp"
-#include "components/LivesComponent.hpp"
-#include "components/ScoreComponent.hpp"
-#include "core/EntityTypeResolver.hpp"
+#include "network/BitStream.hpp"
 #include "network/NetworkCompression.hpp"
 #include "network/NetworkConstants.hpp"
 #include "network/Packets.hpp"
 #include "network/Packing.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "replication/ClientBaseline.hpp"
 #include "replication/EntityStateCache.hpp"
+#include "replication/SnapshotBuffers.hpp"
 
 #include <algorithm>
-#include <bit>
-#include <cmath>
+#include <optional>
 
 namespace
 {
-    constexpr float kPositionThreshold = 0.01F;
-    constexpr float kVelocityThreshold = 0.01F;
+    using SnapshotCodec::EntityFields;
+    using SnapshotCodec::EntityHeader;
 
-    void writeU16(std::vector<std::uint8_t>& out, std::uint16_t v)
+    void putU16(std::uint8_t* out, std::uint16_t v)
     {
-        out.push_back(static_cast<std::uint8_t>((v >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(v & 0xFF));
+        out[0] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
+        out[1] = static_cast<std::uint8_t>(v & 0xFF);
     }
 
-    void writeU32(std::vector<std::uint8_t>& out, std::uint32_t v)
+    void putU32(std::uint8_t* out, std::uint32_t v)
     {
-        out.push_back(static_cast<std::uint8_t>((v >> 24) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((v >> 16) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((v >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(v & 0xFF));
+        out[0] = static_cast<std::uint8_t>((v >> 24) & 0xFF);
+        out[1] = static_cast<std::uint8_t>((v >> 16) & 0xFF);
+        out[2] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
+        out[3] = static_cast<std::uint8_t>(v & 0xFF);
     }
 
-    void writeI32(std::vector<std::uint8_t>& out, std::int32_t v)
+    EntityFields toWireFields(const CachedEntityState& s)
     {
-        writeU32(out, static_cast<std::uint32_t>(v));
+        EntityFields f{};
+        f.type   = s.entityType;
+        f.posX   = Packing::quantizeTo16(s.posX, SnapshotCodec::kPositionScale);
+        f.posY   = Packing::quantizeTo16(s.posY, SnapshotCodec::kPositionScale);
+        f.velX   = Packing::quantizeTo16(s.velX, SnapshotCodec::kVelocityScale);
+        f.velY   = Packing::quantizeTo16(s.velY, SnapshotCodec::kVelocityScale);
+        f.health = s.health;
+        f.status = Packing::pack44(s.status, static_cast<std::uint8_t>(std::clamp(static_cast<int>(s.lives), 0, 15)));
+        f.score  = s.score;
+        return f;
     }
 
-    CachedEntityState captureState(const Registry& registry, EntityId id)
+    std::uint16_t calculateMask(const EntityFields& cur, const CachedEntityState* prev, std::uint16_t fields,
+                                bool forceFull)
     {
-        CachedEntityState s{};
-        const auto& t = registry.get<TransformComponent>(id);
-        s.posX        = t.x;
-        s.posY        = t.y;
-        s.entityType  = resolveEntityType(registry, id);
-
-        if (registry.has<VelocityComponent>(id)) {
-            const auto& v = registry.get<VelocityComponent>(id);
-            s.velX        = v.vx;
-            s.velY        = v.vy;
-        }
-        if (registry.has<HealthComponent>(id))
-            s.health = registry.get<HealthComponent>(id).current;
-        if (registry.has<LivesComponent>(id))
-            s.lives = registry.get<LivesComponent>(id).current;
-        if (registry.has<ScoreComponent>(id))
-            s.score = registry.get<ScoreComponent>(id).value;
-        if (registry.has<InvincibilityComponent>(id))
-            s.status |= (1 << 1);
-
-        s.initialized = true;
-        return s;
-    }
-
-    uint16_t calculateMask(const CachedEntityState& cur, const CachedEntityState* prev, const Registry& registry,
-                           EntityId id, bool forceFull)
-    {
-        bool isDelta       = !forceFull && prev && prev->initialized;
-        std::uint16_t mask = 0;
-
-        if (!isDelta || cur.entityType != prev->entityType)
-            mask |= 1 << 0;
-        if (!isDelta || std::abs(cur.posX - prev->posX) > kPositionThreshold)
-            mask |= 1 << 1;
-        if (!isDelta || std::abs(cur.posY - prev->posY) > kPositionThreshold)
-            mask |= 1 << 2;
-
-        if (registry.has<VelocityComponent>(id)) {
-            if (!isDelta || std::abs(cur.velX - prev->velX) > kVelocityThreshold)
-                mask |= 1 << 3;
-            if (!isDelta || std::abs(cur.velY - prev->velY) > kVelocityThreshold)
-                mask |= 1 << 4;
-        }
-        if (registry.has<HealthComponent>(id) && (!isDelta || cur.health != prev->health))
-            mask |= 1 << 5;
-        if ((registry.has<InvincibilityComponent>(id) || registry.has<LivesComponent>(id)) &&
-            (!isDelta || cur.status != prev->status || cur.lives != prev->lives))
-            mask |= 1 << 6;
-        if (registry.has<ScoreComponent>(id) && (!isDelta || cur.score != prev->score))
-            mask |= 1 << 10;
-
-        return mask;
-    }
-
-    void writeDeltaData(std::vector<std::uint8_t>& block, uint16_t mask, const CachedEntityState& s)
-    {
-        if (mask & (1 << 0))
-            block.push_back(s.entityType);
-        if (mask & (1 << 1))
-            writeU16(block, static_cast<std::uint16_t>(Packing::quantizeTo16(s.posX, 10.0F)));
-        if (mask & (1 << 2))
-            writeU16(block, static_cast<std::uint16_t>(Packing::quantizeTo16(s.posY, 10.0F)));
-        if (mask & (1 << 3))
-            writeU16(block, static_cast<std::uint16_t>(Packing::quantizeTo16(s.velX, 10.0F)));
-        if (mask & (1 << 4))
-            writeU16(block, static_cast<std::uint16_t>(Packing::quantizeTo16(s.velY, 10.0F)));
-        if (mask & (1 << 5))
-            writeU16(block, static_cast<std::uint16_t>(s.health));
-        if (mask & (1 << 6))
-            block.push_back(
-                Packing::pack44(s.status, static_cast<std::uint8_t>(std::clamp(static_cast<int>(s.lives), 0, 15))));
-        if (mask & (1 << 10))
-            writeI32(block, s.score);
+        if (forceFull || prev == nullptr || !prev->initialized)
+            return fields;
+        return fields & SnapshotCodec::changedFields(cur, toWireFields(*prev));
     }
 
-    std::vector<std::uint8_t> buildEntityBlock(const Registry& registry, EntityId id)
-    {
-        auto s    = captureState(registry, id);
-        auto mask = calculateMask(s, nullptr, registry, id, true);
-
-        std::vector<std::uint8_t> block;
-        writeU32(block, id);
-        writeU16(block, mask);
-        writeDeltaData(block, mask, s);
-        return block;
-    }
-
-    std::vector<SnapshotChunkBlock> buildBlocks(const Registry& registry, View<TransformComponent>& view)
-    {
-        std::vector<SnapshotChunkBlock> blocks;
-        blocks.reserve(registry.entityCount());
-        for (EntityId id : view)
-            blocks.push_back(SnapshotChunkBlock{buildEntityBlock(registry, id)});
-        return blocks;
-    }
-
-    std::vector<SnapshotChunkPacket> buildChunksFromBlocks(const std::vector<SnapshotChunkBlock>& blocks,
-                                                           std::size_t maxPayloadBytes)
+    void encodeEntities(SnapshotBuffers& buffers, std::uint32_t tick, std::optional<std::uint32_t> baselineTick)
     {
-        std::vector<SnapshotChunkPacket> chunks;
-        chunks.emplace_back();
-        for (const auto& blk : blocks) {
-            if (!chunks.empty() && chunks.back().data.size() + blk.data.size() + 6 > maxPayloadBytes)
-                chunks.emplace_back();
-            chunks.back().data.insert(chunks.back().data.end(), blk.data.begin(), blk.data.end());
-            chunks.back().entityCount++;
+        auto& entities = buffers.entities;
+        std::sort(entities.begin(), entities.end(),
+                  [](const WireEntity& a, const WireEntity& b) { return a.header.id < b.header.id; });
+
+        buffers.stream.clear();
+        buffers.entityOffsets.clear();
+        SnapshotCodec::writeBaseline(buffers.stream, tick, baselineTick);
+        std::uint32_t nextId = 0;
+        for (const auto& entity : entities) {
+            buffers.entityOffsets.push_back(buffers.stream.bitCount() / 8);
+            SnapshotCodec::writeEntity(buffers.stream, nextId, baselineTick.has_value(), entity.header, entity.fields,
+                                       entity.base);
         }
-        if (!chunks.empty() && chunks.back().entityCount == 0)
-            chunks.pop_back();
-        return chunks;
     }
 
-    std::vector<std::uint8_t> buildChunkPacket(const SnapshotChunkPacket& ch, std::uint16_t totalChunks,
-                                               std::uint16_t idx, uint32_t tick)
+    void writePacket(std::vector<std::uint8_t>& out, MessageType type, const std::vector<std::uint8_t>& payload,
+                     std::uint16_t sequence, std::uint32_t tick)
     {
-        std::vector<std::uint8_t> payload;
-        writeU16(payload, totalChunks);
-        writeU16(payload, idx);
-        writeU16(payload, ch.entityCount);
-        payload.insert(payload.end(), ch.data.begin(), ch.data.end());
-
         PacketHeader hdr{};
         hdr.packetType  = static_cast<std::uint8_t>(PacketType::ServerToClient);
-        hdr.messageType = static_cast<std::uint8_t>(MessageType::SnapshotChunk);
-        hdr.sequenceId  = static_cast<std::uint16_t>((tick + idx) & 0xFFFF);
+        hdr.messageType = static_cast<std::uint8_t>(type);
+        hdr.sequenceId  = sequence;
         hdr.tickId      = tick;
-        if (payload.size() > 64) {
-            auto compressed = Compression::compress(payload);
-            if (compressed.size() < payload.size()) {
+
+        out.resize(PacketHeader::kSize + payload.size() + PacketHeader::kCrcSize);
+        std::uint8_t* body = out.data() + PacketHeader::kSize;
+        std::size_t size   = payload.size();
+        if (size > 64) {
+            std::size_t compressed = Compression::compressInto(payload.data(), size, body, size - 1);
+            if (compressed > 0) {
                 hdr.isCompressed = true;
                 hdr.originalSize = static_cast<std::uint16_t>(payload.size());
-                hdr.payloadSize  = static_cast<std::uint16_t>(compressed.size());
-                auto hdrBytes    = hdr.encode();
-                std::vector<std::uint8_t> out(hdrBytes.begin(), hdrBytes.end());
-                out.insert(out.end(), compressed.begin(), compressed.end());
-                writeU32(out, PacketHeader::crc32(out.data(), out.size()));
-                return out;
+                size             = compressed;
             }
         }
-
-        hdr.payloadSize = static_cast<std::uint16_t>(payload.size());
+        if (!hdr.isCompressed)
+            std::copy(payload.begin(), payload.end(), body);
+        hdr.payloadSize = static_cast<std::uint16_t>(size);
 
         auto hdrBytes = hdr.encode();
-        std::vector<std::uint8_t> out(hdrBytes.begin(), hdrBytes.end());
-        out.insert(out.end(), payload.begin(), payload.end());
-        writeU32(out, PacketHeader::crc32(out.data(), out.size()));
-        return out;
+        std::copy(hdrBytes.begin(), hdrBytes.end(), out.begin());
+        out.resize(PacketHeader::kSize + size + PacketHeader::kCrcSize);
+        putU32(out.data() + PacketHeader::kSize + size, PacketHeader::crc32(out.data(), PacketHeader::kSize + size));
     }
-    struct DeltaResult
-    {
-        EntityId id;
-        CachedEntityState state;
-        std::vector<std::uint8_t> block;
-    };
 
-    std::vector<DeltaResult> getDeltaResults(Registry& registry, EntityStateCache& cache, bool forceFull)
+    void writeSnapshotPacket(SnapshotBuffers& buffers, std::uint32_t tick)
     {
-        auto view = registry.view<TransformComponent>();
-        std::vector<DeltaResult> results;
-        results.reserve(registry.entityCount());
-
-        for (EntityId id : view) {
-            auto cur  = captureState(registry, id);
-            auto* old = cache.get(id);
-            auto mask = calculateMask(cur, old, registry, id, forceFull);
-
-            if (mask == 0) {
-                continue;
-            }
-
-            DeltaResult res;
-            res.id    = id;
-            res.state = cur;
-            res.block.reserve(22);
-            writeU32(res.block, id);
-            writeU16(res.block, mask);
-            writeDeltaData(res.block, mask, cur);
-            results.push_back(std::move(res));
-        }
-        return results;
+        const auto& bytes = buffers.stream.bytes();
+        auto& payload     = buffers.payload;
+        payload.resize(2 + bytes.size());
+        putU16(payload.data(), static_cast<std::uint16_t>(buffers.entityOffsets.size()));
+        std::copy(bytes.begin(), bytes.end(), payload.begin() + 2);
+        writePacket(buffers.packets.acquire(), MessageType::Snapshot, payload,
+                    static_cast<std::uint16_t>(tick & 0xFFFF), tick);
     }
-    std::vector<std::uint8_t> buildPacketFromBlocks(const std::vector<SnapshotChunkBlock>& blocks, std::uint32_t tick)
-    {
-        std::vector<std::uint8_t> payload;
-        payload.reserve(blocks.size() * 16 + 2);
-
-        writeU16(payload, static_cast<std::uint16_t>(blocks.size()));
-        for (const auto& b : blocks)
-            payload.insert(payload.end(), b.data.begin(), b.data.end());
 
-        PacketHeader hdr{};
-        hdr.packetType  = static_cast<std::uint8_t>(PacketType::ServerToClient);
-        hdr.messageType = static_cast<std::uint8_t>(MessageType::Snapshot);
-        hdr.sequenceId  = static_cast<std::uint16_t>(tick & 0xFFFF);
-        hdr.tickId      = tick;
-        if (payload.size() > 64) {
-            auto compressed = Compression::compress(payload);
-            if (compressed.size() < payload.size()) {
-                hdr.isCompressed = true;
-                hdr.originalSize = static_cast<std::uint16_t>(payload.size());
-                hdr.payloadSize  = static_cast<std::uint16_t>(compressed.size());
-                auto hdrBytes    = hdr.encode();
-                std::vector<std::uint8_t> out(hdrBytes.begin(), hdrBytes.end());
-                out.insert(out.end(), compressed.begin(), compressed.end());
-                writeU32(out, PacketHeader::crc32(out.data(), out.size()));
-                return out;
+    void writeChunkPackets(SnapshotBuffers& buffers, std::uint32_t tick, std::size_t maxPayloadBytes)
+    {
+        const auto& bytes      = buffers.stream.bytes();
+        const std::size_t cut  = maxPayloadBytes > 6 ? maxPayloadBytes - 6 : 1;
+        const auto totalChunks = static_cast<std::uint16_t>((bytes.size() + cut - 1) / cut);
+        auto offset            = buffers.entityOffsets.begin();
+        auto& payload          = buffers.payload;
+        std::uint16_t idx      = 0;
+        for (std::size_t begin = 0; begin < bytes.size(); begin += cut, ++idx) {
+            std::size_t end           = std::min(bytes.size(), begin + cut);
+            std::uint16_t entityCount = 0;
+            while (offset != buffers.entityOffsets.end() && *offset < end) {
+                ++entityCount;
+                ++offset;
             }
+            payload.resize(6 + end - begin);
+            putU16(payload.data(), totalChunks);
+            putU16(payload.data() + 2, idx);
+            putU16(payload.data() + 4, entityCount);
+            std::copy(bytes.begin() + static_cast<std::ptrdiff_t>(begin),
+                      bytes.begin() + static_cast<std::ptrdiff_t>(end), payload.begin() + 6);
+            writePacket(buffers.packets.acquire(), MessageType::SnapshotChunk, payload,
+                        static_cast<std::uint16_t>((tick + idx) & 0xFFFF), tick);
         }
+    }
 
-        hdr.payloadSize = static_cast<std::uint16_t>(payload.size());
+    void writeStream(SnapshotBuffers& buffers, std::uint32_t tick, std::size_t maxSinglePacketSize,
+                     std::size_t maxChunkSize)
+    {
+        if (2 + buffers.stream.byteCount() <= maxSinglePacketSize)
+            writeSnapshotPacket(buffers, tick);
+        else
+            writeChunkPackets(buffers, tick, maxChunkSize);
+    }
 
-        auto hdrBytes = hdr.encode();
-        std::vector<std::uint8_t> out(hdrBytes.begin(), hdrBytes.end());
-        out.insert(out.end(), payload.begin(), payload.end());
-        writeU32(out, PacketHeader::crc32(out.data(), out.size()));
-        return out;
+    std::vector<std::vector<std::uint8_t>> copyPackets(SnapshotBuffers& buffers)
+    {
+        auto batch = buffers.packets.batch();
+        return {batch.begin(), batch.end()};
     }
 
-    std::vector<std::vector<std::uint8_t>>
-    buildChunksFromBlocksWithHeader(const std::vector<SnapshotChunkBlock>& blocks, std::uint32_t tick,
-                                    std::size_t maxPayloadBytes)
+    void captureAll(const Registry& registry, SnapshotBuffers& buffers)
     {
-        const auto chunks = buildChunksFromBlocks(blocks, maxPayloadBytes);
-        std::vector<std::vector<std::uint8_t>> packets;
-        const std::uint16_t totalChunks = static_cast<std::uint16_t>(chunks.size());
-        packets.reserve(totalChunks);
-        for (std::uint16_t idx = 0; idx < totalChunks; ++idx)
-            packets.push_back(buildChunkPacket(chunks[idx], totalChunks, idx, tick));
-        return packets;
+        CaptureFrame frame;
+        captureFrame(registry, 0, frame);
+        buffers.entities.clear();
+        buffers.packets.begin();
+        for (std::size_t i = 0; i < frame.size(); ++i) {
+            EntityHeader header{frame.ids[i], frame.fields[i], false};
+            buffers.entities.push_back(WireEntity{header, toWireFields(frame.states[i]), nullptr});
+        }
     }
 } // namespace
 
 std::vector<std::uint8_t> buildSnapshotPacket(Registry& registry, uint32_t tick)
 {
-    auto view = registry.view<TransformComponent>();
-    return buildPacketFromBlocks(buildBlocks(registry, view), tick);
+    SnapshotBuffers buffers;
+    captureAll(registry, buffers);
+    encodeEntities(buffers, tick, std::nullopt);
+    writeSnapshotPacket(buffers, tick);
+    return buffers.packets.batch().front();
 }
 
 std::vector<std::vector<std::uint8_t>> buildSnapshotChunks(Registry& registry, uint32_t tick,
                                                            std::size_t maxPayloadBytes)
 {
-    auto view = registry.view<TransformComponent>();
-    return buildChunksFromBlocksWithHeader(buildBlocks(registry, view), tick, maxPayloadBytes);
+    SnapshotBuffers buffers;
+    captureAll(registry, buffers);
+    encodeEntities(buffers, tick, std::nullopt);
+    writeChunkPackets(buffers, tick, maxPayloadBytes);
+    return copyPackets(buffers);
 }
 
 std::vector<std::vector<std::uint8_t>> buildSmartDeltaSnapshot(Registry& registry, uint32_t tick,
@@ -289,30 +190,29 @@ std::vector<std::vector<std::uint8_t>> buildSmartDeltaSnapshot(Registry& registr
                                                                std::size_t maxChunkSize)
 
 {
-    auto deltas = getDeltaResults(registry, cache, forceFullState);
-    if (deltas.empty())
+    SnapshotBuffers buffers;
+    CaptureFrame frame;
+    captureFrame(registry, tick, frame);
+    std::vector<std::size_t> changed;
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+        auto fields = toWireFields(frame.states[i]);
+        auto mask   = calculateMask(fields, cache.get(frame.ids[i]), frame.fields[i], forceFullState);
+        if (mask == 0)
+            continue;
+        buffers.entities.push_back(WireEntity{EntityHeader{frame.ids[i], mask, false}, fields, nullptr});
+        changed.push_back(i);
+    }
+    if (buffers.entities.empty())
         return {};
 
-    std::vector<SnapshotChunkBlock> blocks;
-    blocks.reserve(deltas.size());
-    std::size_t totalBytes = 2;
-    for (const auto& d : deltas) {
-        totalBytes += d.block.size();
-        blocks.push_back({d.block});
-    }
+    encodeEntities(buffers, tick, std::nullopt);
+    writeStream(buffers, tick, maxSinglePacketSize, maxChunkSize);
 
-    std::vector<std::vector<std::uint8_t>> result;
-    if (totalBytes <= maxSinglePacketSize) {
-        result.push_back(buildPacketFromBlocks(blocks, tick));
-    } else {
-        result = buildChunksFromBlocksWithHeader(blocks, tick, maxChunkSize);
+    for (std::size_t i : changed) {
+        cache.update(frame.ids[i], frame.states[i]);
     }
 
-    for (const auto& d : deltas) {
-        cache.update(d.id, d.state);
-    }
-
-    return result;
+    return copyPackets(buffers);
 }
 
 std::vector<std::uint8_t> buildDeltaSnapshotPacket(Registry& registry, uint32_t tick, EntityStateCache& cache,
@@ -328,3 +228,81 @@ std::vector<std::vector<std::uint8_t>> buildDeltaSnapshotChunks(Registry& regist
 {
     return buildSmartDeltaSnapshot(registry, tick, cache, forceFullState, 0, maxPayloadBytes);
 }
+
+ReplicatedEntity replicatedEntity(const CaptureFrame& frame, std::size_t index)
+{
+    ReplicatedEntity entity;
+    entity.id         = frame.ids[index];
+    entity.generation = frame.generations[index];
+    entity.fields     = frame.fields[index];
+    entity.state      = toWireFields(frame.states[index]);
+    return entity;
+}
+
+std::span<std::vector<std::uint8_t>> buildBaselineDeltaSnapshot(const std::vector<ReplicatedEntity>& entities,
+                                                                 uint32_t tick, ClientBaseline& baseline,
+                                                                 bool forceFullState, std::size_t byteBudget,
+                                                                 SnapshotBuffers& buffers, std::size_t* deferred)
+{
+    const auto baselineTick      = forceFullState ? std::nullopt : baseline.baselineTick();
+    const bool hasBaseline       = baselineTick.has_value();
+    const std::size_t budgetBits = byteBudget > 2 ? (byteBudget - 2) * 8 : 0;
+
+    auto& selected = buffers.entities;
+    auto& sent     = buffers.sent;
+    selected.clear();
+    sent.clear();
+    buffers.packets.begin();
+    std::size_t totalBits = hasBaseline ? 1 + BitWriter::varUIntBits(tick - *baselineTick) : 1;
+    std::size_t skipped   = 0;
+    bool exhausted        = false;
+
+    auto classBegin = entities.begin();
+    while (classBegin != entities.end()) {
+        auto priority = classBegin->priority;
+        auto classEnd = std::find_if(classBegin, entities.end(),
+                                     [priority](const ReplicatedEntity& e) { return e.priority != priority; });
+        auto start    = std::lower_bound(classBegin, classEnd, baseline.rotation(priority),
+                                         [](const ReplicatedEntity& e, EntityId id) { return e.id < id; });
+        auto count    = static_cast<std::size_t>(classEnd - classBegin);
+        auto offset   = static_cast<std::size_t>(start - classBegin);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& entity = *(classBegin + static_cast<std::ptrdiff_t>((offset + i) % count));
+            const auto* prev   = hasBaseline ? baseline.find(entity.id, entity.generation) : nullptr;
+            std::uint16_t mask = entity.fields;
+            if (prev != nullptr)
+                mask &= SnapshotCodec::changedFields(entity.state, *prev) | baseline.pendingMask(entity.id);
+            if (mask == 0)
+                continue;
+            if (exhausted) {
+                ++skipped;
+                continue;
+            }
+
+            EntityHeader header{entity.id, mask, prev != nullptr};
+            std::size_t bits = SnapshotCodec::entityBits(entity.id, hasBaseline, header, entity.state, prev);
+            if (!selected.empty() && totalBits + bits > budgetBits) {
+                exhausted = true;
+                baseline.setRotation(priority, entity.id);
+                ++skipped;
+                continue;
+            }
+            totalBits += bits;
+            selected.push_back(WireEntity{header, entity.state, prev});
+            sent.push_back(SentEntityState{entity.id, entity.generation, mask, header.delta, entity.state});
+        }
+        classBegin = classEnd;
+    }
+
+    if (deferred != nullptr)
+        *deferred = skipped;
+    if (selected.empty())
+        return {};
+
+    encodeEntities(buffers, tick, baselineTick);
+    const std::size_t single = selected.size() == 1 ? std::max(byteBudget, 2 + buffers.stream.byteCount()) : byteBudget;
+    writeStream(buffers, tick, single, byteBudget);
+    baseline.record(tick, hasBaseline, sent);
+    return buffers.packets.batch();
+}
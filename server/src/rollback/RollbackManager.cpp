@@ -6,76 +6,42 @@
 #include "components/ScoreComponent.hpp"
 #include "components/TransformComponent.hpp"
 #include "components/VelocityComponent.hpp"
-#include "core/EntityTypeResolver.hpp"
 #include "ecs/Registry.hpp"
-#include "replication/EntityStateCache.hpp"
 
 #include <algorithm>
 
-RollbackManager::RollbackManager() = default;
+RollbackManager::RollbackManager(std::size_t historyTicks) : stateHistory_(historyTicks) {}
 
-std::unordered_map<EntityId, CachedEntityState> RollbackManager::extractEntityStates(const Registry& registry) const
+std::uint32_t RollbackManager::captureState(std::uint64_t tick, const Registry& registry)
 {
-    std::unordered_map<EntityId, CachedEntityState> states;
-
-    for (EntityId id = 0; id < registry.nextId_; id++) {
-        if (!registry.isAlive(id) || !registry.has<TransformComponent>(id)) {
-            continue;
-        }
-
-        CachedEntityState state{};
-        const auto& transform = registry.get<TransformComponent>(id);
-        state.posX            = transform.x;
-        state.posY            = transform.y;
-        state.entityType      = resolveEntityType(registry, id);
-
-        if (registry.has<VelocityComponent>(id)) {
-            const auto& velocity = registry.get<VelocityComponent>(id);
-            state.velX           = velocity.vx;
-            state.velY           = velocity.vy;
-        }
-
-        if (registry.has<HealthComponent>(id)) {
-            state.health = static_cast<std::int16_t>(registry.get<HealthComponent>(id).current);
-        }
-
-        if (registry.has<LivesComponent>(id)) {
-            state.lives = static_cast<std::int8_t>(registry.get<LivesComponent>(id).current);
-        }
+    std::lock_guard<std::mutex> lock(historyMutex_);
 
-        if (registry.has<ScoreComponent>(id)) {
-            state.score = registry.get<ScoreComponent>(id).value;
-        }
+    captureFrame(registry, tick, frame_);
 
-        state.status = 0;
-        if (registry.has<InvincibilityComponent>(id)) {
-            state.status |= (1 << 1);
-        }
+    StateChecksum::update(stateHash_, frame_);
+    std::uint32_t checksum = stateHash_.value();
 
-        state.initialized = true;
-        states[id]        = state;
-    }
+    stateHistory_.addSnapshot(tick, frame_, checksum);
 
-    return states;
+    return checksum;
 }
 
-std::uint32_t RollbackManager::captureState(std::uint64_t tick, const Registry& registry)
+std::uint32_t RollbackManager::captureState(const CaptureFrame& frame)
 {
     std::lock_guard<std::mutex> lock(historyMutex_);
 
-    auto states = extractEntityStates(registry);
+    StateChecksum::update(stateHash_, frame);
+    std::uint32_t checksum = stateHash_.value();
 
-    std::uint32_t checksum = StateChecksum::compute(states);
-
-    stateHistory_.addSnapshot(tick, states, checksum);
+    stateHistory_.addSnapshot(frame.tick, frame, checksum);
 
     return checksum;
 }
 
-std::optional<std::reference_wrapper<const StateSnapshot>> RollbackManager::getSnapshot(std::uint64_t tick) const
+bool RollbackManager::getSnapshot(std::uint64_t tick, StateSnapshot& out) const
 {
     std::lock_guard<std::mutex> lock(historyMutex_);
-    return stateHistory_.getSnapshot(tick);
+    return stateHistory_.getSnapshot(tick, out);
 }
 
 bool RollbackManager::canRollbackTo(std::uint64_t tick) const
@@ -87,11 +53,7 @@ bool RollbackManager::canRollbackTo(std::uint64_t tick) const
 std::optional<std::uint32_t> RollbackManager::getChecksum(std::uint64_t tick) const
 {
     std::lock_guard<std::mutex> lock(historyMutex_);
-    auto snapshot = stateHistory_.getSnapshot(tick);
-    if (snapshot) {
-        return snapshot->get().checksum;
-    }
-    return std::nullopt;
+    return stateHistory_.getChecksum(tick);
 }
 
 std::optional<std::pair<std::uint64_t, std::uint64_t>> RollbackManager::getTickRange() const
@@ -100,12 +62,12 @@ std::optional<std::pair<std::uint64_t, std::uint64_t>> RollbackManager::getTickR
     return stateHistory_.getTickRange();
 }
 
-void RollbackManager::restoreEntityStates(Registry& registry,
-                                          const std::unordered_map<EntityId, CachedEntityState>& states) const
+void RollbackManager::restoreEntityStates(Registry& registry, const StateSnapshot& snapshot) const
 {
     std::vector<EntityId> entitiesToDestroy;
     for (EntityId id = 0; id < registry.nextId_; id++) {
-        if (registry.isAlive(id) && registry.has<TransformComponent>(id) && states.find(id) == states.end()) {
+        if (registry.isAlive(id) && registry.has<TransformComponent>(id) &&
+            !std::binary_search(snapshot.ids.begin(), snapshot.ids.end(), id)) {
             entitiesToDestroy.push_back(id);
         }
     }
@@ -113,7 +75,9 @@ void RollbackManager::restoreEntityStates(Registry& registry,
         registry.destroyEntity(id);
     }
 
-    for (const auto& [id, state] : states) {
+    for (std::size_t i = 0; i < snapshot.ids.size(); i++) {
+        const EntityId id = snapshot.ids[i];
+        const auto& state = snapshot.states[i];
         if (!state.initialized) {
             continue;
         }
@@ -170,12 +134,11 @@ bool RollbackManager::rollbackTo(std::uint64_t tick, Registry& registry)
 {
     std::lock_guard<std::mutex> lock(historyMutex_);
 
-    auto snapshot = stateHistory_.getSnapshot(tick);
-    if (!snapshot) {
+    if (!stateHistory_.getSnapshot(tick, restored_)) {
         return false;
     }
 
-    restoreEntityStates(registry, snapshot->get().entities);
+    restoreEntityStates(registry, restored_);
     return true;
 }
 
@@ -183,6 +146,7 @@ void RollbackManager::clear()
 {
     std::lock_guard<std::mutex> lock(historyMutex_);
     stateHistory_.clear();
+    stateHash_.clear();
 }
 
 std::size_t RollbackManager::getHistorySize() const
@@ -2,10 +2,26 @@
 
 #include "core/EntityTypeResolver.hpp"
 
-GameWorld::GameWorld()
-    : playerInputSys_(250.0F, 400.0F, 2.0F, 10), movementSys_(), monsterMovementSys_(), enemyShootingSys_(),
-      collisionSys_(), damageSys_(eventBus_), scoreSys_(eventBus_, registry_), destructionSys_(eventBus_),
-      boundarySys_(), introCinematic_()
+namespace
+{
+#ifdef RTYPE_ECS_ARCHETYPE_STORAGE
+    constexpr StorageMode kWorldStorageMode = StorageMode::Archetype;
+#else
+    constexpr StorageMode kWorldStorageMode = StorageMode::SparseSet;
+#endif
+} // namespace
+
+GameWorld::GameWorld() : GameWorld(kWorldStorageMode) {}
+
+StorageMode GameWorld::defaultStorageMode()
+{
+    return kWorldStorageMode;
+}
+
+GameWorld::GameWorld(StorageMode mode)
+    : registry_(mode), playerInputSys_(250.0F, 400.0F, 2.0F, 10), movementSys_(), monsterMovementSys_(),
+      enemyShootingSys_(), collisionSys_(), damageSys_(eventBus_), scoreSys_(eventBus_, registry_),
+      destructionSys_(eventBus_), boundarySys_(), introCinematic_()
 {}
 
 void GameWorld::tick(float deltaTime, const std::vector<PlayerCommand>& commands,
@@ -20,7 +36,8 @@ void GameWorld::tick(float deltaTime, const std::vector<PlayerCommand>& commands
 
     movementSys_.update(registry_, deltaTime);
     boundarySys_.update(registry_);
-    monsterMovementSys_.update(registry_, deltaTime);
+    playerIndex_.rebuild(registry_, playerEntities);
+    monsterMovementSys_.update(registry_, playerIndex_, deltaTime);
 
     if (levelLoaded_ && levelDirector_ && levelSpawnSys_) {
         const auto* segment = levelDirector_->currentSegment();
@@ -34,13 +51,16 @@ void GameWorld::tick(float deltaTime, const std::vector<PlayerCommand>& commands
         auto events = levelDirector_->consumeEvents();
         levelSpawnSys_->update(registry_, levelDelta, events);
         playerBoundsSys_.update(registry_, levelDirector_->playerBounds());
+        if (const auto& bounds = levelDirector_->playerBounds())
+            collisionSys_.setBounds(*bounds);
     } else {
         playerBoundsSys_.update(registry_, std::nullopt);
     }
 
-    enemyShootingSys_.update(registry_, deltaTime);
+    playerIndex_.refresh(registry_);
+    enemyShootingSys_.update(registry_, playerIndex_, deltaTime);
 
-    auto collisions = collisionSys_.detect(registry_);
+    const auto& collisions = collisionSys_.detect(registry_);
     damageSys_.apply(registry_, collisions);
 
     trackEntityLifecycle();
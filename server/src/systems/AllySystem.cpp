@@ -3,11 +3,13 @@
 #include "Logger.hpp"
 #include "components/AllyComponent.hpp"
 #include "components/Components.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <vector>
 
-void AllySystem::update(Registry& registry, float deltaTime)
+void AllySystem::update(Registry& registry, const PlayerIndex& players, float deltaTime)
 {
+    PROFILE_ZONE("system.ally");
     std::vector<EntityId> toDestroy;
 
     for (EntityId allyId : registry.view<AllyComponent, TransformComponent>()) {
@@ -16,30 +18,13 @@ void AllySystem::update(Registry& registry, float deltaTime)
 
         auto& ally = registry.get<AllyComponent>(allyId);
 
-        EntityId ownerId = 0;
-        bool ownerFound  = false;
-        for (EntityId playerId : registry.view<TagComponent, TransformComponent>()) {
-            if (!registry.isAlive(playerId))
-                continue;
-            const auto& tag = registry.get<TagComponent>(playerId);
-            if (!tag.hasTag(EntityTag::Player))
-                continue;
-            if (!registry.has<OwnershipComponent>(playerId))
-                continue;
-            const auto& ownership = registry.get<OwnershipComponent>(playerId);
-            if (ownership.ownerId == ally.ownerId) {
-                ownerId    = playerId;
-                ownerFound = true;
-                break;
-            }
-        }
-
-        if (!ownerFound) {
+        auto owner = players.findByOwner(ally.ownerId);
+        if (!owner) {
             toDestroy.push_back(allyId);
             continue;
         }
 
-        const auto& ownerTransform = registry.get<TransformComponent>(ownerId);
+        const auto& ownerTransform = registry.get<TransformComponent>(*owner);
 
         if (ownerTransform.y < -1000.0F) {
             continue;
@@ -51,12 +36,14 @@ void AllySystem::update(Registry& registry, float deltaTime)
 
         ally.shootTimer += deltaTime;
         if (ally.shootTimer >= AllyComponent::kShootInterval) {
-            ally.shootTimer  = 0.0F;
-            EntityId missile = registry.createEntity();
+            ally.shootTimer    = 0.0F;
+            EntityId missile   = registry.createEntity();
+            const float spawnX = allyTransform.x + 20.0F;
+            const float spawnY = allyTransform.y + 3.0F;
 
             auto& mt = registry.emplace<TransformComponent>(missile);
-            mt.x     = allyTransform.x + 20.0F;
-            mt.y     = allyTransform.y + 3.0F;
+            mt.x     = spawnX;
+            mt.y     = spawnY;
 
             auto& mv = registry.emplace<VelocityComponent>(missile);
             mv.vx    = kMissileSpeed;
@@ -71,7 +58,7 @@ void AllySystem::update(Registry& registry, float deltaTime)
             registry.emplace<HitboxComponent>(missile, HitboxComponent::create(20.0F, 20.0F, 0.0F, 0.0F, true));
 
             Logger::instance().info("[Ally] Ally (owner=" + std::to_string(ally.ownerId) + ") fired missile at (" +
-                                    std::to_string(mt.x) + ", " + std::to_string(mt.y) + ")");
+                                    std::to_string(spawnX) + ", " + std::to_string(spawnY) + ")");
         }
     }
 
@@ -0,0 +1,136 @@
+#include "systems/CollisionKernels.hpp"
+
+#if !defined(RTYPE_COLLISION_SCALAR) && defined(__AVX2__)
+    #define RTYPE_COLLISION_AVX2
+    #include <immintrin.h>
+#elif !defined(RTYPE_COLLISION_SCALAR) && (defined(__SSE2__) || defined(_M_X64))
+    #define RTYPE_COLLISION_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    bool aabbHit(const CollisionBatch& b, std::size_t k, const std::array<float, 4>& box)
+    {
+        return !(box[1] < b.minX[k] || box[0] > b.maxX[k] || box[3] < b.minY[k] || box[2] > b.maxY[k]);
+    }
+
+    bool circleHit(const CollisionBatch& b, std::size_t k, float cx, float cy, float r)
+    {
+        float dx   = cx - b.centerX[k];
+        float dy   = cy - b.centerY[k];
+        float sum  = r + b.radius[k];
+        float dist = dx * dx + dy * dy;
+        return dist <= sum * sum;
+    }
+
+#if defined(RTYPE_COLLISION_AVX2) || defined(RTYPE_COLLISION_SSE2)
+    void writeMask(int mask, std::size_t count, std::uint8_t* hits)
+    {
+        for (std::size_t l = 0; l < count; ++l) {
+            hits[l] = static_cast<std::uint8_t>(((mask >> l) & 1) == 0 ? 1 : 0);
+        }
+    }
+#endif
+} // namespace
+
+const char* CollisionKernels::backend()
+{
+#if defined(RTYPE_COLLISION_AVX2)
+    return "avx2";
+#elif defined(RTYPE_COLLISION_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+std::size_t CollisionKernels::lanes()
+{
+#if defined(RTYPE_COLLISION_AVX2)
+    return 8;
+#elif defined(RTYPE_COLLISION_SSE2)
+    return 4;
+#else
+    return 1;
+#endif
+}
+
+void CollisionKernels::overlapAabbScalar(const CollisionBatch& batch, std::size_t begin, std::size_t end,
+                                         const std::array<float, 4>& box, std::uint8_t* hits)
+{
+    for (std::size_t k = begin; k < end; ++k) {
+        hits[k - begin] = aabbHit(batch, k, box) ? 1 : 0;
+    }
+}
+
+void CollisionKernels::overlapCircleScalar(const CollisionBatch& batch, std::size_t begin, std::size_t end,
+                                           float centerX, float centerY, float radius, std::uint8_t* hits)
+{
+    for (std::size_t k = begin; k < end; ++k) {
+        hits[k - begin] = circleHit(batch, k, centerX, centerY, radius) ? 1 : 0;
+    }
+}
+
+void CollisionKernels::overlapAabb(const CollisionBatch& batch, std::size_t begin, std::size_t end,
+                                   const std::array<float, 4>& box, std::uint8_t* hits)
+{
+    std::size_t k = begin;
+#if defined(RTYPE_COLLISION_AVX2)
+    const __m256 minX = _mm256_set1_ps(box[0]);
+    const __m256 maxX = _mm256_set1_ps(box[1]);
+    const __m256 minY = _mm256_set1_ps(box[2]);
+    const __m256 maxY = _mm256_set1_ps(box[3]);
+    for (; k + 8 <= end; k += 8) {
+        __m256 apart = _mm256_or_ps(_mm256_cmp_ps(maxX, _mm256_loadu_ps(batch.minX + k), _CMP_LT_OQ),
+                                    _mm256_cmp_ps(minX, _mm256_loadu_ps(batch.maxX + k), _CMP_GT_OQ));
+        apart        = _mm256_or_ps(apart, _mm256_cmp_ps(maxY, _mm256_loadu_ps(batch.minY + k), _CMP_LT_OQ));
+        apart        = _mm256_or_ps(apart, _mm256_cmp_ps(minY, _mm256_loadu_ps(batch.maxY + k), _CMP_GT_OQ));
+        writeMask(_mm256_movemask_ps(apart), 8, hits + (k - begin));
+    }
+#elif defined(RTYPE_COLLISION_SSE2)
+    const __m128 minX = _mm_set1_ps(box[0]);
+    const __m128 maxX = _mm_set1_ps(box[1]);
+    const __m128 minY = _mm_set1_ps(box[2]);
+    const __m128 maxY = _mm_set1_ps(box[3]);
+    for (; k + 4 <= end; k += 4) {
+        __m128 apart = _mm_or_ps(_mm_cmplt_ps(maxX, _mm_loadu_ps(batch.minX + k)),
+                                 _mm_cmpgt_ps(minX, _mm_loadu_ps(batch.maxX + k)));
+        apart        = _mm_or_ps(apart, _mm_cmplt_ps(maxY, _mm_loadu_ps(batch.minY + k)));
+        apart        = _mm_or_ps(apart, _mm_cmpgt_ps(minY, _mm_loadu_ps(batch.maxY + k)));
+        writeMask(_mm_movemask_ps(apart), 4, hits + (k - begin));
+    }
+#endif
+    overlapAabbScalar(batch, k, end, box, hits + (k - begin));
+}
+
+void CollisionKernels::overlapCircle(const CollisionBatch& batch, std::size_t begin, std::size_t end, float centerX,
+                                     float centerY, float radius, std::uint8_t* hits)
+{
+    std::size_t k = begin;
+#if defined(RTYPE_COLLISION_AVX2)
+    const __m256 cx = _mm256_set1_ps(centerX);
+    const __m256 cy = _mm256_set1_ps(centerY);
+    const __m256 r  = _mm256_set1_ps(radius);
+    for (; k + 8 <= end; k += 8) {
+        __m256 dx   = _mm256_sub_ps(cx, _mm256_loadu_ps(batch.centerX + k));
+        __m256 dy   = _mm256_sub_ps(cy, _mm256_loadu_ps(batch.centerY + k));
+        __m256 sum  = _mm256_add_ps(r, _mm256_loadu_ps(batch.radius + k));
+        __m256 dist = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        writeMask(_mm256_movemask_ps(_mm256_cmp_ps(dist, _mm256_mul_ps(sum, sum), _CMP_NLE_UQ)), 8,
+                  hits + (k - begin));
+    }
+#elif defined(RTYPE_COLLISION_SSE2)
+    const __m128 cx = _mm_set1_ps(centerX);
+    const __m128 cy = _mm_set1_ps(centerY);
+    const __m128 r  = _mm_set1_ps(radius);
+    for (; k + 4 <= end; k += 4) {
+        __m128 dx   = _mm_sub_ps(cx, _mm_loadu_ps(batch.centerX + k));
+        __m128 dy   = _mm_sub_ps(cy, _mm_loadu_ps(batch.centerY + k));
+        __m128 sum  = _mm_add_ps(r, _mm_loadu_ps(batch.radius + k));
+        __m128 dist = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        writeMask(_mm_movemask_ps(_mm_cmpnle_ps(dist, _mm_mul_ps(sum, sum))), 4, hits + (k - begin));
+    }
+#endif
+    overlapCircleScalar(batch, k, end, centerX, centerY, radius, hits + (k - begin));
+}
@@ -1,33 +1,19 @@
 #include "systems/CollisionSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
+#include <algorithm>
 #include <cmath>
 #include <limits>
-#include <optional>
 
 namespace
 {
-    struct Vec2
-    {
-        float x = 0.0F;
-        float y = 0.0F;
-    };
-
-    struct Shape
-    {
-        ColliderComponent::Shape type = ColliderComponent::Shape::Box;
-        bool active                   = false;
-        std::vector<Vec2> points;
-        Vec2 center{};
-        float radius = 0.0F;
-        std::array<float, 4> aabb{};
-    };
-
     bool finite(float v)
     {
         return std::isfinite(v);
     }
 
-    bool normalize(Vec2& v)
+    bool normalize(CollisionPoint& v)
     {
         float len = std::sqrt(v.x * v.x + v.y * v.y);
         if (len <= 0.0F || !std::isfinite(len))
@@ -37,19 +23,19 @@ namespace
         return true;
     }
 
-    std::array<float, 2> projectPolygon(const std::vector<Vec2>& pts, const Vec2& axis)
+    std::array<float, 2> projectPolygon(const CollisionShape& s, const CollisionPoint& axis)
     {
         float min = std::numeric_limits<float>::infinity();
         float max = -std::numeric_limits<float>::infinity();
-        for (const auto& p : pts) {
-            float proj = p.x * axis.x + p.y * axis.y;
+        for (std::size_t i = 0; i < s.pointCount; ++i) {
+            float proj = s.points[i].x * axis.x + s.points[i].y * axis.y;
             min        = std::min(min, proj);
             max        = std::max(max, proj);
         }
         return {min, max};
     }
 
-    std::array<float, 2> projectCircle(const Vec2& center, float radius, const Vec2& axis)
+    std::array<float, 2> projectCircle(const CollisionPoint& center, float radius, const CollisionPoint& axis)
     {
         float proj = center.x * axis.x + center.y * axis.y;
         return {proj - radius, proj + radius};
@@ -60,168 +46,129 @@ namespace
         return !(a[1] < b[0] || b[1] < a[0]);
     }
 
-    bool polygonPolygon(const std::vector<Vec2>& a, const std::vector<Vec2>& b)
+    bool overlapsOnNormals(const CollisionShape& axes, const CollisionShape& a, const CollisionShape& b)
     {
-        auto checkAxes = [&](const std::vector<Vec2>& poly1, const std::vector<Vec2>& poly2) {
-            for (std::size_t i = 0; i < poly1.size(); ++i) {
-                const auto& p1 = poly1[i];
-                const auto& p2 = poly1[(i + 1) % poly1.size()];
-                Vec2 edge{p2.x - p1.x, p2.y - p1.y};
-                Vec2 axis{-edge.y, edge.x};
-                if (!normalize(axis))
-                    continue;
-                auto projA = projectPolygon(poly1, axis);
-                auto projB = projectPolygon(poly2, axis);
-                if (!rangesOverlap(projA, projB))
-                    return false;
-            }
-            return true;
-        };
+        for (std::size_t i = 0; i < axes.normalCount; ++i) {
+            if (!rangesOverlap(projectPolygon(a, axes.normals[i]), projectPolygon(b, axes.normals[i])))
+                return false;
+        }
+        return true;
+    }
 
-        return checkAxes(a, b) && checkAxes(b, a);
+    bool polygonPolygon(const CollisionShape& a, const CollisionShape& b)
+    {
+        return overlapsOnNormals(a, a, b) && overlapsOnNormals(b, b, a);
     }
 
-    float distanceSquared(const Vec2& a, const Vec2& b)
+    float distanceSquared(const CollisionPoint& a, const CollisionPoint& b)
     {
         float dx = a.x - b.x;
         float dy = a.y - b.y;
         return dx * dx + dy * dy;
     }
 
-    bool circleCircle(const Shape& a, const Shape& b)
+    bool circleCircle(const CollisionShape& a, const CollisionShape& b)
     {
         float r = a.radius + b.radius;
         return distanceSquared(a.center, b.center) <= r * r;
     }
 
-    bool circlePolygon(const Shape& circle, const Shape& poly)
+    bool circlePolygon(const CollisionShape& circle, const CollisionShape& poly)
     {
-        if (poly.points.empty())
+        if (poly.pointCount == 0)
             return false;
         float bestDist = std::numeric_limits<float>::infinity();
-        Vec2 closest{};
-        for (const auto& p : poly.points) {
-            float d = distanceSquared(circle.center, p);
+        CollisionPoint closest{};
+        for (std::size_t i = 0; i < poly.pointCount; ++i) {
+            float d = distanceSquared(circle.center, poly.points[i]);
             if (d < bestDist) {
                 bestDist = d;
-                closest  = p;
+                closest  = poly.points[i];
             }
         }
 
-        std::vector<Vec2> axes;
-        axes.reserve(poly.points.size() + 1);
-        for (std::size_t i = 0; i < poly.points.size(); ++i) {
-            const auto& p1 = poly.points[i];
-            const auto& p2 = poly.points[(i + 1) % poly.points.size()];
-            Vec2 edge{p2.x - p1.x, p2.y - p1.y};
-            Vec2 axis{-edge.y, edge.x};
-            if (normalize(axis))
-                axes.push_back(axis);
+        for (std::size_t i = 0; i < poly.normalCount; ++i) {
+            auto projCircle = projectCircle(circle.center, circle.radius, poly.normals[i]);
+            auto projPoly   = projectPolygon(poly, poly.normals[i]);
+            if (!rangesOverlap(projCircle, projPoly))
+                return false;
         }
-        Vec2 axisToVertex{closest.x - circle.center.x, closest.y - circle.center.y};
-        if (normalize(axisToVertex))
-            axes.push_back(axisToVertex);
-
-        for (const auto& axis : axes) {
-            auto projCircle = projectCircle(circle.center, circle.radius, axis);
-            auto projPoly   = projectPolygon(poly.points, axis);
+        CollisionPoint axisToVertex{closest.x - circle.center.x, closest.y - circle.center.y};
+        if (normalize(axisToVertex)) {
+            auto projCircle = projectCircle(circle.center, circle.radius, axisToVertex);
+            auto projPoly   = projectPolygon(poly, axisToVertex);
             if (!rangesOverlap(projCircle, projPoly))
                 return false;
         }
         return true;
     }
 
-    bool hasCollisionData(const ColliderComponent* collider, const HitboxComponent* hitbox)
+    bool validSource(const CollisionShapeSource& s)
     {
-        return collider != nullptr || hitbox != nullptr;
+        return finite(s.x) && finite(s.y) && finite(s.scaleX) && finite(s.scaleY);
     }
 
-    bool validTransform(const TransformComponent& t)
+    CollisionPoint toWorld(const CollisionShapeSource& s, float px, float py)
     {
-        return finite(t.x) && finite(t.y) && finite(t.scaleX) && finite(t.scaleY);
+        return CollisionPoint{s.x + (px + s.offsetX) * s.scaleX, s.y + (py + s.offsetY) * s.scaleY};
     }
 
-    Shape seedShape(const ColliderComponent* collider, const HitboxComponent* hitbox)
+    void addPoint(CollisionShape& shape, CollisionPoint point)
     {
-        Shape s{};
-        if (collider != nullptr) {
-            s.active = collider->isActive;
-            s.type   = collider->shape;
-        } else {
-            s.active = hitbox->isActive;
-            s.type   = ColliderComponent::Shape::Box;
-        }
-        return s;
+        shape.points[shape.pointCount++] = point;
     }
 
-    Vec2 toWorld(const TransformComponent& t, float px, float py, float ox, float oy, float sx, float sy)
+    bool buildBoxShape(const CollisionShapeSource& src, CollisionShape& s)
     {
-        return Vec2{t.x + (px + ox) * sx, t.y + (py + oy) * sy};
+        if (src.width <= 0.0F || src.height <= 0.0F || !finite(src.width) || !finite(src.height) ||
+            !finite(src.offsetX) || !finite(src.offsetY))
+            return false;
+        addPoint(s, toWorld(src, 0.0F, 0.0F));
+        addPoint(s, toWorld(src, src.width, 0.0F));
+        addPoint(s, toWorld(src, src.width, src.height));
+        addPoint(s, toWorld(src, 0.0F, src.height));
+        return true;
     }
 
-    std::optional<Shape> buildBoxShape(const TransformComponent& t, Shape s, bool hasCollider,
-                                       const ColliderComponent* collider, const HitboxComponent* hitbox, float sx,
-                                       float sy)
+    bool buildCircleShape(const CollisionShapeSource& src, CollisionShape& s)
     {
-        float w  = hasCollider ? collider->width : hitbox->width;
-        float h  = hasCollider ? collider->height : hitbox->height;
-        float ox = hasCollider ? collider->offsetX : hitbox->offsetX;
-        float oy = hasCollider ? collider->offsetY : hitbox->offsetY;
-        if (w <= 0.0F || h <= 0.0F || !finite(w) || !finite(h) || !finite(ox) || !finite(oy))
-            return std::nullopt;
-        s.points.push_back(toWorld(t, 0.0F, 0.0F, ox, oy, sx, sy));
-        s.points.push_back(toWorld(t, w, 0.0F, ox, oy, sx, sy));
-        s.points.push_back(toWorld(t, w, h, ox, oy, sx, sy));
-        s.points.push_back(toWorld(t, 0.0F, h, ox, oy, sx, sy));
-        return s;
-    }
-
-    std::optional<Shape> buildCircleShape(const TransformComponent& t, Shape s, const ColliderComponent* collider,
-                                          float sx, float sy)
-    {
-        float r  = collider != nullptr ? collider->radius : 0.0F;
-        float ox = collider != nullptr ? collider->offsetX : 0.0F;
-        float oy = collider != nullptr ? collider->offsetY : 0.0F;
-        if (r <= 0.0F || !finite(r) || !finite(ox) || !finite(oy))
-            return std::nullopt;
-        float scaleFactor = std::max(std::abs(sx), std::abs(sy));
-        s.radius          = r * scaleFactor;
-        s.center          = toWorld(t, 0.0F, 0.0F, ox, oy, sx, sy);
-        return s;
-    }
-
-    std::optional<Shape> buildPolygonShape(const TransformComponent& t, Shape s, const ColliderComponent* collider,
-                                           float sx, float sy)
+        if (src.radius <= 0.0F || !finite(src.radius) || !finite(src.offsetX) || !finite(src.offsetY))
+            return false;
+        float scaleFactor = std::max(std::abs(src.scaleX), std::abs(src.scaleY));
+        s.radius          = src.radius * scaleFactor;
+        s.center          = toWorld(src, 0.0F, 0.0F);
+        return true;
+    }
+
+    bool buildPolygonShape(const CollisionShapeSource& src, CollisionShape& s)
     {
-        if (collider == nullptr || collider->points.empty())
-            return std::nullopt;
-        float ox = collider->offsetX;
-        float oy = collider->offsetY;
-        if (!finite(ox) || !finite(oy))
-            return std::nullopt;
-        s.points.reserve(collider->points.size());
-        for (const auto& p : collider->points) {
+        if (!src.hasCollider || src.pointCount == 0)
+            return false;
+        if (!finite(src.offsetX) || !finite(src.offsetY))
+            return false;
+        for (std::size_t i = 0; i < src.pointCount; ++i) {
+            const auto& p = src.points[i];
             if (!finite(p[0]) || !finite(p[1]))
-                return std::nullopt;
-            s.points.push_back(toWorld(t, p[0], p[1], ox, oy, sx, sy));
+                return false;
+            addPoint(s, toWorld(src, p[0], p[1]));
         }
-        return s;
+        return true;
     }
 
-    bool buildAabb(Shape& s)
+    bool buildAabb(CollisionShape& s)
     {
         if (s.type != ColliderComponent::Shape::Circle) {
-            if (s.points.size() < 3)
+            if (s.pointCount < 3)
                 return false;
             float minX = std::numeric_limits<float>::infinity();
             float maxX = -std::numeric_limits<float>::infinity();
             float minY = std::numeric_limits<float>::infinity();
             float maxY = -std::numeric_limits<float>::infinity();
-            for (const auto& p : s.points) {
-                minX = std::min(minX, p.x);
-                maxX = std::max(maxX, p.x);
-                minY = std::min(minY, p.y);
-                maxY = std::max(maxY, p.y);
+            for (std::size_t i = 0; i < s.pointCount; ++i) {
+                minX = std::min(minX, s.points[i].x);
+                maxX = std::max(maxX, s.points[i].x);
+                minY = std::min(minY, s.points[i].y);
+                maxY = std::max(maxY, s.points[i].y);
             }
             s.aabb = {minX, maxX, minY, maxY};
             return true;
@@ -234,34 +181,94 @@ namespace
         return true;
     }
 
-    std::optional<Shape> buildShape(const TransformComponent& t, const ColliderComponent* collider,
-                                    const HitboxComponent* hitbox)
+    void buildNormals(CollisionShape& s)
     {
-        if (!hasCollisionData(collider, hitbox))
-            return std::nullopt;
-        Shape s      = seedShape(collider, hitbox);
-        bool hasColl = collider != nullptr;
-        if (!s.active)
-            return std::nullopt;
-        if (!validTransform(t))
-            return std::nullopt;
+        s.normalCount = 0;
+        if (s.type == ColliderComponent::Shape::Circle)
+            return;
+        for (std::size_t i = 0; i < s.pointCount; ++i) {
+            const auto& p1 = s.points[i];
+            const auto& p2 = s.points[(i + 1) % s.pointCount];
+            CollisionPoint axis{-(p2.y - p1.y), p2.x - p1.x};
+            if (normalize(axis))
+                s.normals[s.normalCount++] = axis;
+        }
+    }
 
-        const float sx = t.scaleX;
-        const float sy = t.scaleY;
+    bool buildShape(const CollisionShapeSource& src, CollisionShape& s)
+    {
+        s             = CollisionShape{};
+        s.active      = src.active;
+        s.type        = src.type;
+        s.pointCount  = 0;
+        s.normalCount = 0;
+        if (!s.active)
+            return false;
+        if (!validSource(src))
+            return false;
 
-        std::optional<Shape> built;
+        bool built = false;
         if (s.type == ColliderComponent::Shape::Box) {
-            built = buildBoxShape(t, s, hasColl, collider, hitbox, sx, sy);
+            built = buildBoxShape(src, s);
         } else if (s.type == ColliderComponent::Shape::Circle) {
-            built = buildCircleShape(t, s, collider, sx, sy);
+            built = buildCircleShape(src, s);
         } else if (s.type == ColliderComponent::Shape::Polygon) {
-            built = buildPolygonShape(t, s, collider, sx, sy);
+            built = buildPolygonShape(src, s);
+        }
+        if (!built)
+            return false;
+        if (!buildAabb(s))
+            return false;
+        buildNormals(s);
+        return true;
+    }
+
+    bool makeSource(const TransformComponent& t, const ColliderComponent* collider, const HitboxComponent* hitbox,
+                    CollisionShapeSource& out)
+    {
+        out.x           = t.x;
+        out.y           = t.y;
+        out.scaleX      = t.scaleX;
+        out.scaleY      = t.scaleY;
+        out.hasCollider = collider != nullptr;
+        out.pointCount  = 0;
+        if (collider == nullptr) {
+            out.type    = ColliderComponent::Shape::Box;
+            out.active  = hitbox->isActive;
+            out.width   = hitbox->width;
+            out.height  = hitbox->height;
+            out.offsetX = hitbox->offsetX;
+            out.offsetY = hitbox->offsetY;
+            out.radius  = 0.0F;
+            return true;
+        }
+        out.type    = collider->shape;
+        out.active  = collider->isActive;
+        out.width   = collider->width;
+        out.height  = collider->height;
+        out.offsetX = collider->offsetX;
+        out.offsetY = collider->offsetY;
+        out.radius  = collider->radius;
+        if (collider->shape == ColliderComponent::Shape::Polygon) {
+            if (collider->points.size() > CollisionShape::kMaxPoints)
+                return false;
+            out.pointCount = collider->points.size();
+            std::copy(collider->points.begin(), collider->points.end(), out.points.begin());
         }
-        if (!built.has_value())
-            return std::nullopt;
-        if (!buildAabb(*built))
-            return std::nullopt;
-        return built;
+        return true;
+    }
+
+    bool sameSource(const CollisionShapeSource& a, const CollisionShapeSource& b)
+    {
+        if (a.x != b.x || a.y != b.y || a.scaleX != b.scaleX || a.scaleY != b.scaleY)
+            return false;
+        if (a.hasCollider != b.hasCollider || a.type != b.type || a.active != b.active)
+            return false;
+        if (a.width != b.width || a.height != b.height || a.offsetX != b.offsetX || a.offsetY != b.offsetY ||
+            a.radius != b.radius || a.pointCount != b.pointCount)
+            return false;
+        return std::equal(a.points.begin(), a.points.begin() + static_cast<std::ptrdiff_t>(a.pointCount),
+                          b.points.begin());
     }
 
     bool aabbOverlap(const std::array<float, 4>& a, const std::array<float, 4>& b)
@@ -269,45 +276,179 @@ namespace
         return !(a[1] < b[0] || a[0] > b[1] || a[3] < b[2] || a[2] > b[3]);
     }
 
-    bool intersect(const Shape& a, const Shape& b)
+    bool intersect(const CollisionShape& a, const CollisionShape& b)
     {
         if (!a.active || !b.active)
             return false;
         if (!aabbOverlap(a.aabb, b.aabb))
             return false;
 
-        if (a.type == ColliderComponent::Shape::Circle && b.type == ColliderComponent::Shape::Circle)
+        const bool aCircle = a.type == ColliderComponent::Shape::Circle;
+        const bool bCircle = b.type == ColliderComponent::Shape::Circle;
+        if (aCircle && bCircle)
             return circleCircle(a, b);
-        if (a.type == ColliderComponent::Shape::Circle && b.type == ColliderComponent::Shape::Polygon)
+        if (aCircle)
             return circlePolygon(a, b);
-        if (a.type == ColliderComponent::Shape::Polygon && b.type == ColliderComponent::Shape::Circle)
+        if (bCircle)
             return circlePolygon(b, a);
-        if (a.type == ColliderComponent::Shape::Polygon && b.type == ColliderComponent::Shape::Polygon)
-            return polygonPolygon(a.points, b.points);
-        if (a.type == ColliderComponent::Shape::Circle && b.type == ColliderComponent::Shape::Box) {
-            Shape polyB = b;
-            polyB.type  = ColliderComponent::Shape::Polygon;
-            return circlePolygon(a, polyB);
+        return polygonPolygon(a, b);
+    }
+
+    int cellCoord(float value, float origin, float cellSize, int count)
+    {
+        const float cell = std::floor((value - origin) / cellSize);
+        if (!(cell > 0.0F))
+            return 0;
+        if (cell >= static_cast<float>(count - 1))
+            return count - 1;
+        return static_cast<int>(cell);
+    }
+
+    bool hasNan(const std::array<float, 4>& aabb)
+    {
+        return std::isnan(aabb[0]) || std::isnan(aabb[1]) || std::isnan(aabb[2]) || std::isnan(aabb[3]);
+    }
+
+    std::uint32_t maskForLayer(std::uint32_t layer)
+    {
+        std::uint32_t mask = CollisionLayer::None;
+        if ((layer & CollisionLayer::Player) != 0)
+            mask |= CollisionLayer::Enemy | CollisionLayer::EnemyProjectile | CollisionLayer::Obstacle |
+                    CollisionLayer::Pickup;
+        if ((layer & CollisionLayer::Enemy) != 0)
+            mask |= CollisionLayer::Player | CollisionLayer::PlayerProjectile;
+        if ((layer & CollisionLayer::PlayerProjectile) != 0)
+            mask |= CollisionLayer::Enemy | CollisionLayer::Obstacle;
+        if ((layer & CollisionLayer::EnemyProjectile) != 0)
+            mask |= CollisionLayer::Player | CollisionLayer::Obstacle;
+        if ((layer & CollisionLayer::Obstacle) != 0)
+            mask |= CollisionLayer::Player | CollisionLayer::PlayerProjectile | CollisionLayer::EnemyProjectile;
+        if ((layer & CollisionLayer::Pickup) != 0)
+            mask |= CollisionLayer::Player;
+        return mask;
+    }
+
+    std::uint32_t layerFromTags(const TagComponent& tag, const MissileComponent* missile)
+    {
+        std::uint32_t layer = CollisionLayer::None;
+        if (tag.hasTag(EntityTag::Player))
+            layer |= CollisionLayer::Player;
+        if (tag.hasTag(EntityTag::Enemy))
+            layer |= CollisionLayer::Enemy;
+        if (tag.hasTag(EntityTag::Obstacle))
+            layer |= CollisionLayer::Obstacle;
+        if (tag.hasTag(EntityTag::Pickup))
+            layer |= CollisionLayer::Pickup;
+        if (tag.hasTag(EntityTag::Background))
+            layer |= CollisionLayer::Background;
+        if (missile != nullptr)
+            layer |= missile->fromPlayer ? CollisionLayer::PlayerProjectile : CollisionLayer::EnemyProjectile;
+        else if (tag.hasTag(EntityTag::Projectile))
+            layer |= CollisionLayer::PlayerProjectile | CollisionLayer::EnemyProjectile;
+        if (layer == CollisionLayer::None)
+            layer = CollisionLayer::Neutral;
+        return layer;
+    }
+
+    void resolveLayers(CollisionShape& s, const Registry& registry, EntityId id, const ColliderComponent* collider,
+                       const HitboxComponent* hitbox)
+    {
+        const std::uint32_t layer = collider != nullptr ? collider->collisionLayer : hitbox->collisionLayer;
+        if (layer != CollisionLayer::None) {
+            s.layer = layer;
+            s.mask  = collider != nullptr ? collider->collisionMask : hitbox->collisionMask;
+            return;
         }
-        if (a.type == ColliderComponent::Shape::Box && b.type == ColliderComponent::Shape::Circle) {
-            Shape polyA = a;
-            polyA.type  = ColliderComponent::Shape::Polygon;
-            return circlePolygon(b, polyA);
+        if (!registry.has<TagComponent>(id)) {
+            s.layer = CollisionLayer::All;
+            s.mask  = CollisionLayer::All;
+            return;
         }
-        Shape polyA = a;
-        Shape polyB = b;
-        polyA.type  = ColliderComponent::Shape::Polygon;
-        polyB.type  = ColliderComponent::Shape::Polygon;
-        return polygonPolygon(polyA.points, polyB.points);
+        const MissileComponent* missile =
+            registry.has<MissileComponent>(id) ? &registry.get<MissileComponent>(id) : nullptr;
+        s.layer = layerFromTags(registry.get<TagComponent>(id), missile);
+        s.mask  = maskForLayer(s.layer);
+    }
+
+    bool compatible(const CollisionShape& a, const CollisionShape& b)
+    {
+        return CollisionLayer::compatible(a.layer, a.mask, b.layer, b.mask);
     }
 } // namespace
 
-std::vector<Collision> CollisionSystem::detect(Registry& registry) const
+CollisionSystem::CollisionSystem()
+{
+    CameraBounds bounds;
+    bounds.maxX = 1246.0F;
+    bounds.maxY = 702.0F;
+    setBounds(bounds);
+}
+
+void CollisionSystem::setBounds(const CameraBounds& bounds, float cellSize)
+{
+    const float width  = std::max(bounds.maxX - bounds.minX, 1.0F);
+    const float height = std::max(bounds.maxY - bounds.minY, 1.0F);
+    if (!finite(width) || !finite(height) || !finite(bounds.minX) || !finite(bounds.minY))
+        return;
+    cellSize = finite(cellSize) && cellSize > 0.0F ? cellSize : kDefaultCellSize;
+    while (std::ceil(width / cellSize) * std::ceil(height / cellSize) > static_cast<float>(kMaxGridCells))
+        cellSize *= 2.0F;
+    originX_  = bounds.minX;
+    originY_  = bounds.minY;
+    cellSize_ = cellSize;
+    columns_  = std::max(1, static_cast<int>(std::ceil(width / cellSize)));
+    rows_     = std::max(1, static_cast<int>(std::ceil(height / cellSize)));
+}
+
+const CollisionStats& CollisionSystem::stats() const
+{
+    return stats_;
+}
+
+template <typename T> void CollisionSystem::reserveTracked(std::vector<T>& values, std::size_t count)
+{
+    if (count <= values.capacity())
+        return;
+    ++stats_.allocations;
+    values.reserve(std::max(count, values.capacity() * 2));
+}
+
+template <typename T> void CollisionSystem::pushTracked(std::vector<T>& values, const T& value)
+{
+    reserveTracked(values, std::max<std::size_t>(values.size() + 1, 16));
+    values.push_back(value);
+}
+
+CollisionShape* CollisionSystem::cachedShape(const Registry& registry, EntityId id, const TransformComponent& transform,
+                                             const ColliderComponent* collider, const HitboxComponent* hitbox)
+{
+    CollisionShapeSource source;
+    if (!makeSource(transform, collider, hitbox, source))
+        return nullptr;
+    auto& entry                    = cache_[id];
+    const std::uint32_t generation = registry.generation(id);
+    if (entry.initialized && entry.generation == generation && sameSource(entry.source, source)) {
+        ++stats_.shapesReused;
+        return entry.valid ? &entry.shape : nullptr;
+    }
+    ++stats_.shapesRebuilt;
+    entry.initialized = true;
+    entry.generation  = generation;
+    entry.source      = source;
+    entry.valid       = buildShape(source, entry.shape);
+    return entry.valid ? &entry.shape : nullptr;
+}
+
+void CollisionSystem::gatherShapes(Registry& registry)
 {
-    std::vector<EntityId> ids;
-    std::vector<Shape> shapes;
-    ids.reserve(registry.entityCount());
-    shapes.reserve(registry.entityCount());
+    const std::size_t entityCount = registry.entityCount();
+    reserveTracked(cache_, entityCount);
+    if (cache_.size() < entityCount)
+        cache_.resize(entityCount);
+    reserveTracked(ids_, entityCount);
+    reserveTracked(shapes_, entityCount);
+    ids_.clear();
+    shapes_.clear();
 
     for (EntityId id : registry.view<TransformComponent>()) {
         if (!registry.isAlive(id))
@@ -316,20 +457,176 @@ std::vector<Collision> CollisionSystem::detect(Registry& registry) const
         const ColliderComponent* col =
             registry.has<ColliderComponent>(id) ? &registry.get<ColliderComponent>(id) : nullptr;
         const HitboxComponent* hb = registry.has<HitboxComponent>(id) ? &registry.get<HitboxComponent>(id) : nullptr;
-        auto shape                = buildShape(t, col, hb);
-        if (!shape)
+        if (col == nullptr && hb == nullptr)
+            continue;
+        CollisionShape* shape = cachedShape(registry, id, t, col, hb);
+        if (shape == nullptr)
+            continue;
+        resolveLayers(*shape, registry, id, col, hb);
+        if (shape->mask == CollisionLayer::None)
+            continue;
+        ids_.push_back(id);
+        shapes_.push_back(shape);
+    }
+}
+
+void CollisionSystem::buildGrid()
+{
+    const std::size_t cellCount = static_cast<std::size_t>(columns_) * static_cast<std::size_t>(rows_);
+    reserveTracked(ranges_, shapes_.size());
+    reserveTracked(isUnbounded_, shapes_.size());
+    reserveTracked(cellStart_, cellCount + 1);
+    ranges_.resize(shapes_.size());
+    isUnbounded_.assign(shapes_.size(), 0);
+    cellStart_.assign(cellCount + 1, 0);
+    unbounded_.clear();
+
+    for (std::size_t i = 0; i < shapes_.size(); ++i) {
+        const auto& aabb = shapes_[i]->aabb;
+        if (hasNan(aabb)) {
+            isUnbounded_[i] = 1;
+            pushTracked(unbounded_, i);
+            continue;
+        }
+        auto& r = ranges_[i];
+        r.minX  = cellCoord(aabb[0], originX_, cellSize_, columns_);
+        r.maxX  = cellCoord(aabb[1], originX_, cellSize_, columns_);
+        r.minY  = cellCoord(aabb[2], originY_, cellSize_, rows_);
+        r.maxY  = cellCoord(aabb[3], originY_, cellSize_, rows_);
+        for (int y = r.minY; y <= r.maxY; ++y) {
+            for (int x = r.minX; x <= r.maxX; ++x) {
+                ++cellStart_[static_cast<std::size_t>(y * columns_ + x) + 1];
+            }
+        }
+    }
+    for (std::size_t c = 0; c < cellCount; ++c) {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+
+    const std::size_t itemCount = cellStart_[cellCount];
+    reserveTracked(cellCursor_, cellCount);
+    for (auto* column : {&cellMinX_, &cellMaxX_, &cellMinY_, &cellMaxY_, &cellCenterX_, &cellCenterY_, &cellRadius_}) {
+        reserveTracked(*column, itemCount);
+        column->resize(itemCount);
+    }
+    reserveTracked(cellItems_, itemCount);
+    cellItems_.resize(itemCount);
+    cellCursor_.assign(cellStart_.begin(), cellStart_.end() - 1);
+    for (std::size_t i = 0; i < shapes_.size(); ++i) {
+        if (isUnbounded_[i] != 0)
             continue;
-        ids.push_back(id);
-        shapes.push_back(*shape);
+        const auto& r     = ranges_[i];
+        const auto& shape = *shapes_[i];
+        for (int y = r.minY; y <= r.maxY; ++y) {
+            for (int x = r.minX; x <= r.maxX; ++x) {
+                const std::size_t slot = cellCursor_[static_cast<std::size_t>(y * columns_ + x)]++;
+                cellItems_[slot]       = i;
+                cellMinX_[slot]        = shape.aabb[0];
+                cellMaxX_[slot]        = shape.aabb[1];
+                cellMinY_[slot]        = shape.aabb[2];
+                cellMaxY_[slot]        = shape.aabb[3];
+                cellCenterX_[slot]     = shape.center.x;
+                cellCenterY_[slot]     = shape.center.y;
+                cellRadius_[slot]      = shape.radius;
+            }
+        }
     }
+}
+
+CollisionBatch CollisionSystem::cellBatch() const
+{
+    CollisionBatch batch;
+    batch.minX    = cellMinX_.data();
+    batch.maxX    = cellMaxX_.data();
+    batch.minY    = cellMinY_.data();
+    batch.maxY    = cellMaxY_.data();
+    batch.centerX = cellCenterX_.data();
+    batch.centerY = cellCenterY_.data();
+    batch.radius  = cellRadius_.data();
+    return batch;
+}
 
-    std::vector<Collision> out;
-    for (std::size_t i = 0; i < ids.size(); ++i) {
-        for (std::size_t j = i + 1; j < ids.size(); ++j) {
-            if (intersect(shapes[i], shapes[j])) {
-                out.push_back(Collision{ids[i], ids[j]});
+void CollisionSystem::collectCell(std::size_t begin, std::size_t end, int x, int y)
+{
+    const CollisionBatch batch = cellBatch();
+    for (std::size_t a = begin; a + 1 < end; ++a) {
+        const std::size_t i       = cellItems_[a];
+        const CollisionShape& lhs = *shapes_[i];
+        const bool circle         = lhs.type == ColliderComponent::Shape::Circle;
+        CollisionKernels::overlapAabb(batch, a + 1, end, lhs.aabb, aabbHits_.data());
+        if (circle)
+            CollisionKernels::overlapCircle(batch, a + 1, end, lhs.center.x, lhs.center.y, lhs.radius,
+                                            circleHits_.data());
+        for (std::size_t b = a + 1; b < end; ++b) {
+            if (aabbHits_[b - a - 1] == 0)
+                continue;
+            const std::size_t j = cellItems_[b];
+            if (std::max(ranges_[i].minX, ranges_[j].minX) != x || std::max(ranges_[i].minY, ranges_[j].minY) != y)
+                continue;
+            const CollisionShape& rhs = *shapes_[j];
+            if (!compatible(lhs, rhs))
+                continue;
+            Candidate candidate{i, j, false};
+            if (lhs.type == ColliderComponent::Shape::Box && rhs.type == ColliderComponent::Shape::Box) {
+                candidate.resolved = true;
+            } else if (circle && rhs.type == ColliderComponent::Shape::Circle) {
+                if (circleHits_[b - a - 1] == 0)
+                    continue;
+                candidate.resolved = true;
             }
+            pushTracked(candidates_, candidate);
+        }
+    }
+}
+
+void CollisionSystem::collectCandidates()
+{
+    candidates_.clear();
+    std::size_t widest = 0;
+    for (std::size_t c = 0; c + 1 < cellStart_.size(); ++c) {
+        widest = std::max(widest, cellStart_[c + 1] - cellStart_[c]);
+    }
+    reserveTracked(aabbHits_, widest);
+    reserveTracked(circleHits_, widest);
+    aabbHits_.resize(widest);
+    circleHits_.resize(widest);
+
+    for (int y = 0; y < rows_; ++y) {
+        for (int x = 0; x < columns_; ++x) {
+            const auto cell = static_cast<std::size_t>(y * columns_ + x);
+            collectCell(cellStart_[cell], cellStart_[cell + 1], x, y);
+        }
+    }
+    for (std::size_t u : unbounded_) {
+        for (std::size_t k = 0; k < shapes_.size(); ++k) {
+            if (k == u || (isUnbounded_[k] != 0 && k < u) || !compatible(*shapes_[u], *shapes_[k]))
+                continue;
+            pushTracked(candidates_, Candidate{std::min(u, k), std::max(u, k), false});
+        }
+    }
+    std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& lhs, const Candidate& rhs) {
+        return lhs.a != rhs.a ? lhs.a < rhs.a : lhs.b < rhs.b;
+    });
+}
+
+const std::vector<Collision>& CollisionSystem::detect(Registry& registry)
+{
+    PROFILE_ZONE("collision.detect");
+    gatherShapes(registry);
+    buildGrid();
+    collectCandidates();
+
+    collisions_.clear();
+    for (const auto& candidate : candidates_) {
+        bool hit = candidate.resolved;
+        if (candidate.resolved) {
+            ++stats_.batchedPairs;
+        } else {
+            ++stats_.satPairs;
+            hit = intersect(*shapes_[candidate.a], *shapes_[candidate.b]);
         }
+        if (hit)
+            pushTracked(collisions_, Collision{ids_[candidate.a], ids_[candidate.b]});
     }
-    return out;
+    return collisions_;
 }
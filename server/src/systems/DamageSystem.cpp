@@ -5,6 +5,7 @@
 #include "components/RenderTypeComponent.hpp"
 #include "components/ShieldComponent.hpp"
 #include "network/EntityDestroyedPacket.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <string>
 
@@ -27,17 +28,13 @@ namespace
 
     std::string tagLabel(const Registry& registry, EntityId id)
     {
-        if (!registry.has<TagComponent>(id)) {
-            return "Target";
-        }
-        const auto& tag = registry.get<TagComponent>(id);
-        if (tag.hasTag(EntityTag::Player))
+        if (registry.hasTag(id, EntityTag::Player))
             return "Player";
-        if (tag.hasTag(EntityTag::Obstacle))
+        if (registry.hasTag(id, EntityTag::Obstacle))
             return "Obstacle";
-        if (tag.hasTag(EntityTag::Enemy))
+        if (registry.hasTag(id, EntityTag::Enemy))
             return "Enemy";
-        if (tag.hasTag(EntityTag::Projectile))
+        if (registry.hasTag(id, EntityTag::Projectile))
             return "Projectile";
         return "Target";
     }
@@ -72,6 +69,7 @@ namespace
 
 void DamageSystem::apply(Registry& registry, const std::vector<Collision>& collisions)
 {
+    PROFILE_ZONE("collision.damage");
     std::vector<EntityId> missilesToDestroy;
 
     for (const auto& col : collisions) {
@@ -1,9 +1,12 @@
 #include "systems/DestructionSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 DestructionSystem::DestructionSystem(EventBus& bus) : bus_(bus) {}
 
 void DestructionSystem::update(Registry& registry, const std::vector<EntityId>& toDestroy)
 {
+    PROFILE_ZONE("system.destruction");
     for (EntityId id : toDestroy) {
         if (!registry.isAlive(id))
             continue;
@@ -1,10 +1,10 @@
 #include "systems/EnemyShootingSystem.hpp"
 
 #include "Logger.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <algorithm>
 #include <cmath>
-#include <limits>
 #include <random>
 
 namespace
@@ -31,10 +31,16 @@ namespace
                          const EnemyShootingComponent& shooting)
     {
         EntityId projectile = registry.createEntity();
+        const float spawnX  = transform.x + kWalkerShotAnchorOffsetX;
+        const float spawnY  = transform.y + kWalkerShotAnchorOffset;
 
         auto& pt = registry.emplace<TransformComponent>(projectile);
-        pt.x     = transform.x + kWalkerShotAnchorOffsetX;
-        pt.y     = transform.y + kWalkerShotAnchorOffset;
+        pt.x     = spawnX;
+        pt.y     = spawnY;
+
+        auto& pv = registry.emplace<VelocityComponent>(projectile);
+        pv.vx    = 0.0F;
+        pv.vy    = 0.0F;
 
         auto& walkerShot = registry.emplace<WalkerShotComponent>(
             projectile, WalkerShotComponent::create(owner, kWalkerShotTickDurationSec, kWalkerShotAnchorOffset,
@@ -43,10 +49,6 @@ namespace
         walkerShot.hoverTicks   = 3;
         walkerShot.descendTicks = 4;
 
-        auto& pv = registry.emplace<VelocityComponent>(projectile);
-        pv.vx    = 0.0F;
-        pv.vy    = 0.0F;
-
         const int totalTicks =
             std::max(1, walkerShot.ascentTicks + walkerShot.hoverTicks + walkerShot.descendTicks + 1);
         const float lifetime = kWalkerShotTickDurationSec * static_cast<float>(totalTicks);
@@ -57,8 +59,7 @@ namespace
         registry.emplace<HitboxComponent>(projectile, HitboxComponent::create(20.0F, 20.0F, 0.0F, 0.0F, true));
         registry.emplace<RenderTypeComponent>(projectile, RenderTypeComponent::create(kWalkerShotTypeId));
 
-        Logger::instance().info("[Spawn] Walker " + std::to_string(owner) + " fired special shot at (" +
-                                std::to_string(pt.x) + ", " + std::to_string(pt.y) + ")");
+        LOG_DEBUG("[Spawn]", "Walker ", owner, " fired special shot at (", spawnX, ", ", spawnY, ")");
     }
 
     void spawnBossRadialShots(Registry& registry, EntityId owner, const TransformComponent& transform,
@@ -107,18 +108,12 @@ namespace
     }
 } // namespace
 
-void EnemyShootingSystem::update(Registry& registry, float deltaTime)
+void EnemyShootingSystem::update(Registry& registry, const PlayerIndex& players, float deltaTime)
 {
+    PROFILE_ZONE("system.enemyShooting");
     std::vector<EntityId> enemies;
 
-    for (EntityId id : registry.view<EnemyShootingComponent, TransformComponent, TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-
-        auto& tag = registry.get<TagComponent>(id);
-        if (!tag.hasTag(EntityTag::Enemy))
-            continue;
-
+    for (EntityId id : registry.viewTagged<EnemyShootingComponent, TransformComponent>(EntityTag::Enemy)) {
         enemies.push_back(id);
     }
 
@@ -139,25 +134,11 @@ void EnemyShootingSystem::update(Registry& registry, float deltaTime)
             } else if (isBoss(registry, id)) {
                 spawnBossRadialShots(registry, id, transform, shooting);
             } else {
-                float bestDist2 = std::numeric_limits<float>::max();
-                float targetX   = transform.x - 100.0F;
-                float targetY   = transform.y;
-
-                for (EntityId playerId : registry.view<TransformComponent, TagComponent>()) {
-                    if (!registry.isAlive(playerId))
-                        continue;
-                    const auto& playerTag = registry.get<TagComponent>(playerId);
-                    if (!playerTag.hasTag(EntityTag::Player))
-                        continue;
-                    const auto& playerTransform = registry.get<TransformComponent>(playerId);
-                    float dx                    = playerTransform.x - transform.x;
-                    float dy                    = playerTransform.y - transform.y;
-                    float dist2                 = dx * dx + dy * dy;
-                    if (dist2 < bestDist2) {
-                        bestDist2 = dist2;
-                        targetX   = playerTransform.x;
-                        targetY   = playerTransform.y;
-                    }
+                float targetX = transform.x - 100.0F;
+                float targetY = transform.y;
+                if (auto target = players.nearest(transform.x, transform.y)) {
+                    targetX = target->x;
+                    targetY = target->y;
                 }
 
                 float dx   = targetX - transform.x;
@@ -170,8 +151,7 @@ void EnemyShootingSystem::update(Registry& registry, float deltaTime)
                     dirY = dy / dist;
                 }
 
-                Logger::instance().info("[Spawn] Enemy " + std::to_string(id) + " firing projectile at (" +
-                                        std::to_string(transform.x) + ", " + std::to_string(transform.y) + ")");
+                LOG_DEBUG("[Spawn]", "Enemy ", id, " firing projectile at (", transform.x, ", ", transform.y, ")");
 
                 EntityId projectile = registry.createEntity();
 
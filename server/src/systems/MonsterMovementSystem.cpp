@@ -1,21 +1,19 @@
 #include "systems/MonsterMovementSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <cmath>
-#include <limits>
 
 namespace
 {
     constexpr float kTwoPi = 6.28318530717958647692F;
 }
 
-void MonsterMovementSystem::update(Registry& registry, float deltaTime) const
+void MonsterMovementSystem::update(Registry& registry, const PlayerIndex& players, float deltaTime) const
 {
-    for (EntityId id : registry.view<MovementComponent, VelocityComponent, TransformComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        auto& move                = registry.get<MovementComponent>(id);
-        auto& vel                 = registry.get<VelocityComponent>(id);
-        const auto& selfTransform = registry.get<TransformComponent>(id);
+    PROFILE_ZONE("system.monsterMovement");
+    for (auto [id, move, vel, selfTransform] :
+         registry.view<MovementComponent, VelocityComponent, TransformComponent>().each()) {
         move.time += deltaTime;
         switch (move.pattern) {
             case MovementPattern::Linear:
@@ -45,29 +43,11 @@ void MonsterMovementSystem::update(Registry& registry, float deltaTime) const
                 break;
             }
             case MovementPattern::FollowPlayer: {
-                float bestDist2 = std::numeric_limits<float>::max();
-                float bestDx    = 0.0F;
-                float bestDy    = 0.0F;
-                for (EntityId playerId : registry.view<TransformComponent, TagComponent>()) {
-                    if (!registry.isAlive(playerId))
-                        continue;
-                    const auto& tag = registry.get<TagComponent>(playerId);
-                    if (!tag.hasTag(EntityTag::Player))
-                        continue;
-                    const auto& p = registry.get<TransformComponent>(playerId);
-                    float dx      = p.x - selfTransform.x;
-                    float dy      = p.y - selfTransform.y;
-                    float dist2   = dx * dx + dy * dy;
-                    if (dist2 < bestDist2) {
-                        bestDist2 = dist2;
-                        bestDx    = dx;
-                        bestDy    = dy;
-                    }
-                }
-                if (bestDist2 > 0.0F && bestDist2 < std::numeric_limits<float>::max()) {
-                    float invLen = 1.0F / std::sqrt(bestDist2);
-                    vel.vx       = bestDx * invLen * move.speed;
-                    vel.vy       = bestDy * invLen * move.speed;
+                auto target = players.nearest(selfTransform.x, selfTransform.y);
+                if (target && target->distanceSquared > 0.0F) {
+                    float invLen = 1.0F / std::sqrt(target->distanceSquared);
+                    vel.vx       = (target->x - selfTransform.x) * invLen * move.speed;
+                    vel.vy       = (target->y - selfTransform.y) * invLen * move.speed;
                 } else {
                     vel.vx = -move.speed;
                     vel.vy = 0.0F;
@@ -1,5 +1,7 @@
 #include "systems/MonsterSpawnSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <algorithm>
 
 MonsterSpawnSystem::MonsterSpawnSystem(std::vector<MovementComponent> patterns, std::vector<SpawnEvent> script)
@@ -14,6 +16,7 @@ void MonsterSpawnSystem::reset()
 
 void MonsterSpawnSystem::update(Registry& registry, float deltaTime)
 {
+    PROFILE_ZONE("system.monsterSpawn");
     if (patterns_.empty() || script_.empty())
         return;
 
@@ -1,17 +1,19 @@
 #include "systems/MovementSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <cmath>
 
 void MovementSystem::update(Registry& registry, float deltaTime) const
 {
-    for (EntityId id : registry.view<TransformComponent, VelocityComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        auto& t = registry.get<TransformComponent>(id);
-        auto& v = registry.get<VelocityComponent>(id);
-        if (!std::isfinite(v.vx) || !std::isfinite(v.vy))
-            continue;
-        t.x += v.vx * deltaTime;
-        t.y += v.vy * deltaTime;
-    }
+    PROFILE_ZONE("system.movement");
+    registry.view<TransformComponent, VelocityComponent>().eachChunk(
+        [deltaTime](std::size_t count, const EntityId*, TransformComponent* t, VelocityComponent* v) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!std::isfinite(v[i].vx) || !std::isfinite(v[i].vy))
+                    continue;
+                t[i].x += v[i].vx * deltaTime;
+                t[i].y += v[i].vy * deltaTime;
+            }
+        });
 }
@@ -1,5 +1,7 @@
 #include "systems/ObstacleSpawnSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <algorithm>
 
 ObstacleSpawnSystem::ObstacleSpawnSystem(std::vector<ObstacleSpawn> obstacles, float playfieldHeight)
@@ -16,6 +18,7 @@ void ObstacleSpawnSystem::reset()
 
 void ObstacleSpawnSystem::update(Registry& registry, float deltaTime)
 {
+    PROFILE_ZONE("system.obstacleSpawn");
     if (obstacles_.empty()) {
         return;
     }
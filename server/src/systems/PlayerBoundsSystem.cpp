@@ -2,6 +2,7 @@
 
 #include "components/BoundaryComponent.hpp"
 #include "components/TagComponent.hpp"
+#include "profiling/TickProfiler.hpp"
 
 CameraBounds PlayerBoundsSystem::fallbackBounds() const
 {
@@ -15,12 +16,7 @@ CameraBounds PlayerBoundsSystem::fallbackBounds() const
 
 std::optional<CameraBounds> PlayerBoundsSystem::readDefaults(Registry& registry) const
 {
-    for (EntityId id : registry.view<BoundaryComponent, TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        const auto& tag = registry.get<TagComponent>(id);
-        if (!tag.hasTag(EntityTag::Player))
-            continue;
+    for (EntityId id : registry.viewTagged<BoundaryComponent>(EntityTag::Player)) {
         const auto& b = registry.get<BoundaryComponent>(id);
         CameraBounds bounds;
         bounds.minX = b.minX;
@@ -34,12 +30,7 @@ std::optional<CameraBounds> PlayerBoundsSystem::readDefaults(Registry& registry)
 
 void PlayerBoundsSystem::applyBounds(Registry& registry, const CameraBounds& bounds) const
 {
-    for (EntityId id : registry.view<BoundaryComponent, TagComponent>()) {
-        if (!registry.isAlive(id))
-            continue;
-        const auto& tag = registry.get<TagComponent>(id);
-        if (!tag.hasTag(EntityTag::Player))
-            continue;
+    for (EntityId id : registry.viewTagged<BoundaryComponent>(EntityTag::Player)) {
         auto& b = registry.get<BoundaryComponent>(id);
         b.minX  = bounds.minX;
         b.maxX  = bounds.maxX;
@@ -50,6 +41,7 @@ void PlayerBoundsSystem::applyBounds(Registry& registry, const CameraBounds& bou
 
 void PlayerBoundsSystem::update(Registry& registry, const std::optional<CameraBounds>& bounds)
 {
+    PROFILE_ZONE("system.playerBounds");
     if (bounds.has_value()) {
         if (!defaults_.has_value())
             defaults_ = readDefaults(registry);
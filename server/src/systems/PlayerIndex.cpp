@@ -0,0 +1,113 @@
+#include "systems/PlayerIndex.hpp"
+
+#include "profiling/TickProfiler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+bool PlayerIndex::isPlayer(const Registry& registry, EntityId id)
+{
+    if (!registry.isAlive(id) || !registry.has<TransformComponent>(id) || !registry.has<TagComponent>(id))
+        return false;
+    return registry.get<TagComponent>(id).hasTag(EntityTag::Player);
+}
+
+void PlayerIndex::rebuild(const Registry& registry, const std::map<std::uint32_t, EntityId>& playerEntities)
+{
+    PROFILE_ZONE("playerIndex.rebuild");
+    ids_.clear();
+    for (const auto& [playerId, entity] : playerEntities) {
+        if (isPlayer(registry, entity))
+            ids_.push_back(entity);
+    }
+    std::sort(ids_.begin(), ids_.end());
+    ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+
+    owners_.assign(ids_.size(), 0);
+    hasOwner_.assign(ids_.size(), 0);
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        if (!registry.has<OwnershipComponent>(ids_[i]))
+            continue;
+        owners_[i]   = registry.get<OwnershipComponent>(ids_[i]).ownerId;
+        hasOwner_[i] = 1;
+    }
+    readPositions(registry);
+}
+
+void PlayerIndex::refresh(const Registry& registry)
+{
+    PROFILE_ZONE("playerIndex.refresh");
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        if (!isPlayer(registry, ids_[i]))
+            continue;
+        ids_[kept]      = ids_[i];
+        owners_[kept]   = owners_[i];
+        hasOwner_[kept] = hasOwner_[i];
+        ++kept;
+    }
+    ids_.resize(kept);
+    owners_.resize(kept);
+    hasOwner_.resize(kept);
+    readPositions(registry);
+}
+
+void PlayerIndex::clear()
+{
+    ids_.clear();
+    xs_.clear();
+    ys_.clear();
+    owners_.clear();
+    hasOwner_.clear();
+}
+
+void PlayerIndex::readPositions(const Registry& registry)
+{
+    xs_.resize(ids_.size());
+    ys_.resize(ids_.size());
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        const auto& t = registry.get<TransformComponent>(ids_[i]);
+        xs_[i]        = t.x;
+        ys_[i]        = t.y;
+    }
+}
+
+std::optional<PlayerTarget> PlayerIndex::nearest(float x, float y) const
+{
+    std::optional<PlayerTarget> best;
+    float bestDist2 = std::numeric_limits<float>::max();
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        float dx    = xs_[i] - x;
+        float dy    = ys_[i] - y;
+        float dist2 = dx * dx + dy * dy;
+        if (dist2 < bestDist2) {
+            bestDist2 = dist2;
+            best      = PlayerTarget{ids_[i], xs_[i], ys_[i], dist2};
+        }
+    }
+    return best;
+}
+
+std::optional<EntityId> PlayerIndex::findByOwner(std::uint32_t ownerId) const
+{
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        if (hasOwner_[i] != 0 && owners_[i] == ownerId)
+            return ids_[i];
+    }
+    return std::nullopt;
+}
+
+std::size_t PlayerIndex::size() const
+{
+    return ids_.size();
+}
+
+bool PlayerIndex::empty() const
+{
+    return ids_.empty();
+}
+
+const std::vector<EntityId>& PlayerIndex::ids() const
+{
+    return ids_;
+}
@@ -1,5 +1,7 @@
 #include "systems/PlayerInputSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <cmath>
 
 PlayerInputSystem::PlayerInputSystem(float speed, float missileSpeed, float missileLifetime, std::int32_t missileDamage)
@@ -8,6 +10,7 @@ PlayerInputSystem::PlayerInputSystem(float speed, float missileSpeed, float miss
 
 void PlayerInputSystem::update(Registry& registry, const std::vector<PlayerCommand>& commands) const
 {
+    PROFILE_ZONE("system.playerInput");
     for (const auto& cmd : commands) {
         EntityId id = cmd.playerId;
         if (!registry.isAlive(id))
@@ -48,12 +48,7 @@ void ScoreSystem::onDamage(const DamageEvent& event)
         }
 
         if (!found) {
-            for (EntityId playerId : registry_->view<TagComponent, OwnershipComponent>()) {
-                if (!registry_->isAlive(playerId))
-                    continue;
-                const auto& playerTag = registry_->get<TagComponent>(playerId);
-                if (!playerTag.hasTag(EntityTag::Player))
-                    continue;
+            for (EntityId playerId : registry_->viewTagged<OwnershipComponent>(EntityTag::Player)) {
                 const auto& playerOwnership = registry_->get<OwnershipComponent>(playerId);
                 if (playerOwnership.ownerId == ownerId) {
                     scoreRecipient = playerId;
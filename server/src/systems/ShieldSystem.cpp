@@ -3,11 +3,13 @@
 #include "Logger.hpp"
 #include "components/Components.hpp"
 #include "components/ShieldComponent.hpp"
+#include "profiling/TickProfiler.hpp"
 
 #include <vector>
 
-void ShieldSystem::update(Registry& registry, float deltaTime)
+void ShieldSystem::update(Registry& registry, const PlayerIndex& players, float deltaTime)
 {
+    PROFILE_ZONE("system.shield");
     (void) deltaTime;
     std::vector<EntityId> toDestroy;
 
@@ -17,30 +19,13 @@ void ShieldSystem::update(Registry& registry, float deltaTime)
 
         auto& shield = registry.get<ShieldComponent>(shieldId);
 
-        EntityId ownerId = 0;
-        bool ownerFound  = false;
-        for (EntityId playerId : registry.view<TagComponent, TransformComponent>()) {
-            if (!registry.isAlive(playerId))
-                continue;
-            const auto& tag = registry.get<TagComponent>(playerId);
-            if (!tag.hasTag(EntityTag::Player))
-                continue;
-            if (!registry.has<OwnershipComponent>(playerId))
-                continue;
-            const auto& ownership = registry.get<OwnershipComponent>(playerId);
-            if (ownership.ownerId == shield.ownerId) {
-                ownerId    = playerId;
-                ownerFound = true;
-                break;
-            }
-        }
-
-        if (!ownerFound) {
+        auto owner = players.findByOwner(shield.ownerId);
+        if (!owner) {
             toDestroy.push_back(shieldId);
             continue;
         }
 
-        const auto& ownerTransform = registry.get<TransformComponent>(ownerId);
+        const auto& ownerTransform = registry.get<TransformComponent>(*owner);
 
         if (ownerTransform.y < -1000.0F) {
             continue;
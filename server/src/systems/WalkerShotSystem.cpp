@@ -1,5 +1,7 @@
 #include "systems/WalkerShotSystem.hpp"
 
+#include "profiling/TickProfiler.hpp"
+
 #include <algorithm>
 
 namespace
@@ -23,6 +25,7 @@ namespace
 
 void WalkerShotSystem::update(Registry& registry, float deltaTime) const
 {
+    PROFILE_ZONE("system.walkerShot");
     for (EntityId id : registry.view<WalkerShotComponent, TransformComponent>()) {
         if (!registry.isAlive(id))
             continue;
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+enum class LogLevel : std::uint8_t
+{
+    Trace,
+    Debug,
+    Info,
+    Warn,
+    Error
+};
+
+struct LogRecord
+{
+    static constexpr std::size_t kInlineSize = 232;
+
+    std::chrono::system_clock::time_point time{};
+    int roomId           = -1;
+    LogLevel level       = LogLevel::Info;
+    std::uint16_t length = 0;
+    std::array<char, kInlineSize> text{};
+    std::string overflow;
+
+    void append(std::string_view chunk)
+    {
+        if (overflow.empty() && length + chunk.size() <= kInlineSize) {
+            chunk.copy(text.data() + length, chunk.size());
+            length = static_cast<std::uint16_t>(length + chunk.size());
+            return;
+        }
+        if (overflow.empty())
+            overflow.assign(text.data(), length);
+        overflow.append(chunk);
+    }
+
+    std::string_view view() const
+    {
+        if (!overflow.empty())
+            return overflow;
+        return {text.data(), length};
+    }
+
+    template <typename T> void appendValue(const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            append(value ? "true" : "false");
+        } else if constexpr (std::is_same_v<T, char>) {
+            append(std::string_view(&value, 1));
+        } else if constexpr (std::is_enum_v<T>) {
+            appendValue(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            append(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)));
+        } else {
+            static_assert(std::is_convertible_v<const T&, std::string_view>, "unsupported log argument type");
+            append(std::string_view(value));
+        }
+    }
+};
@@ -1,20 +1,72 @@
 #pragma once
 
+#include "LogRecord.hpp"
+
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#ifndef RTYPE_LOG_MIN_LEVEL
+#define RTYPE_LOG_MIN_LEVEL 1
+#endif
+
+struct LogSite
+{
+    explicit constexpr LogSite(const char* siteTag) : tag(siteTag) {}
+
+    const char* tag;
+    std::atomic<std::uint32_t> state{0};
+};
+
 class Logger
 {
   public:
     static Logger& instance();
 
+    static constexpr bool compiledIn(LogLevel level)
+    {
+        return static_cast<int>(level) >= RTYPE_LOG_MIN_LEVEL;
+    }
+
+    bool enabled(LogLevel level, LogSite& site)
+    {
+        if (level >= LogLevel::Info)
+            return true;
+        if (!_verbose.load(std::memory_order_relaxed))
+            return false;
+        const std::uint32_t generation = _tagGeneration.load(std::memory_order_acquire);
+        const std::uint32_t state      = site.state.load(std::memory_order_relaxed);
+        if ((state >> 1) == generation)
+            return (state & 1u) != 0u;
+        return refreshSite(site, generation);
+    }
+
+    template <typename... Args> void write(LogLevel level, int roomId, std::string_view tag, const Args&... args)
+    {
+        LogRecord record;
+        record.time   = std::chrono::system_clock::now();
+        record.roomId = roomId;
+        record.level  = level;
+        record.append(tag);
+        record.append(" ");
+        (record.appendValue(args), ...);
+        submit(std::move(record));
+    }
+
+    void flush();
+    std::uint64_t getDroppedRecords() const;
+
     void setVerbose(bool enabled);
     void loadTagConfig(const std::string& configPath);
     void info(const std::string& message);
@@ -66,21 +118,51 @@ class Logger
     Logger& operator=(const Logger&) = delete;
 
   private:
+    struct Ring;
+
     Logger();
     ~Logger();
 
-    void log(int roomId, const std::string& level, const std::string& message, bool alwaysConsole);
-    bool isTagEnabled(const std::string& message) const;
-    static std::string extractTag(const std::string& message);
+    void log(int roomId, LogLevel level, const std::string& message);
+    void submit(LogRecord&& record);
+    Ring& localRing();
+    void wake();
+    void writerLoop();
+    void drainRings(std::vector<LogRecord>& batch);
+    void emit(const LogRecord& record);
+    const std::string& timestampFor(std::chrono::system_clock::time_point time);
+    bool refreshSite(LogSite& site, std::uint32_t generation);
+    void bumpTagGeneration();
+    bool isTagEnabled(std::string_view message) const;
+    static std::string_view extractTag(std::string_view message);
+    static std::string formatTag(const std::string& tag);
 
     std::ofstream _file;
     std::unordered_map<int, std::unique_ptr<std::ofstream>> _roomFiles;
     mutable std::mutex _mutex;
-    bool _verbose;
+    std::atomic<bool> _verbose{false};
     bool _consoleEnabled{true};
     std::unordered_set<std::string> _enabledTags;
     bool _tagFilterActive;
+    std::atomic<std::uint32_t> _tagGeneration{1};
     std::function<void(const std::string&)> _postLogCallback;
+    std::string _line;
+    std::string _timestamp;
+    std::time_t _timestampSecond = -1;
+
+    std::mutex _ringsMutex;
+    std::vector<std::shared_ptr<Ring>> _rings;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCv;
+    std::condition_variable _flushedCv;
+    bool _stopping               = false;
+    bool _wakePending            = false;
+    std::uint64_t _flushTicket   = 0;
+    std::uint64_t _flushedTicket = 0;
+    std::atomic<bool> _running{false};
+    std::atomic<std::uint64_t> _droppedRecords{0};
+    std::atomic<std::uint64_t> _droppedSinceReport{0};
+    std::thread _writer;
 
     std::atomic<std::size_t> _totalBytesSent{0};
     std::atomic<std::size_t> _totalBytesReceived{0};
@@ -88,3 +170,19 @@ class Logger
     std::atomic<std::size_t> _totalPacketsReceived{0};
     std::atomic<std::size_t> _totalPacketsDropped{0};
 };
+
+#define RTYPE_LOG_AT(level, roomId, tag, ...)                                                                          \
+    do {                                                                                                               \
+        if constexpr (Logger::compiledIn(level)) {                                                                     \
+            static LogSite rtypeLogSite{tag};                                                                          \
+            if (Logger::instance().enabled(level, rtypeLogSite))                                                       \
+                Logger::instance().write(level, roomId, tag, __VA_ARGS__);                                             \
+        }                                                                                                              \
+    } while (false)
+
+#define LOG_TRACE(tag, ...) RTYPE_LOG_AT(LogLevel::Trace, -1, tag, __VA_ARGS__)
+#define LOG_DEBUG(tag, ...) RTYPE_LOG_AT(LogLevel::Debug, -1, tag, __VA_ARGS__)
+#define LOG_INFO(tag, ...) RTYPE_LOG_AT(LogLevel::Info, -1, tag, __VA_ARGS__)
+#define LOG_WARN(tag, ...) RTYPE_LOG_AT(LogLevel::Warn, -1, tag, __VA_ARGS__)
+#define LOG_ERROR(tag, ...) RTYPE_LOG_AT(LogLevel::Error, -1, tag, __VA_ARGS__)
+#define LOG_ROOM(level, roomId, tag, ...) RTYPE_LOG_AT(level, roomId, tag, __VA_ARGS__)
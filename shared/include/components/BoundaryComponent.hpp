@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 struct BoundaryComponent
 {
     float minX = 0.0F;
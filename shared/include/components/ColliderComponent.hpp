@@ -1,10 +1,17 @@
 #pragma once
 
+#include "components/CollisionLayer.hpp"
+#include "components/ComponentIds.hpp"
+
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 struct ColliderComponent
 {
+    static constexpr std::size_t kMaxPoints = 32;
+
     enum class Shape
     {
         Box,
@@ -20,6 +27,8 @@ struct ColliderComponent
     float radius  = 0.0F;
     bool isActive = true;
     std::vector<std::array<float, 2>> points;
+    std::uint32_t collisionLayer = CollisionLayer::None;
+    std::uint32_t collisionMask  = CollisionLayer::All;
 
     static ColliderComponent box(float width, float height, float offsetX = 0.0F, float offsetY = 0.0F,
                                  bool active = true);
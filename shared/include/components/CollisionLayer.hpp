@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CollisionLayer
+{
+    constexpr std::uint32_t None             = 0;
+    constexpr std::uint32_t Player           = 1U << 0;
+    constexpr std::uint32_t Enemy            = 1U << 1;
+    constexpr std::uint32_t PlayerProjectile = 1U << 2;
+    constexpr std::uint32_t EnemyProjectile  = 1U << 3;
+    constexpr std::uint32_t Obstacle         = 1U << 4;
+    constexpr std::uint32_t Pickup           = 1U << 5;
+    constexpr std::uint32_t Background       = 1U << 6;
+    constexpr std::uint32_t Neutral          = 1U << 7;
+    constexpr std::uint32_t All              = 0xFFFFFFFFU;
+
+    inline bool compatible(std::uint32_t layerA, std::uint32_t maskA, std::uint32_t layerB, std::uint32_t maskB)
+    {
+        return (layerA & maskB) != 0 && (layerB & maskA) != 0;
+    }
+} // namespace CollisionLayer
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "ecs/ComponentTypeId.hpp"
+
+struct AllyComponent;
+struct BoundaryComponent;
+struct ColliderComponent;
+struct EnemyShootingComponent;
+struct HealthComponent;
+struct HitboxComponent;
+struct InvincibilityComponent;
+struct LivesComponent;
+struct MissileComponent;
+struct MovementComponent;
+struct OwnershipComponent;
+struct PlayerInputComponent;
+struct RenderTypeComponent;
+struct RespawnTimerComponent;
+struct ScoreComponent;
+struct ScoreValueComponent;
+struct ShieldComponent;
+struct SpawnGroupComponent;
+struct TagComponent;
+struct TransformComponent;
+struct VelocityComponent;
+struct WalkerShotComponent;
+
+using SharedComponents =
+    ComponentList<TransformComponent, VelocityComponent, TagComponent, HitboxComponent, ColliderComponent,
+                  HealthComponent, OwnershipComponent, RenderTypeComponent, MovementComponent, MissileComponent,
+                  PlayerInputComponent, EnemyShootingComponent, WalkerShotComponent, ScoreComponent,
+                  ScoreValueComponent, LivesComponent, InvincibilityComponent, RespawnTimerComponent,
+                  BoundaryComponent, SpawnGroupComponent, AllyComponent, ShieldComponent>;
+
+template <typename Component>
+    requires(SharedComponents::contains<Component>)
+struct StaticComponentId<Component> : std::integral_constant<std::size_t, SharedComponents::indexOf<Component>()>
+{};
@@ -6,12 +6,14 @@
 #include "components/EnemyShootingComponent.hpp"
 #include "components/HealthComponent.hpp"
 #include "components/HitboxComponent.hpp"
+#include "components/InvincibilityComponent.hpp"
 #include "components/LivesComponent.hpp"
 #include "components/MissileComponent.hpp"
 #include "components/MovementComponent.hpp"
 #include "components/OwnershipComponent.hpp"
 #include "components/PlayerInputComponent.hpp"
 #include "components/RenderTypeComponent.hpp"
+#include "components/RespawnTimerComponent.hpp"
 #include "components/ScoreComponent.hpp"
 #include "components/ScoreValueComponent.hpp"
 #include "components/ShieldComponent.hpp"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 #include <cstdint>
 
 struct EnemyShootingComponent
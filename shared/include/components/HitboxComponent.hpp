@@ -1,14 +1,19 @@
 #pragma once
 
+#include "components/CollisionLayer.hpp"
+#include "components/ComponentIds.hpp"
+
 #include <cstdint>
 
 struct HitboxComponent
 {
-    float width   = 0.0F;
-    float height  = 0.0F;
-    float offsetX = 0.0F;
-    float offsetY = 0.0F;
-    bool isActive = true;
+    float width                  = 0.0F;
+    float height                 = 0.0F;
+    float offsetX                = 0.0F;
+    float offsetY                = 0.0F;
+    bool isActive                = true;
+    std::uint32_t collisionLayer = CollisionLayer::None;
+    std::uint32_t collisionMask  = CollisionLayer::All;
 
     static HitboxComponent create(float width, float height, float offsetX = 0.0F, float offsetY = 0.0F,
                                   bool active = true);
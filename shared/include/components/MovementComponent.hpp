@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 #include <cstdint>
 
 enum class MovementPattern : std::uint8_t
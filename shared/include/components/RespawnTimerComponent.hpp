@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 struct RespawnTimerComponent
 {
     float timeLeft = 0.0F;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 #include <string>
 
 // Marks which spawn group (wave/obstacle/boss spawn) an entity belongs to.
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+#include "ecs/TagIndex.hpp"
+
 #include <cstdint>
 
 enum class EntityTag : std::uint8_t
@@ -54,3 +57,11 @@ inline void TagComponent::removeTag(EntityTag tag)
 {
     tags = static_cast<EntityTag>(static_cast<std::uint8_t>(tags) & ~static_cast<std::uint8_t>(tag));
 }
+
+template <> struct TagTraits<TagComponent>
+{
+    static std::uint32_t mask(const TagComponent& component)
+    {
+        return static_cast<std::uint32_t>(component.tags);
+    }
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "components/ComponentIds.hpp"
+
 struct VelocityComponent
 {
     float vx = 0.0F;
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+template <typename T> class MpscQueue
+{
+  public:
+    static constexpr std::size_t kDefaultCapacity = 1024;
+
+    explicit MpscQueue(std::size_t capacity = kDefaultCapacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)), mask_(capacity_ - 1),
+          cells_(std::make_unique<Cell[]>(capacity_))
+    {
+        for (std::size_t i = 0; i < capacity_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue&)            = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    bool push(const T& value)
+    {
+        return emplace(value);
+    }
+
+    bool push(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    bool tryPop(T& out)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        Cell& cell             = cells_[head & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+            return false;
+        out = std::move(cell.value);
+        cell.sequence.store(head + capacity_, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::size_t drainInto(std::vector<T>& out, std::size_t max = std::numeric_limits<std::size_t>::max())
+    {
+        std::size_t head  = head_.load(std::memory_order_relaxed);
+        std::size_t count = 0;
+        while (count < max) {
+            Cell& cell = cells_[head & mask_];
+            if (cell.sequence.load(std::memory_order_acquire) != head + 1)
+                break;
+            out.push_back(std::move(cell.value));
+            cell.sequence.store(head + capacity_, std::memory_order_release);
+            ++head;
+            ++count;
+        }
+        head_.store(head, std::memory_order_relaxed);
+        return count;
+    }
+
+    bool empty() const
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        return cells_[head & mask_].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    std::uint64_t dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    template <typename U> bool emplace(U&& value)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        Cell* cell       = nullptr;
+        while (true) {
+            cell                     = &cells_[tail & mask_];
+            const std::size_t seq    = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t lag = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(tail);
+            if (lag == 0) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                    break;
+            } else if (lag < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::forward<U>(value);
+        cell->sequence.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr std::size_t kCacheLine = 64;
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    alignas(kCacheLine) std::atomic<std::uint64_t> dropped_{0};
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+template <typename T> class SpscQueue
+{
+  public:
+    static constexpr std::size_t kDefaultCapacity = 1024;
+
+    explicit SpscQueue(std::size_t capacity = kDefaultCapacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity)), mask_(capacity_ - 1),
+          slots_(std::make_unique<T[]>(capacity_))
+    {}
+
+    SpscQueue(const SpscQueue&)            = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    bool push(const T& value)
+    {
+        return emplace(value);
+    }
+
+    bool push(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    bool tryPop(T& out)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_)
+                return false;
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t drainInto(std::vector<T>& out, std::size_t max = std::numeric_limits<std::size_t>::max())
+    {
+        const std::size_t head  = head_.load(std::memory_order_relaxed);
+        cachedTail_             = tail_.load(std::memory_order_acquire);
+        const std::size_t count = std::min(cachedTail_ - head, max);
+        for (std::size_t i = 0; i < count; ++i)
+            out.push_back(std::move(slots_[(head + i) & mask_]));
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    std::uint64_t dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    template <typename U> bool emplace(U&& value)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ == capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ == capacity_) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::forward<U>(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    static constexpr std::size_t kCacheLine = 64;
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<T[]> slots_;
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t cachedHead_ = 0;
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t cachedTail_ = 0;
+    alignas(kCacheLine) std::atomic<std::uint64_t> dropped_{0};
+};
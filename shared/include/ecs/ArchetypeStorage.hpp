@@ -0,0 +1,95 @@
+#pragma once
+
+#include "ecs/Entity.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+struct ArchetypeComponentInfo
+{
+    std::size_t size                            = 0;
+    std::size_t align                           = 0;
+    void (*moveConstruct)(void* dst, void* src) = nullptr;
+    void (*destroy)(void* ptr)                  = nullptr;
+};
+
+struct ArchetypeBlockDeleter
+{
+    void operator()(std::byte* block) const;
+};
+
+struct ArchetypeChunk
+{
+    std::unique_ptr<std::byte, ArchetypeBlockDeleter> block;
+    std::vector<EntityId> entities;
+};
+
+struct Archetype
+{
+    std::vector<std::size_t> components;
+    std::vector<std::size_t> columns;
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> sizes;
+    std::size_t capacity   = 0;
+    std::size_t blockBytes = 0;
+    std::vector<ArchetypeChunk> chunks;
+    std::unordered_map<std::size_t, std::size_t> addEdges;
+    std::unordered_map<std::size_t, std::size_t> removeEdges;
+
+    bool contains(std::size_t componentIndex) const;
+    void* column(const ArchetypeChunk& chunk, std::size_t componentIndex) const;
+};
+
+class ArchetypeStorage
+{
+  public:
+    static constexpr std::size_t npos         = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t kChunkBytes  = 16 * 1024;
+    static constexpr std::size_t kColumnAlign = 64;
+
+    ArchetypeStorage()                                   = default;
+    ArchetypeStorage(const ArchetypeStorage&)            = delete;
+    ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+    ~ArchetypeStorage();
+
+    template <typename Component, typename... Args>
+    Component& emplace(EntityId id, std::size_t componentIndex, Args&&... args);
+    template <typename Component> Component& get(EntityId id, std::size_t componentIndex);
+    template <typename Component> const Component& get(EntityId id, std::size_t componentIndex) const;
+    void remove(EntityId id, std::size_t componentIndex);
+    void destroy(EntityId id);
+    void clear();
+    void compact(EntityId entityCount);
+
+    std::size_t archetypeCount() const;
+    const Archetype& archetype(std::size_t index) const;
+
+  private:
+    struct Location
+    {
+        std::size_t archetype = npos;
+        std::size_t chunk     = 0;
+        std::size_t row       = 0;
+    };
+
+    template <typename Component> void registerComponent(std::size_t componentIndex);
+    void* componentAt(const Location& location, std::size_t componentIndex) const;
+    std::size_t addTarget(std::size_t from, std::size_t componentIndex);
+    std::size_t removeTarget(std::size_t from, std::size_t componentIndex);
+    std::size_t findOrCreateArchetype(const std::vector<std::size_t>& components);
+    void migrate(EntityId id, std::size_t target);
+    Location allocateRow(std::size_t archetypeIndex, EntityId id);
+    void releaseRow(const Location& location);
+    void destroyRows(Archetype& archetype);
+
+    std::vector<ArchetypeComponentInfo> infos_;
+    std::vector<Archetype> archetypes_;
+    std::map<std::vector<std::size_t>, std::size_t> lookup_;
+    std::vector<Location> locations_;
+};
+
+#include "ecs/ArchetypeStorage.tpp"
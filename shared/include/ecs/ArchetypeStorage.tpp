@@ -0,0 +1,52 @@
+#pragma once
+
+#include "errors/ComponentNotFoundError.hpp"
+
+#include <new>
+#include <utility>
+
+template <typename Component, typename... Args>
+Component& ArchetypeStorage::emplace(EntityId id, std::size_t componentIndex, Args&&... args)
+{
+    registerComponent<Component>(componentIndex);
+    if (id >= locations_.size())
+        locations_.resize(static_cast<std::size_t>(id) + 1);
+    const Location current = locations_[id];
+    if (current.archetype != npos && archetypes_[current.archetype].contains(componentIndex)) {
+        auto& component = *static_cast<Component*>(componentAt(current, componentIndex));
+        component       = Component(std::forward<Args>(args)...);
+        return component;
+    }
+    Component value(std::forward<Args>(args)...);
+    migrate(id, addTarget(current.archetype, componentIndex));
+    return *::new (componentAt(locations_[id], componentIndex)) Component(std::move(value));
+}
+
+template <typename Component> Component& ArchetypeStorage::get(EntityId id, std::size_t componentIndex)
+{
+    if (id >= locations_.size() || locations_[id].archetype == npos ||
+        !archetypes_[locations_[id].archetype].contains(componentIndex))
+        throw ComponentNotFoundError("Requested component not found on entity");
+    return *static_cast<Component*>(componentAt(locations_[id], componentIndex));
+}
+
+template <typename Component> const Component& ArchetypeStorage::get(EntityId id, std::size_t componentIndex) const
+{
+    if (id >= locations_.size() || locations_[id].archetype == npos ||
+        !archetypes_[locations_[id].archetype].contains(componentIndex))
+        throw ComponentNotFoundError("Requested component not found on entity");
+    return *static_cast<const Component*>(componentAt(locations_[id], componentIndex));
+}
+
+template <typename Component> void ArchetypeStorage::registerComponent(std::size_t componentIndex)
+{
+    if (componentIndex >= infos_.size())
+        infos_.resize(componentIndex + 1);
+    auto& info = infos_[componentIndex];
+    if (info.moveConstruct != nullptr)
+        return;
+    info.size          = sizeof(Component);
+    info.align         = alignof(Component);
+    info.moveConstruct = [](void* dst, void* src) { ::new (dst) Component(std::move(*static_cast<Component*>(src))); };
+    info.destroy       = [](void* ptr) { static_cast<Component*>(ptr)->~Component(); };
+}
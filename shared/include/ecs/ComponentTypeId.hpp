@@ -1,14 +1,48 @@
 #pragma once
 
 #include <atomic>
+#include <concepts>
 #include <cstddef>
+#include <type_traits>
+
+template <typename... Components> struct ComponentList
+{
+    static constexpr std::size_t size = sizeof...(Components);
+
+    template <typename Component> static constexpr bool contains = (std::is_same_v<Component, Components> || ...);
+
+    template <typename Component> static constexpr std::size_t indexOf()
+    {
+        std::size_t index = 0;
+        (void) ((std::is_same_v<Component, Components> ? false : (++index, true)) && ...);
+        return index;
+    }
+};
+
+template <typename Component> struct StaticComponentId
+{};
+
+template <typename Component>
+concept StaticComponent = requires {
+    { StaticComponentId<Component>::value } -> std::convertible_to<std::size_t>;
+};
 
 class ComponentTypeId
 {
   public:
+    static constexpr std::size_t kStaticCapacity = 64;
+
+    template <typename Component>
+        requires StaticComponent<Component>
+    static constexpr std::size_t value()
+    {
+        static_assert(StaticComponentId<Component>::value < kStaticCapacity, "Static component id out of range");
+        return StaticComponentId<Component>::value;
+    }
+
     template <typename Component> static std::size_t value()
     {
-        static const std::size_t id = next();
+        static const std::size_t id = kStaticCapacity + next();
         return id;
     }
 
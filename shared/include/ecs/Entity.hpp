@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+using EntityId = std::uint32_t;
+
+struct Entity
+{
+    EntityId index           = 0;
+    std::uint32_t generation = 0;
+
+    bool operator==(const Entity& other) const = default;
+};
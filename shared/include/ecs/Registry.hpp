@@ -1,32 +1,29 @@
 #pragma once
 
+#include "ecs/ArchetypeStorage.hpp"
 #include "ecs/ComponentTypeId.hpp"
-#include "ecs/ResetValue.hpp"
+#include "ecs/Entity.hpp"
+#include "ecs/TagIndex.hpp"
 #include "errors/ComponentNotFoundError.hpp"
 #include "errors/RegistryError.hpp"
 
 template <typename... Components> class View;
+template <typename... Components> class TagView;
 
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <stdexcept>
-#include <typeindex>
-#include <unordered_map>
 #include <vector>
 
-using EntityId = std::uint32_t;
-
 struct ComponentStorageBase
 {
-    virtual ~ComponentStorageBase()  = default;
-    virtual void remove(EntityId id) = 0;
-    virtual void reset(EntityId id)  = 0;
+    virtual ~ComponentStorageBase()            = default;
+    virtual void remove(EntityId id)           = 0;
+    virtual void compact(EntityId entityCount) = 0;
 };
 
-template <typename Component> void resetValue(Component& value);
-
 template <typename Component> struct ComponentStorage : ComponentStorageBase
 {
     static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
@@ -38,16 +35,31 @@ template <typename Component> struct ComponentStorage : ComponentStorageBase
     Component& fetch(EntityId id);
     const Component& fetch(EntityId id) const;
     void remove(EntityId id) override;
-    void reset(EntityId id) override;
+    void compact(EntityId entityCount) override;
+};
+
+enum class StorageMode
+{
+    SparseSet,
+    Archetype
 };
 
 class Registry
 {
   public:
+    Registry() = default;
+    explicit Registry(StorageMode mode);
+
+    StorageMode storageMode() const;
+
     EntityId createEntity();
     void destroyEntity(EntityId id);
     bool isAlive(EntityId id) const;
+    bool isAlive(Entity entity) const;
+    Entity handle(EntityId id) const;
+    std::uint32_t generation(EntityId id) const;
     void clear();
+    void compact();
     EntityId entityCount() const;
 
     template <typename Component, typename... Args> Component& emplace(EntityId id, Args&&... args);
@@ -58,7 +70,16 @@ class Registry
 
     template <typename... Components> View<Components...> view();
 
+    template <typename Tag> const std::vector<EntityId>& tagged(Tag tag) const;
+    template <typename Tag> bool hasTag(EntityId id, Tag tag) const;
+    template <TaggedComponent Component, typename Tag> void addTag(EntityId id, Tag tag);
+    template <TaggedComponent Component, typename Tag> void removeTag(EntityId id, Tag tag);
+    template <typename... Components, typename Tag> TagView<Components...> viewTagged(Tag tag);
+    std::uint32_t tagMask(EntityId id) const;
+
   private:
+    template <typename... Components> friend class View;
+
     template <typename Component> ComponentStorage<Component>* findStorage();
     template <typename Component> const ComponentStorage<Component>* findStorage() const;
     template <typename Component> ComponentStorage<Component>* ensureStorage();
@@ -80,8 +101,11 @@ class Registry
 
     std::vector<EntityId> freeIds_;
     std::vector<uint8_t> alive_;
+    std::vector<std::uint32_t> generations_;
     EntityId nextId_ = 0;
-    std::unordered_map<std::type_index, std::unique_ptr<ComponentStorageBase>> storages_;
+    std::vector<std::unique_ptr<ComponentStorageBase>> storages_;
+    std::unique_ptr<ArchetypeStorage> archetypes_;
+    TagIndex tags_;
 };
 
 #include "ecs/Registry.tpp"
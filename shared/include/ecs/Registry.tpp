@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ecs/TagView.hpp"
 #include "ecs/View.hpp"
 
 #include <stdexcept>
@@ -11,9 +12,18 @@ template <typename Component, typename... Args> Component& Registry::emplace(Ent
         throw RegistryError("Cannot emplace component on dead entity");
     const auto componentIndex = ComponentTypeId::value<Component>();
     ensureSignatureWordCount(componentIndex);
+    if (archetypes_) {
+        auto& component = archetypes_->emplace<Component>(id, componentIndex, std::forward<Args>(args)...);
+        setSignatureBit(id, componentIndex);
+        if constexpr (TaggedComponent<Component>)
+            tags_.assign(id, TagTraits<Component>::mask(component));
+        return component;
+    }
     auto* storage   = ensureStorage<Component>();
     auto& component = storage->emplace(id, std::forward<Args>(args)...);
     setSignatureBit(id, componentIndex);
+    if constexpr (TaggedComponent<Component>)
+        tags_.assign(id, TagTraits<Component>::mask(component));
     return component;
 }
 
@@ -24,6 +34,8 @@ template <typename Component> bool Registry::has(EntityId id) const
     const auto componentIndex = ComponentTypeId::value<Component>();
     if (!hasSignatureBit(id, componentIndex))
         return false;
+    if (archetypes_)
+        return true;
     if (const auto* storage = findStorage<Component>())
         return storage->contains(id);
     return false;
@@ -36,6 +48,8 @@ template <typename Component> Component& Registry::get(EntityId id)
     const auto componentIndex = ComponentTypeId::value<Component>();
     if (!hasSignatureBit(id, componentIndex))
         throw ComponentNotFoundError("Requested component not found on entity");
+    if (archetypes_)
+        return archetypes_->get<Component>(id, componentIndex);
     auto* storage = findStorage<Component>();
     if (storage == nullptr)
         throw ComponentNotFoundError("Component type not registered");
@@ -49,6 +63,8 @@ template <typename Component> const Component& Registry::get(EntityId id) const
     const auto componentIndex = ComponentTypeId::value<Component>();
     if (!hasSignatureBit(id, componentIndex))
         throw ComponentNotFoundError("Requested component not found on entity");
+    if (archetypes_)
+        return std::as_const(*archetypes_).get<Component>(id, componentIndex);
     const auto* storage = findStorage<Component>();
     if (storage == nullptr)
         throw ComponentNotFoundError("Component type not registered");
@@ -62,6 +78,13 @@ template <typename Component> void Registry::remove(EntityId id)
     const auto componentIndex = ComponentTypeId::value<Component>();
     if (!hasSignatureBit(id, componentIndex))
         return;
+    if constexpr (TaggedComponent<Component>)
+        tags_.erase(id);
+    if (archetypes_) {
+        archetypes_->remove(id, componentIndex);
+        clearSignatureBit(id, componentIndex);
+        return;
+    }
     if (auto* storage = findStorage<Component>()) {
         storage->remove(id);
         clearSignatureBit(id, componentIndex);
@@ -70,27 +93,30 @@ template <typename Component> void Registry::remove(EntityId id)
 
 template <typename Component> ComponentStorage<Component>* Registry::findStorage()
 {
-    const auto it = storages_.find(std::type_index(typeid(Component)));
-    if (it == storages_.end())
+    const auto componentIndex = ComponentTypeId::value<Component>();
+    if (componentIndex >= storages_.size())
         return nullptr;
-    return static_cast<ComponentStorage<Component>*>(it->second.get());
+    return static_cast<ComponentStorage<Component>*>(storages_[componentIndex].get());
 }
 
 template <typename Component> const ComponentStorage<Component>* Registry::findStorage() const
 {
-    const auto it = storages_.find(std::type_index(typeid(Component)));
-    if (it == storages_.end())
+    const auto componentIndex = ComponentTypeId::value<Component>();
+    if (componentIndex >= storages_.size())
         return nullptr;
-    return static_cast<const ComponentStorage<Component>*>(it->second.get());
+    return static_cast<const ComponentStorage<Component>*>(storages_[componentIndex].get());
 }
 
 template <typename Component> ComponentStorage<Component>* Registry::ensureStorage()
 {
     if (auto* storage = findStorage<Component>())
         return storage;
-    auto storage = std::make_unique<ComponentStorage<Component>>();
-    auto* raw    = storage.get();
-    storages_.emplace(std::type_index(typeid(Component)), std::move(storage));
+    const auto componentIndex = ComponentTypeId::value<Component>();
+    if (componentIndex >= storages_.size())
+        storages_.resize(componentIndex + 1);
+    auto storage              = std::make_unique<ComponentStorage<Component>>();
+    auto* raw                 = storage.get();
+    storages_[componentIndex] = std::move(storage);
     return raw;
 }
 
@@ -149,14 +175,46 @@ template <typename Component> void ComponentStorage<Component>::remove(EntityId
     sparse[id] = npos;
 }
 
-template <typename Component> void ComponentStorage<Component>::reset(EntityId id)
+template <typename Component> void ComponentStorage<Component>::compact(EntityId entityCount)
 {
-    if (!contains(id))
-        return;
-    resetValue<Component>(data[sparse[id]]);
+    if (sparse.size() > entityCount) {
+        sparse.resize(entityCount);
+    }
+    sparse.shrink_to_fit();
+    dense.shrink_to_fit();
+    data.shrink_to_fit();
 }
 
 template <typename... Components> View<Components...> Registry::view()
 {
     return View<Components...>(*this);
 }
+
+template <typename Tag> const std::vector<EntityId>& Registry::tagged(Tag tag) const
+{
+    return tags_.entities(static_cast<std::uint32_t>(tag));
+}
+
+template <typename Tag> bool Registry::hasTag(EntityId id, Tag tag) const
+{
+    return (tags_.mask(id) & static_cast<std::uint32_t>(tag)) != 0;
+}
+
+template <TaggedComponent Component, typename Tag> void Registry::addTag(EntityId id, Tag tag)
+{
+    auto& component = get<Component>(id);
+    component.addTag(tag);
+    tags_.assign(id, TagTraits<Component>::mask(component));
+}
+
+template <TaggedComponent Component, typename Tag> void Registry::removeTag(EntityId id, Tag tag)
+{
+    auto& component = get<Component>(id);
+    component.removeTag(tag);
+    tags_.assign(id, TagTraits<Component>::mask(component));
+}
+
+template <typename... Components, typename Tag> TagView<Components...> Registry::viewTagged(Tag tag)
+{
+    return TagView<Components...>(*this, tagged(tag));
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ecs/Entity.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename Component> struct TagTraits
+{};
+
+template <typename Component>
+concept TaggedComponent = requires(const Component& component) {
+    { TagTraits<Component>::mask(component) } -> std::convertible_to<std::uint32_t>;
+};
+
+class TagIndex
+{
+  public:
+    static constexpr std::size_t kMaxTags = 8;
+
+    void assign(EntityId id, std::uint32_t mask);
+    void erase(EntityId id);
+    void clear();
+    void compact(EntityId entityCount);
+
+    std::uint32_t mask(EntityId id) const;
+    const std::vector<EntityId>& entities(std::uint32_t tag) const;
+
+  private:
+    static constexpr std::uint32_t kAllTags = (1U << kMaxTags) - 1U;
+
+    void insert(std::size_t bit, EntityId id);
+    void removeFrom(std::size_t bit, EntityId id);
+
+    std::array<std::vector<EntityId>, kMaxTags> dense_;
+    std::vector<std::array<std::uint32_t, kMaxTags>> positions_;
+    std::vector<std::uint32_t> masks_;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ecs/Registry.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+template <typename... Components> class TagViewIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = EntityId;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const EntityId*;
+    using reference         = EntityId;
+
+    TagViewIterator(const Registry* registry, const std::vector<EntityId>* ids, std::size_t index);
+
+    EntityId operator*() const;
+    TagViewIterator& operator++();
+    TagViewIterator operator++(int);
+
+    bool operator==(const TagViewIterator& other) const;
+    bool operator!=(const TagViewIterator& other) const;
+
+  private:
+    void skip();
+
+    const Registry* registry_;
+    const std::vector<EntityId>* ids_;
+    std::size_t index_;
+};
+
+template <typename... Components> class TagView
+{
+  public:
+    TagView(Registry& registry, const std::vector<EntityId>& ids);
+
+    TagViewIterator<Components...> begin() const;
+    TagViewIterator<Components...> end() const;
+
+    template <typename Func> void each(Func&& func);
+
+    std::size_t sizeHint() const;
+
+  private:
+    Registry& registry_;
+    const std::vector<EntityId>& ids_;
+};
+
+#include "ecs/TagView.tpp"
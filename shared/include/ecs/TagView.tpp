@@ -0,0 +1,76 @@
+#pragma once
+
+template <typename... Components>
+TagViewIterator<Components...>::TagViewIterator(const Registry* registry, const std::vector<EntityId>* ids,
+                                                std::size_t index)
+    : registry_(registry), ids_(ids), index_(index)
+{
+    skip();
+}
+
+template <typename... Components> EntityId TagViewIterator<Components...>::operator*() const
+{
+    return (*ids_)[index_];
+}
+
+template <typename... Components> TagViewIterator<Components...>& TagViewIterator<Components...>::operator++()
+{
+    ++index_;
+    skip();
+    return *this;
+}
+
+template <typename... Components> TagViewIterator<Components...> TagViewIterator<Components...>::operator++(int)
+{
+    auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+template <typename... Components>
+bool TagViewIterator<Components...>::operator==(const TagViewIterator& other) const
+{
+    return ids_ == other.ids_ && index_ == other.index_;
+}
+
+template <typename... Components>
+bool TagViewIterator<Components...>::operator!=(const TagViewIterator& other) const
+{
+    return !(*this == other);
+}
+
+template <typename... Components> void TagViewIterator<Components...>::skip()
+{
+    while (index_ < ids_->size() && !(registry_->template has<Components>((*ids_)[index_]) && ...)) {
+        ++index_;
+    }
+}
+
+template <typename... Components>
+TagView<Components...>::TagView(Registry& registry, const std::vector<EntityId>& ids) : registry_(registry), ids_(ids)
+{}
+
+template <typename... Components> TagViewIterator<Components...> TagView<Components...>::begin() const
+{
+    return TagViewIterator<Components...>(&registry_, &ids_, 0);
+}
+
+template <typename... Components> TagViewIterator<Components...> TagView<Components...>::end() const
+{
+    return TagViewIterator<Components...>(&registry_, &ids_, ids_.size());
+}
+
+template <typename... Components> template <typename Func> void TagView<Components...>::each(Func&& func)
+{
+    for (std::size_t i = 0; i < ids_.size(); ++i) {
+        const EntityId id = ids_[i];
+        if (!(registry_.template has<Components>(id) && ...))
+            continue;
+        func(id, registry_.template get<Components>(id)...);
+    }
+}
+
+template <typename... Components> std::size_t TagView<Components...>::sizeHint() const
+{
+    return ids_.size();
+}
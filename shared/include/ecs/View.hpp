@@ -3,10 +3,13 @@
 #include "ecs/ComponentTypeId.hpp"
 #include "ecs/Registry.hpp"
 
+#include <array>
 #include <cstddef>
+#include <tuple>
 #include <vector>
 
 template <typename... Components> class ViewIterator;
+template <typename... Components> class ViewEach;
 
 template <typename... Components> class View
 {
@@ -16,9 +19,19 @@ template <typename... Components> class View
     ViewIterator<Components...> begin();
     ViewIterator<Components...> end();
 
+    ViewEach<Components...> each();
+
+    template <typename Func> void eachChunk(Func&& func);
+
   private:
+    using Storages = std::tuple<ComponentStorage<Components>*...>;
+
+    Storages resolveStorages() const;
+    ViewIterator<Components...> first(const Storages& storages);
+    static const std::vector<EntityId>* smallestDense(const Storages& storages);
+
     Registry& registry_;
-    std::vector<std::size_t> componentIndices_;
+    std::array<std::size_t, sizeof...(Components)> componentIndices_;
 };
 
 #include "ecs/View.tpp"
@@ -1,18 +1,89 @@
 #pragma once
 
+#include "ecs/ViewEach.hpp"
 #include "ecs/ViewIterator.hpp"
 
-template <typename... Components> View<Components...>::View(Registry& registry) : registry_(registry)
-{
-    componentIndices_ = {ComponentTypeId::value<Components>()...};
-}
+template <typename... Components>
+View<Components...>::View(Registry& registry)
+    : registry_(registry), componentIndices_{ComponentTypeId::value<Components>()...}
+{}
 
 template <typename... Components> ViewIterator<Components...> View<Components...>::begin()
 {
-    return ViewIterator<Components...>(&registry_, 0, &componentIndices_);
+    return first(resolveStorages());
 }
 
 template <typename... Components> ViewIterator<Components...> View<Components...>::end()
 {
-    return ViewIterator<Components...>(&registry_, registry_.entityCount(), &componentIndices_);
+    return ViewIterator<Components...>(&registry_, nullptr, 0, componentIndices_);
+}
+
+template <typename... Components> ViewEach<Components...> View<Components...>::each()
+{
+    const auto storages = resolveStorages();
+    return ViewEach<Components...>(first(storages), end(), storages);
+}
+
+template <typename... Components> template <typename Func> void View<Components...>::eachChunk(Func&& func)
+{
+    if (registry_.archetypes_) {
+        const auto& archetypes = *registry_.archetypes_;
+        for (std::size_t index = 0; index < archetypes.archetypeCount(); ++index) {
+            const auto& archetype = archetypes.archetype(index);
+            if (!(archetype.contains(ComponentTypeId::value<Components>()) && ...)) {
+                continue;
+            }
+            for (const auto& chunk : archetype.chunks) {
+                if (chunk.entities.empty()) {
+                    continue;
+                }
+                func(chunk.entities.size(), chunk.entities.data(),
+                     static_cast<Components*>(archetype.column(chunk, ComponentTypeId::value<Components>()))...);
+            }
+        }
+        return;
+    }
+    for (auto row : each()) {
+        std::apply([&func](EntityId id, Components&... components) { func(1, &id, &components...); }, row);
+    }
+}
+
+template <typename... Components>
+ViewIterator<Components...> View<Components...>::first(const Storages& storages)
+{
+    if (registry_.archetypes_) {
+        return ViewIterator<Components...>(&registry_, registry_.archetypes_.get(), componentIndices_);
+    }
+    return ViewIterator<Components...>(&registry_, smallestDense(storages), 0, componentIndices_);
+}
+
+template <typename... Components> typename View<Components...>::Storages View<Components...>::resolveStorages() const
+{
+    if (registry_.archetypes_) {
+        return Storages{};
+    }
+    return Storages{registry_.template findStorage<Components>()...};
+}
+
+template <typename... Components>
+const std::vector<EntityId>* View<Components...>::smallestDense(const Storages& storages)
+{
+    const std::vector<EntityId>* smallest = nullptr;
+    bool missing                          = false;
+    std::apply(
+        [&](auto*... storage) {
+            (
+                [&] {
+                    if (storage == nullptr) {
+                        missing = true;
+                        return;
+                    }
+                    if (smallest == nullptr || storage->dense.size() < smallest->size()) {
+                        smallest = &storage->dense;
+                    }
+                }(),
+                ...);
+        },
+        storages);
+    return missing ? nullptr : smallest;
 }
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "ecs/Registry.hpp"
+#include "ecs/ViewIterator.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+template <typename... Components> class ViewEachIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::tuple<EntityId, Components&...>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = value_type;
+    using Storages          = std::tuple<ComponentStorage<Components>*...>;
+
+    ViewEachIterator(ViewIterator<Components...> it, const Storages& storages);
+
+    ViewEachIterator& operator++();
+    ViewEachIterator operator++(int);
+
+    value_type operator*() const;
+
+    bool operator==(const ViewEachIterator& other) const;
+    bool operator!=(const ViewEachIterator& other) const;
+
+  private:
+    template <std::size_t... I> value_type make(std::index_sequence<I...>) const;
+    template <typename Component>
+    Component& fetch(ComponentStorage<Component>* storage, std::size_t componentIndex) const;
+
+    ViewIterator<Components...> it_;
+    Storages storages_;
+};
+
+template <typename... Components> class ViewEach
+{
+  public:
+    using Storages = std::tuple<ComponentStorage<Components>*...>;
+
+    ViewEach(ViewIterator<Components...> first, ViewIterator<Components...> last, const Storages& storages);
+
+    ViewEachIterator<Components...> begin() const;
+    ViewEachIterator<Components...> end() const;
+
+  private:
+    ViewIterator<Components...> first_;
+    ViewIterator<Components...> last_;
+    Storages storages_;
+};
+
+#include "ecs/ViewEach.tpp"
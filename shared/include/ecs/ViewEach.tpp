@@ -0,0 +1,77 @@
+#pragma once
+
+#include <utility>
+
+template <typename... Components>
+ViewEachIterator<Components...>::ViewEachIterator(ViewIterator<Components...> it, const Storages& storages)
+    : it_(std::move(it)), storages_(storages)
+{}
+
+template <typename... Components> ViewEachIterator<Components...>& ViewEachIterator<Components...>::operator++()
+{
+    ++it_;
+    return *this;
+}
+
+template <typename... Components> ViewEachIterator<Components...> ViewEachIterator<Components...>::operator++(int)
+{
+    ViewEachIterator tmp = *this;
+    ++it_;
+    return tmp;
+}
+
+template <typename... Components>
+typename ViewEachIterator<Components...>::value_type ViewEachIterator<Components...>::operator*() const
+{
+    return make(std::index_sequence_for<Components...>{});
+}
+
+template <typename... Components>
+template <std::size_t... I>
+typename ViewEachIterator<Components...>::value_type
+ViewEachIterator<Components...>::make(std::index_sequence<I...>) const
+{
+    return value_type{*it_, fetch(std::get<I>(storages_), ComponentTypeId::value<Components>())...};
+}
+
+template <typename... Components>
+bool ViewEachIterator<Components...>::operator==(const ViewEachIterator& other) const
+{
+    return it_ == other.it_;
+}
+
+template <typename... Components>
+bool ViewEachIterator<Components...>::operator!=(const ViewEachIterator& other) const
+{
+    return !(*this == other);
+}
+
+template <typename... Components>
+template <typename Component>
+Component& ViewEachIterator<Components...>::fetch(ComponentStorage<Component>* storage,
+                                                 std::size_t componentIndex) const
+{
+    if (const auto* archetype = it_.archetype()) {
+        return static_cast<Component*>(archetype->column(*it_.chunk(), componentIndex))[it_.index()];
+    }
+    if (&storage->dense == it_.dense()) {
+        return storage->data[it_.index()];
+    }
+    return storage->data[storage->sparse[*it_]];
+}
+
+template <typename... Components>
+ViewEach<Components...>::ViewEach(ViewIterator<Components...> first, ViewIterator<Components...> last,
+                                  const Storages& storages)
+    : first_(std::move(first)), last_(std::move(last)), storages_(storages)
+{}
+
+template <typename... Components> ViewEachIterator<Components...> ViewEach<Components...>::begin() const
+{
+    return ViewEachIterator<Components...>(first_, storages_);
+}
+
+template <typename... Components> ViewEachIterator<Components...> ViewEach<Components...>::end() const
+{
+    return ViewEachIterator<Components...>(last_, storages_);
+}
@@ -2,7 +2,9 @@
 
 #include "ecs/Registry.hpp"
 
+#include <array>
 #include <cstddef>
+#include <iterator>
 #include <vector>
 
 template <typename... Components> class ViewIterator
@@ -13,8 +15,11 @@ template <typename... Components> class ViewIterator
     using difference_type   = std::ptrdiff_t;
     using pointer           = const EntityId*;
     using reference         = EntityId;
+    using ComponentIndices  = std::array<std::size_t, sizeof...(Components)>;
 
-    ViewIterator(Registry* registry, EntityId id, const std::vector<std::size_t>* componentIndices);
+    ViewIterator(Registry* registry, const std::vector<EntityId>* dense, std::size_t index,
+                 const ComponentIndices& componentIndices);
+    ViewIterator(Registry* registry, const ArchetypeStorage* archetypes, const ComponentIndices& componentIndices);
 
     ViewIterator& operator++();
     ViewIterator operator++(int);
@@ -24,13 +29,27 @@ template <typename... Components> class ViewIterator
     bool operator==(const ViewIterator& other) const;
     bool operator!=(const ViewIterator& other) const;
 
+    const std::vector<EntityId>* dense() const;
+    std::size_t index() const;
+    const Archetype* archetype() const;
+    const ArchetypeChunk* chunk() const;
+
   private:
     void advance();
-    bool matches() const;
+    void advanceArchetype();
+    bool atEnd() const;
+    bool matches(EntityId id) const;
+    bool matches(const Archetype& archetype) const;
+    bool holdsCurrent() const;
 
     Registry* registry_;
+    const std::vector<EntityId>* dense_;
+    const ArchetypeStorage* archetypes_ = nullptr;
+    std::size_t archetype_              = 0;
+    std::size_t chunk_                  = 0;
+    std::size_t index_;
     EntityId currentId_;
-    const std::vector<std::size_t>* componentIndices_;
+    ComponentIndices componentIndices_;
 };
 
 #include "ecs/ViewIterator.tpp"
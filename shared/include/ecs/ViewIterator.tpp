@@ -1,19 +1,32 @@
 #pragma once
 
 template <typename... Components>
-ViewIterator<Components...>::ViewIterator(Registry* registry, EntityId id,
-                                          const std::vector<std::size_t>* componentIndices)
-    : registry_(registry), currentId_(id), componentIndices_(componentIndices)
+ViewIterator<Components...>::ViewIterator(Registry* registry, const std::vector<EntityId>* dense, std::size_t index,
+                                          const ComponentIndices& componentIndices)
+    : registry_(registry), dense_(dense), index_(index), currentId_(0), componentIndices_(componentIndices)
 {
-    if (currentId_ < registry_->entityCount() && !matches()) {
-        advance();
-    }
+    advance();
+}
+
+template <typename... Components>
+ViewIterator<Components...>::ViewIterator(Registry* registry, const ArchetypeStorage* archetypes,
+                                          const ComponentIndices& componentIndices)
+    : registry_(registry), dense_(nullptr), archetypes_(archetypes), index_(0), currentId_(0),
+      componentIndices_(componentIndices)
+{
+    advanceArchetype();
 }
 
 template <typename... Components> ViewIterator<Components...>& ViewIterator<Components...>::operator++()
 {
-    ++currentId_;
-    advance();
+    if (holdsCurrent()) {
+        ++index_;
+    }
+    if (archetypes_ != nullptr) {
+        advanceArchetype();
+    } else {
+        advance();
+    }
     return *this;
 }
 
@@ -31,7 +44,13 @@ template <typename... Components> EntityId ViewIterator<Components...>::operator
 
 template <typename... Components> bool ViewIterator<Components...>::operator==(const ViewIterator& other) const
 {
-    return currentId_ == other.currentId_ && registry_ == other.registry_;
+    const bool end      = atEnd();
+    const bool otherEnd = other.atEnd();
+    if (end || otherEnd) {
+        return end == otherEnd;
+    }
+    return index_ == other.index_ && dense_ == other.dense_ && archetype_ == other.archetype_ &&
+           chunk_ == other.chunk_ && registry_ == other.registry_;
 }
 
 template <typename... Components> bool ViewIterator<Components...>::operator!=(const ViewIterator& other) const
@@ -39,22 +58,95 @@ template <typename... Components> bool ViewIterator<Components...>::operator!=(c
     return !(*this == other);
 }
 
+template <typename... Components> const std::vector<EntityId>* ViewIterator<Components...>::dense() const
+{
+    return dense_;
+}
+
+template <typename... Components> std::size_t ViewIterator<Components...>::index() const
+{
+    return index_;
+}
+
+template <typename... Components> const Archetype* ViewIterator<Components...>::archetype() const
+{
+    return archetypes_ != nullptr ? &archetypes_->archetype(archetype_) : nullptr;
+}
+
+template <typename... Components> const ArchetypeChunk* ViewIterator<Components...>::chunk() const
+{
+    return archetypes_ != nullptr ? &archetypes_->archetype(archetype_).chunks[chunk_] : nullptr;
+}
+
 template <typename... Components> void ViewIterator<Components...>::advance()
 {
-    while (currentId_ < registry_->entityCount() && !matches()) {
-        ++currentId_;
+    while (!atEnd() && !matches((*dense_)[index_])) {
+        ++index_;
+    }
+    if (!atEnd()) {
+        currentId_ = (*dense_)[index_];
+    }
+}
+
+template <typename... Components> void ViewIterator<Components...>::advanceArchetype()
+{
+    while (archetype_ < archetypes_->archetypeCount()) {
+        const auto& archetype = archetypes_->archetype(archetype_);
+        if (matches(archetype) && chunk_ < archetype.chunks.size()) {
+            if (index_ < archetype.chunks[chunk_].entities.size()) {
+                currentId_ = archetype.chunks[chunk_].entities[index_];
+                return;
+            }
+            ++chunk_;
+            index_ = 0;
+            continue;
+        }
+        ++archetype_;
+        chunk_ = 0;
+        index_ = 0;
     }
 }
 
-template <typename... Components> bool ViewIterator<Components...>::matches() const
+template <typename... Components> bool ViewIterator<Components...>::atEnd() const
 {
-    if (!registry_->isAlive(currentId_)) {
+    if (archetypes_ != nullptr) {
+        return archetype_ >= archetypes_->archetypeCount();
+    }
+    return dense_ == nullptr || index_ >= dense_->size();
+}
+
+template <typename... Components> bool ViewIterator<Components...>::matches(EntityId id) const
+{
+    if (!registry_->isAlive(id)) {
         return false;
     }
-    for (std::size_t index : *componentIndices_) {
-        if (!registry_->hasSignatureBit(currentId_, index)) {
+    for (std::size_t index : componentIndices_) {
+        if (!registry_->hasSignatureBit(id, index)) {
             return false;
         }
     }
     return true;
 }
+
+template <typename... Components> bool ViewIterator<Components...>::matches(const Archetype& archetype) const
+{
+    for (std::size_t index : componentIndices_) {
+        if (!archetype.contains(index)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename... Components> bool ViewIterator<Components...>::holdsCurrent() const
+{
+    if (atEnd()) {
+        return false;
+    }
+    if (archetypes_ != nullptr) {
+        const auto& chunks = archetypes_->archetype(archetype_).chunks;
+        return chunk_ < chunks.size() && index_ < chunks[chunk_].entities.size() &&
+               chunks[chunk_].entities[index_] == currentId_;
+    }
+    return (*dense_)[index_] == currentId_;
+}
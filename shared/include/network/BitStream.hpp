@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BitWriter
+{
+  public:
+    void writeBits(std::uint32_t value, unsigned count);
+    void writeBool(bool value);
+    void writeVarUInt(std::uint32_t value, unsigned groupBits = 7);
+    void writeVarInt(std::int32_t value, unsigned groupBits = 7);
+
+    std::size_t bitCount() const;
+    std::size_t byteCount() const;
+    const std::vector<std::uint8_t>& bytes() const;
+    void clear();
+
+    static std::size_t varUIntBits(std::uint32_t value, unsigned groupBits = 7);
+    static std::uint32_t zigZag(std::int32_t value);
+
+  private:
+    std::vector<std::uint8_t> bytes_;
+    std::size_t bits_ = 0;
+};
+
+class BitReader
+{
+  public:
+    BitReader(const std::uint8_t* data, std::size_t size);
+
+    bool readBits(unsigned count, std::uint32_t& out);
+    bool readBool(bool& out);
+    bool readVarUInt(std::uint32_t& out, unsigned groupBits = 7);
+    bool readVarInt(std::int32_t& out, unsigned groupBits = 7);
+
+    std::size_t bitsRemaining() const;
+
+    static std::int32_t unZigZag(std::uint32_t value);
+
+  private:
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::size_t bit_ = 0;
+};
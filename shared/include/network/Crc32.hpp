@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Crc32
+{
+    std::uint32_t ieee(const std::uint8_t* data, std::size_t len) noexcept;
+    std::uint32_t ieeePortable(const std::uint8_t* data, std::size_t len) noexcept;
+
+    std::uint32_t castagnoli(const std::uint8_t* data, std::size_t len) noexcept;
+    std::uint32_t castagnoliPortable(const std::uint8_t* data, std::size_t len) noexcept;
+
+    const char* ieeeBackend() noexcept;
+    const char* castagnoliBackend() noexcept;
+} // namespace Crc32
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -7,5 +8,9 @@ namespace Compression
 {
     std::vector<std::uint8_t> compress(const std::vector<std::uint8_t>& input);
 
+    std::size_t compressBound(std::size_t inputSize);
+
+    std::size_t compressInto(const std::uint8_t* data, std::size_t size, std::uint8_t* out, std::size_t capacity);
+
     std::vector<std::uint8_t> decompress(const std::uint8_t* data, std::size_t compressedLen, std::size_t originalSize);
 } // namespace Compression
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "network/Crc32.hpp"
+
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -109,7 +111,7 @@ struct PacketHeader
     std::uint16_t originalSize = 0;
 
     static constexpr std::array<std::uint8_t, 4> kMagic = {0xA3, 0x5F, 0xC8, 0x1D};
-    static constexpr std::uint8_t kProtocolVersion      = 1;
+    static constexpr std::uint8_t kProtocolVersion      = 2;
     static constexpr std::size_t kSize                  = 17;
     static constexpr std::size_t kCrcSize               = 4;
 
@@ -164,17 +166,7 @@ struct PacketHeader
     {
         if (data == nullptr)
             return 0;
-        std::uint32_t crc = 0xFFFFFFFFu;
-        for (std::size_t i = 0; i < len; ++i) {
-            crc ^= static_cast<std::uint32_t>(data[i]);
-            for (int b = 0; b < 8; ++b) {
-                const bool lsb = (crc & 1u) != 0u;
-                crc >>= 1;
-                if (lsb)
-                    crc ^= 0xEDB88320u;
-            }
-        }
-        return ~crc;
+        return Crc32::ieee(data, len);
     }
 };
 
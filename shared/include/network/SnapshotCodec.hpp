@@ -0,0 +1,64 @@
+#pragma once
+
+#include "network/BitStream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace SnapshotCodec
+{
+    constexpr float kPositionScale = 10.0F;
+    constexpr float kVelocityScale = 10.0F;
+
+    constexpr std::uint16_t kFieldType   = 1 << 0;
+    constexpr std::uint16_t kFieldPosX   = 1 << 1;
+    constexpr std::uint16_t kFieldPosY   = 1 << 2;
+    constexpr std::uint16_t kFieldVelX   = 1 << 3;
+    constexpr std::uint16_t kFieldVelY   = 1 << 4;
+    constexpr std::uint16_t kFieldHealth = 1 << 5;
+    constexpr std::uint16_t kFieldStatus = 1 << 6;
+    constexpr std::uint16_t kFieldScore  = 1 << 10;
+    constexpr std::uint16_t kWireFields  = kFieldType | kFieldPosX | kFieldPosY | kFieldVelX | kFieldVelY |
+                                          kFieldHealth | kFieldStatus | kFieldScore;
+
+    constexpr unsigned kMaskBits       = 8;
+    constexpr unsigned kIdGroupBits    = 4;
+    constexpr unsigned kDeltaWidthBits = 4;
+
+    struct EntityFields
+    {
+        std::uint8_t type   = 0;
+        std::int16_t posX   = 0;
+        std::int16_t posY   = 0;
+        std::int16_t velX   = 0;
+        std::int16_t velY   = 0;
+        std::int16_t health = 0;
+        std::uint8_t status = 0;
+        std::int32_t score  = 0;
+
+        bool operator==(const EntityFields&) const = default;
+    };
+
+    struct EntityHeader
+    {
+        std::uint32_t id   = 0;
+        std::uint16_t mask = 0;
+        bool delta         = false;
+    };
+
+    std::uint8_t compactMask(std::uint16_t mask);
+    std::uint16_t expandMask(std::uint8_t compact);
+    std::uint16_t changedFields(const EntityFields& current, const EntityFields& previous);
+    void apply(EntityFields& target, const EntityFields& source, std::uint16_t mask);
+
+    void writeBaseline(BitWriter& out, std::uint32_t tick, std::optional<std::uint32_t> baselineTick);
+    bool readBaseline(BitReader& in, std::uint32_t tick, std::optional<std::uint32_t>& baselineTick);
+
+    std::size_t entityBits(std::uint32_t idGap, bool hasBaseline, const EntityHeader& header,
+                           const EntityFields& fields, const EntityFields* base);
+    void writeEntity(BitWriter& out, std::uint32_t& nextId, bool hasBaseline, const EntityHeader& header,
+                     const EntityFields& fields, const EntityFields* base);
+    bool readEntityHeader(BitReader& in, std::uint32_t& nextId, bool hasBaseline, EntityHeader& header);
+    bool readEntityFields(BitReader& in, const EntityHeader& header, const EntityFields* base, EntityFields& fields);
+} // namespace SnapshotCodec
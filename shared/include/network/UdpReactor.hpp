@@ -0,0 +1,50 @@
+#pragma once
+
+#include "network/UdpSocket.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class UdpReactor
+{
+  public:
+    using Handler = std::function<void(const std::uint8_t* data, std::size_t size, const IpEndpoint& from)>;
+
+    static constexpr std::size_t kDefaultDatagramSize = 2048;
+    static constexpr std::chrono::milliseconds kInfinite{-1};
+
+    explicit UdpReactor(std::size_t datagramSize = kDefaultDatagramSize);
+    ~UdpReactor();
+
+    UdpReactor(const UdpReactor&)            = delete;
+    UdpReactor& operator=(const UdpReactor&) = delete;
+
+    bool open();
+    void close();
+    bool isOpen() const;
+    bool watch(UdpSocket& socket, Handler handler);
+    std::size_t poll(std::chrono::milliseconds timeout);
+    void wake();
+
+  private:
+    struct Watch
+    {
+        UdpSocket* socket;
+        Handler handler;
+    };
+
+    bool registerHandle(std::intptr_t handle, std::size_t index);
+    std::size_t drain(Watch& watch);
+    void drainWaker();
+
+    std::size_t datagramSize_;
+    std::intptr_t poller_ = -1;
+    UdpSocket waker_;
+    IpEndpoint wakeEndpoint_{};
+    std::vector<Watch> watches_;
+    std::vector<std::uint8_t> storage_;
+    std::vector<UdpRecvBuffer> buffers_;
+};
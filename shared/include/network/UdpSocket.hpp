@@ -3,6 +3,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 enum class UdpError
 {
@@ -39,6 +40,21 @@ struct IpEndpoint
     }
 };
 
+struct UdpDatagram
+{
+    const std::uint8_t* data;
+    std::size_t size;
+    IpEndpoint dst;
+};
+
+struct UdpRecvBuffer
+{
+    std::uint8_t* data;
+    std::size_t capacity;
+    std::size_t size;
+    IpEndpoint src;
+};
+
 class UdpSocket
 {
   public:
@@ -51,8 +67,13 @@ class UdpSocket
     bool setRecvBuffer(int bytes);
     bool setSendBuffer(int bytes);
     UdpResult sendTo(const std::uint8_t* data, std::size_t len, const IpEndpoint& dst);
+    UdpResult sendBatch(std::span<const UdpDatagram> datagrams);
     UdpResult recvFrom(std::uint8_t* buf, std::size_t len, IpEndpoint& src);
+    UdpResult recvBatch(std::span<UdpRecvBuffer> buffers);
     IpEndpoint localEndpoint() const;
+    std::intptr_t nativeHandle() const;
+
+    static constexpr std::size_t kMaxBatch = 64;
 
   private:
     std::intptr_t fd_;
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class HdrHistogram
+{
+  public:
+    static constexpr unsigned kSubBucketBits    = 6;
+    static constexpr std::uint64_t kSubBuckets  = 1ULL << kSubBucketBits;
+    static constexpr std::uint64_t kHalfBuckets = kSubBuckets / 2;
+    static constexpr unsigned kMaxValueBits     = 36;
+    static constexpr std::uint64_t kMaxValue    = (1ULL << kMaxValueBits) - 1;
+    static constexpr std::size_t kBucketCount   = kSubBuckets + (kMaxValueBits - kSubBucketBits) * kHalfBuckets;
+
+    void record(std::uint64_t value);
+    void merge(const HdrHistogram& other);
+    void reset();
+
+    std::uint64_t count() const
+    {
+        return count_;
+    }
+
+    std::uint64_t min() const
+    {
+        return count_ == 0 ? 0 : min_;
+    }
+
+    std::uint64_t max() const
+    {
+        return max_;
+    }
+
+    double mean() const;
+    std::uint64_t valueAtPercentile(double percentile) const;
+
+    static std::size_t bucketIndex(std::uint64_t value);
+    static std::uint64_t bucketUpperBound(std::size_t index);
+
+  private:
+    std::array<std::uint32_t, kBucketCount> counts_{};
+    std::uint64_t count_ = 0;
+    std::uint64_t min_   = kMaxValue;
+    std::uint64_t max_   = 0;
+    double sum_          = 0.0;
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "profiling/HdrHistogram.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct ZoneStats
+{
+    const char* name    = "";
+    std::uint64_t count = 0;
+    std::chrono::nanoseconds mean{0};
+    std::chrono::nanoseconds p50{0};
+    std::chrono::nanoseconds p99{0};
+    std::chrono::nanoseconds max{0};
+};
+
+struct ZoneEvent
+{
+    std::uint16_t zone  = 0;
+    std::uint16_t depth = 0;
+    std::int64_t start  = 0;
+    std::int64_t end    = 0;
+};
+
+class TickProfiler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t kDefaultTraceTicks = 120;
+
+    explicit TickProfiler(std::size_t traceTicks = kDefaultTraceTicks);
+
+    TickProfiler(const TickProfiler&)            = delete;
+    TickProfiler& operator=(const TickProfiler&) = delete;
+
+    static std::uint16_t registerZone(const char* name);
+    static const char* zoneName(std::uint16_t zone);
+    static std::int64_t now();
+
+    static TickProfiler* current()
+    {
+        return current_;
+    }
+
+    void beginTick(std::uint32_t tick);
+    void endTick();
+
+    std::uint16_t enter()
+    {
+        return depth_++;
+    }
+
+    void leave(std::uint16_t zone, std::uint16_t depth, std::int64_t start, std::int64_t end)
+    {
+        --depth_;
+        events_.push_back({zone, depth, start, end});
+    }
+
+    std::vector<ZoneStats> stats() const;
+    std::uint64_t ticks() const;
+    void reset();
+    bool writeChromeTrace(const std::string& path, int threadId, const std::string& threadName) const;
+
+  private:
+    struct TickTrace
+    {
+        std::uint32_t tick = 0;
+        std::vector<ZoneEvent> events;
+    };
+
+    static thread_local TickProfiler* current_;
+
+    TickProfiler* previous_ = nullptr;
+    std::uint32_t tick_     = 0;
+    std::uint16_t depth_    = 0;
+    std::vector<ZoneEvent> events_;
+    std::vector<std::int64_t> tickTotals_;
+    std::vector<std::uint16_t> touched_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<HdrHistogram>> histograms_;
+    std::vector<TickTrace> trace_;
+    std::size_t traceNext_  = 0;
+    std::size_t traceCount_ = 0;
+    std::uint64_t ticks_    = 0;
+};
+
+class ProfileZone
+{
+  public:
+    explicit ProfileZone(std::uint16_t zone) : profiler_(TickProfiler::current()), zone_(zone)
+    {
+        if (profiler_ != nullptr) {
+            depth_ = profiler_->enter();
+            start_ = TickProfiler::now();
+        }
+    }
+
+    ~ProfileZone()
+    {
+        if (profiler_ != nullptr)
+            profiler_->leave(zone_, depth_, start_, TickProfiler::now());
+    }
+
+    ProfileZone(const ProfileZone&)            = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+  private:
+    TickProfiler* profiler_;
+    std::uint16_t zone_;
+    std::uint16_t depth_ = 0;
+    std::int64_t start_  = 0;
+};
+
+class ProfileTick
+{
+  public:
+    ProfileTick(TickProfiler& profiler, std::uint32_t tick);
+    ~ProfileTick();
+
+    ProfileTick(const ProfileTick&)            = delete;
+    ProfileTick& operator=(const ProfileTick&) = delete;
+
+  private:
+    TickProfiler& profiler_;
+    std::uint16_t depth_;
+    std::int64_t start_;
+};
+
+#define RTYPE_PROFILE_CONCAT_INNER(a, b) a##b
+#define RTYPE_PROFILE_CONCAT(a, b) RTYPE_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name)                                                                                             \
+    static const std::uint16_t RTYPE_PROFILE_CONCAT(rtypeZoneId, __LINE__) = TickProfiler::registerZone(name);         \
+    ProfileZone RTYPE_PROFILE_CONCAT(rtypeZone, __LINE__)(RTYPE_PROFILE_CONCAT(rtypeZoneId, __LINE__))
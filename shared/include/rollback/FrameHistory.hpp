@@ -0,0 +1,97 @@
+#pragma once
+
+#include "ecs/Entity.hpp"
+#include "rollback/FrameHistoryStorage.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template <typename State> class FrameHistory
+{
+    static_assert(std::is_trivially_copyable_v<State>, "FrameHistory stores states as raw bytes");
+    static_assert(sizeof(State) <= FrameHistoryStorage::kMaxStateSize, "State is too large for FrameHistory");
+
+  public:
+    struct Frame
+    {
+        std::uint64_t tick = 0;
+        std::vector<EntityId> ids;
+        std::vector<State> states;
+        std::uint32_t checksum = 0;
+    };
+
+    explicit FrameHistory(std::size_t window,
+                          std::size_t keyframeInterval = FrameHistoryStorage::kDefaultKeyframeInterval)
+        : storage_(sizeof(State), window, keyframeInterval)
+    {}
+
+    void addSnapshot(std::uint64_t tick, std::span<const EntityId> ids, std::span<const State> states,
+                     std::uint32_t checksum)
+    {
+        storage_.push(tick, ids.first(std::min(ids.size(), states.size())),
+                      reinterpret_cast<const std::uint8_t*>(states.data()), checksum);
+    }
+
+    bool getSnapshot(std::uint64_t tick, Frame& out) const
+    {
+        auto bytes = storage_.decode(tick, out.ids);
+        if (!bytes)
+            return false;
+        out.tick = tick;
+        out.states.resize(out.ids.size());
+        if (!bytes->empty())
+            std::memcpy(out.states.data(), bytes->data(), bytes->size());
+        out.checksum = *storage_.checksum(tick);
+        return true;
+    }
+
+    bool hasSnapshot(std::uint64_t tick) const
+    {
+        return storage_.contains(tick);
+    }
+
+    std::optional<std::uint32_t> getChecksum(std::uint64_t tick) const
+    {
+        return storage_.checksum(tick);
+    }
+
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> getTickRange() const
+    {
+        return storage_.tickRange();
+    }
+
+    void clear()
+    {
+        storage_.clear();
+    }
+
+    std::size_t size() const
+    {
+        return storage_.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    std::size_t window() const
+    {
+        return storage_.window();
+    }
+
+    std::size_t arenaBytes() const
+    {
+        return storage_.arenaBytes();
+    }
+
+  private:
+    FrameHistoryStorage storage_;
+};
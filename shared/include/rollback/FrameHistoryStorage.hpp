@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+class FrameHistoryStorage
+{
+  public:
+    static constexpr std::size_t kMaxStateSize            = 64;
+    static constexpr std::size_t kDefaultKeyframeInterval = 8;
+    static constexpr std::size_t kInitialFrameBytes       = 512;
+
+    FrameHistoryStorage(std::size_t stateSize, std::size_t window, std::size_t keyframeInterval);
+
+    void push(std::uint64_t tick, std::span<const std::uint32_t> ids, const std::uint8_t* states,
+              std::uint32_t checksum);
+    std::optional<std::span<const std::uint8_t>> decode(std::uint64_t tick, std::vector<std::uint32_t>& ids) const;
+
+    bool contains(std::uint64_t tick) const;
+    std::optional<std::uint32_t> checksum(std::uint64_t tick) const;
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> tickRange() const;
+    std::size_t size() const;
+    std::size_t window() const;
+    std::size_t arenaBytes() const;
+    void clear();
+
+  private:
+    struct Slot
+    {
+        std::uint64_t tick     = 0;
+        std::uint64_t keyTick  = 0;
+        std::size_t offset     = 0;
+        std::size_t bytes      = 0;
+        std::uint32_t checksum = 0;
+        bool valid             = false;
+    };
+
+    std::size_t slotIndex(std::uint64_t tick) const;
+    const Slot* find(std::uint64_t tick) const;
+    bool live(const Slot& slot, std::uint64_t tick) const;
+    void encode(std::span<const std::uint32_t> ids, const std::uint8_t* states, bool keyframe);
+    void decodeFrame(const Slot& slot, std::size_t from, std::size_t to) const;
+    std::size_t reserve(std::size_t bytes, std::uint64_t tick);
+    bool overlaps(std::size_t offset, std::size_t bytes, std::uint64_t tick) const;
+    void grow(std::size_t bytes, std::uint64_t tick);
+
+    std::size_t stateSize_;
+    std::size_t window_;
+    std::size_t keyframeInterval_;
+    std::vector<Slot> slots_;
+    std::vector<std::uint8_t> arena_;
+    std::size_t head_ = 0;
+    std::optional<std::uint64_t> latest_;
+    std::size_t sinceKeyframe_ = 0;
+    std::vector<std::uint32_t> lastIds_;
+    std::vector<std::uint8_t> lastStates_;
+    std::vector<std::uint8_t> encoded_;
+    mutable std::array<std::vector<std::uint32_t>, 2> decodedIds_;
+    mutable std::array<std::vector<std::uint8_t>, 2> decodedStates_;
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ecs/Entity.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct StateHashFields
+{
+    float posX          = 0.0F;
+    float posY          = 0.0F;
+    std::int16_t health = 0;
+};
+
+class StateHash
+{
+  public:
+    static std::uint32_t entityHash(EntityId id, const StateHashFields& fields);
+    static std::uint32_t combine(std::uint32_t sum, std::uint32_t count);
+
+    bool update(EntityId id, const StateHashFields& fields);
+    void erase(EntityId id);
+    void retain(std::span<const EntityId> sortedIds);
+    std::uint32_t value() const;
+    std::size_t size() const;
+    void clear();
+
+  private:
+    struct Entry
+    {
+        bool present = false;
+        StateHashFields fields{};
+        std::uint32_t hash = 0;
+    };
+
+    std::vector<Entry> entries_;
+    std::uint32_t sum_   = 0;
+    std::uint32_t count_ = 0;
+};
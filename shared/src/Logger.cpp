@@ -1,5 +1,8 @@
 #include "Logger.hpp"
 
+#include "concurrency/SpscQueue.hpp"
+
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <filesystem>
@@ -8,13 +11,57 @@
 #include <iostream>
 #include <sstream>
 
+namespace
+{
+    constexpr std::size_t kRingCapacity = 512;
+    constexpr std::chrono::milliseconds kWriterInterval{20};
+
+    thread_local bool tlsWriterThread = false;
+
+    const char* levelName(LogLevel level)
+    {
+        switch (level) {
+            case LogLevel::Trace:
+                return "TRACE";
+            case LogLevel::Debug:
+                return "DEBUG";
+            case LogLevel::Info:
+                return "INFO";
+            case LogLevel::Warn:
+                return "WARN";
+            case LogLevel::Error:
+                return "ERROR";
+        }
+        return "INFO";
+    }
+
+    LogLevel parseLevel(const std::string& level)
+    {
+        if (level == "WARN")
+            return LogLevel::Warn;
+        if (level == "ERROR")
+            return LogLevel::Error;
+        if (level == "DEBUG" || level == "VERBOSE")
+            return LogLevel::Debug;
+        if (level == "TRACE")
+            return LogLevel::Trace;
+        return LogLevel::Info;
+    }
+} // namespace
+
+struct Logger::Ring
+{
+    SpscQueue<LogRecord> queue{kRingCapacity};
+    std::atomic<bool> retired{false};
+};
+
 Logger& Logger::instance()
 {
     static Logger instance;
     return instance;
 }
 
-Logger::Logger() : _verbose(false), _tagFilterActive(false)
+Logger::Logger() : _tagFilterActive(false)
 {
     const std::filesystem::path directory("logs");
     const std::filesystem::path filePath = directory / "server.log";
@@ -25,10 +72,21 @@ Logger::Logger() : _verbose(false), _tagFilterActive(false)
     }
 
     _file.open(filePath, std::ios::app);
+    _running.store(true, std::memory_order_release);
+    _writer = std::thread(&Logger::writerLoop, this);
 }
 
 Logger::~Logger()
 {
+    _running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _stopping = true;
+    }
+    _wakeCv.notify_one();
+    if (_writer.joinable())
+        _writer.join();
+
     std::lock_guard<std::mutex> lock(_mutex);
     if (_file.is_open()) {
         _file.flush();
@@ -45,228 +103,404 @@ Logger::~Logger()
 
 void Logger::setVerbose(bool enabled)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _verbose = enabled;
+    _verbose.store(enabled, std::memory_order_relaxed);
+    bumpTagGeneration();
 }
 
 void Logger::loadTagConfig(const std::string& configPath)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _enabledTags.clear();
-    _tagFilterActive = false;
-
-    std::ifstream file(configPath);
-    if (!file.is_open()) {
-        return;
-    }
-
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty() || line[0] == '#') {
-            continue;
-        }
-        size_t start = line.find('[');
-        size_t end   = line.find(']');
-        if (start != std::string::npos && end != std::string::npos && end > start) {
-            std::string tag = line.substr(start, end - start + 1);
-            _enabledTags.insert(tag);
-        }
-    }
-    _tagFilterActive = !_enabledTags.empty();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enabledTags.clear();
+        _tagFilterActive = false;
+
+        std::ifstream file(configPath);
+        if (file.is_open()) {
+            std::string line;
+            while (std::getline(file, line)) {
+                if (line.empty() || line[0] == '#') {
+                    continue;
+                }
+                size_t start = line.find('[');
+                size_t end   = line.find(']');
+                if (start != std::string::npos && end != std::string::npos && end > start) {
+                    std::string tag = line.substr(start, end - start + 1);
+                    _enabledTags.insert(tag);
+                }
+            }
+            _tagFilterActive = !_enabledTags.empty();
 
-    if (_verbose) {
-        std::cout << "[Logger] Loaded " << _enabledTags.size() << " tags from " << configPath << "\n";
-        for (const auto& tag : _enabledTags) {
-            std::cout << "[Logger]   - " << tag << "\n";
+            if (_verbose) {
+                std::cout << "[Logger] Loaded " << _enabledTags.size() << " tags from " << configPath << "\n";
+                for (const auto& tag : _enabledTags) {
+                    std::cout << "[Logger]   - " << tag << "\n";
+                }
+            }
         }
     }
+    bumpTagGeneration();
 }
 
-std::string Logger::extractTag(const std::string& message)
+std::string_view Logger::extractTag(std::string_view message)
 {
     if (message.empty() || message[0] != '[') {
-        return "";
+        return {};
     }
     size_t end = message.find(']');
-    if (end == std::string::npos) {
-        return "";
+    if (end == std::string_view::npos) {
+        return {};
     }
     return message.substr(0, end + 1);
 }
 
-bool Logger::isTagEnabled(const std::string& message) const
+bool Logger::isTagEnabled(std::string_view message) const
 {
     if (!_tagFilterActive) {
         return true;
     }
-    std::string tag = extractTag(message);
+    std::string_view tag = extractTag(message);
     if (tag.empty()) {
         return true;
     }
-    return _enabledTags.contains(tag);
+    return _enabledTags.contains(std::string(tag));
+}
+
+bool Logger::refreshSite(LogSite& site, std::uint32_t generation)
+{
+    bool allowed = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        allowed = isTagEnabled(site.tag);
+    }
+    site.state.store((generation << 1) | (allowed ? 1u : 0u), std::memory_order_relaxed);
+    return allowed;
+}
+
+void Logger::bumpTagGeneration()
+{
+    _tagGeneration.fetch_add(1, std::memory_order_acq_rel);
 }
 
 void Logger::info(const std::string& message)
 {
-    log(-1, "INFO", message, false);
+    log(-1, LogLevel::Info, message);
 }
 
 void Logger::warn(const std::string& message)
 {
-    log(-1, "WARN", message, true);
+    log(-1, LogLevel::Warn, message);
 }
 
 void Logger::error(const std::string& message)
 {
-    log(-1, "ERROR", message, true);
+    log(-1, LogLevel::Error, message);
 }
 
 void Logger::verbose(const std::string& message)
 {
-    log(-1, "VERBOSE", message, false);
+    log(-1, LogLevel::Debug, message);
 }
 
 void Logger::logToRoom(int roomId, const std::string& level, const std::string& message)
 {
-    log(roomId, level, message, false);
+    log(roomId, parseLevel(level), message);
 }
 
-void Logger::addBytesSent(std::size_t bytes)
+void Logger::log(int roomId, LogLevel level, const std::string& message)
 {
-    _totalBytesSent += bytes;
+    LogRecord record;
+    record.time   = std::chrono::system_clock::now();
+    record.roomId = roomId;
+    record.level  = level;
+    record.append(message);
+    submit(std::move(record));
 }
 
-void Logger::addBytesReceived(std::size_t bytes)
+Logger::Ring& Logger::localRing()
 {
-    _totalBytesReceived += bytes;
+    struct Handle
+    {
+        std::shared_ptr<Ring> ring;
+
+        ~Handle()
+        {
+            if (ring)
+                ring->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    thread_local Handle handle;
+    if (!handle.ring) {
+        handle.ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> lock(_ringsMutex);
+        _rings.push_back(handle.ring);
+    }
+    return *handle.ring;
 }
 
-void Logger::addPacketSent()
+void Logger::submit(LogRecord&& record)
 {
-    _totalPacketsSent++;
+    const LogLevel level = record.level;
+    const bool onWriter  = tlsWriterThread;
+    if (!_running.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        emit(record);
+        return;
+    }
+
+    Ring& ring = localRing();
+    while (!ring.queue.push(std::move(record))) {
+        if (level < LogLevel::Info || onWriter || !_running.load(std::memory_order_acquire)) {
+            _droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            _droppedSinceReport.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        wake();
+        std::this_thread::yield();
+    }
+
+    if (level == LogLevel::Error && !onWriter)
+        flush();
+    else if (level == LogLevel::Warn)
+        wake();
 }
 
-void Logger::addPacketReceived()
+void Logger::wake()
 {
-    _totalPacketsReceived++;
+    {
+        std::lock_guard<std::mutex> lock(_wakeMutex);
+        _wakePending = true;
+    }
+    _wakeCv.notify_one();
 }
 
-void Logger::addPacketDropped()
+void Logger::flush()
 {
-    _totalPacketsDropped++;
+    std::unique_lock<std::mutex> lock(_wakeMutex);
+    if (!_running.load(std::memory_order_acquire) || _stopping || tlsWriterThread)
+        return;
+    const std::uint64_t ticket = ++_flushTicket;
+    _wakeCv.notify_one();
+    _flushedCv.wait(lock, [&] { return _flushedTicket >= ticket || _stopping; });
 }
 
-void Logger::setConsoleOutputEnabled(bool enabled)
+std::uint64_t Logger::getDroppedRecords() const
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _consoleEnabled = enabled;
+    return _droppedRecords.load(std::memory_order_relaxed);
 }
 
-void Logger::setPostLogCallback(std::function<void(const std::string&)> callback)
+void Logger::writerLoop()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _postLogCallback = std::move(callback);
+    tlsWriterThread = true;
+    std::vector<LogRecord> batch;
+    std::unique_lock<std::mutex> lock(_wakeMutex);
+    while (true) {
+        const bool stopping        = _stopping;
+        const std::uint64_t ticket = _flushTicket;
+        _wakePending               = false;
+        lock.unlock();
+
+        drainRings(batch);
+
+        lock.lock();
+        _flushedTicket = ticket;
+        _flushedCv.notify_all();
+        if (stopping)
+            break;
+        _wakeCv.wait_for(lock, kWriterInterval,
+                         [&] { return _stopping || _wakePending || _flushTicket != _flushedTicket; });
+    }
 }
 
-void Logger::logNetworkStats()
+void Logger::drainRings(std::vector<LogRecord>& batch)
 {
-    std::size_t sent     = _totalBytesSent.exchange(0);
-    std::size_t received = _totalBytesReceived.exchange(0);
-    std::size_t dropped  = _totalPacketsDropped.exchange(0);
+    {
+        std::lock_guard<std::mutex> lock(_ringsMutex);
+        for (auto it = _rings.begin(); it != _rings.end();) {
+            const bool retired = (*it)->retired.load(std::memory_order_acquire);
+            (*it)->queue.drainInto(batch);
+            if (retired && (*it)->queue.empty())
+                it = _rings.erase(it);
+            else
+                ++it;
+        }
+    }
 
-    info("[Net] Network Stats (last 5s): Sent=" + std::to_string(sent) +
-         " bytes, Received=" + std::to_string(received) + " bytes, Dropped=" + std::to_string(dropped) + " packets");
-}
+    if (const std::uint64_t dropped = _droppedSinceReport.exchange(0, std::memory_order_relaxed); dropped > 0) {
+        LogRecord notice;
+        notice.time  = std::chrono::system_clock::now();
+        notice.level = LogLevel::Warn;
+        notice.append("[Logger] Dropped ");
+        notice.appendValue(dropped);
+        notice.append(" records (ring full)");
+        batch.push_back(std::move(notice));
+    }
+    if (batch.empty())
+        return;
 
-void Logger::log(int roomId, const std::string& level, const std::string& message, bool alwaysConsole)
-{
-    const auto now         = std::chrono::system_clock::now();
-    const std::time_t time = std::chrono::system_clock::to_time_t(now);
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const LogRecord& a, const LogRecord& b) { return a.time < b.time; });
 
     std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& record : batch)
+        emit(record);
+    if (_file.is_open())
+        _file.flush();
+    for (auto& [id, file] : _roomFiles) {
+        if (file && file->is_open())
+            file->flush();
+    }
+    batch.clear();
+}
+
+const std::string& Logger::timestampFor(std::chrono::system_clock::time_point time)
+{
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+    if (seconds == _timestampSecond)
+        return _timestamp;
 
     std::tm timeInfo{};
-    std::tm* localTime = std::localtime(&time);
+    std::tm* localTime = std::localtime(&seconds);
     if (localTime != nullptr) {
         timeInfo = *localTime;
     }
 
     std::ostringstream stream;
     stream << std::put_time(&timeInfo, "%Y-%m-%d %H:%M:%S");
-    const std::string timestamp = stream.str();
+    _timestamp       = stream.str();
+    _timestampSecond = seconds;
+    return _timestamp;
+}
 
-    std::string roomTag;
-    if (roomId >= 0) {
-        roomTag = "[Room " + std::to_string(roomId) + "]";
+void Logger::emit(const LogRecord& record)
+{
+    const std::string& timestamp = timestampFor(record.time);
+    const std::string_view message = record.view();
+    const char* level              = levelName(record.level);
+
+    _line.clear();
+    _line.append("[").append(timestamp).append("]");
+    if (record.roomId >= 0) {
+        _line.append("[Room ").append(std::to_string(record.roomId)).append("]");
     } else {
-        roomTag = "[System]";
+        _line.append("[System]");
     }
-
-    const std::string line = "[" + timestamp + "]" + roomTag + "[" + level + "] " + message + '\n';
+    _line.append("[").append(level).append("] ").append(message).append("\n");
 
     if (_file.is_open()) {
-        _file << line;
-        _file.flush();
+        _file << _line;
     }
 
-    if (roomId >= 0) {
-        auto it = _roomFiles.find(roomId);
+    if (record.roomId >= 0) {
+        auto it = _roomFiles.find(record.roomId);
         if (it == _roomFiles.end()) {
             std::filesystem::path directory("logs");
-            std::filesystem::path filePath = directory / ("room_" + std::to_string(roomId) + ".log");
+            std::filesystem::path filePath = directory / ("room_" + std::to_string(record.roomId) + ".log");
             auto newFile                   = std::make_unique<std::ofstream>(filePath, std::ios::app);
             if (newFile->is_open()) {
-                auto res = _roomFiles.emplace(roomId, std::move(newFile));
+                auto res = _roomFiles.emplace(record.roomId, std::move(newFile));
                 it       = res.first;
             }
         }
 
         if (it != _roomFiles.end() && it->second && it->second->is_open()) {
-            const std::string roomLine = "[" + timestamp + "][" + level + "] " + message + '\n';
-            *(it->second) << roomLine;
-            it->second->flush();
+            *(it->second) << "[" << timestamp << "][" << level << "] " << message << '\n';
         }
     }
 
-    bool tagAllowed = isTagEnabled(message);
-    bool shouldLog  = alwaysConsole || (level == "ERROR") || (_verbose && tagAllowed);
+    const bool alwaysConsole = record.roomId < 0 && record.level >= LogLevel::Warn;
+    bool tagAllowed          = isTagEnabled(message);
+    bool shouldLog           = alwaysConsole || (record.level == LogLevel::Error) || (_verbose && tagAllowed);
 
     if (!shouldLog)
         return;
 
     if (_consoleEnabled) {
-        if (level == "ERROR") {
-            std::cerr << line;
+        if (record.level == LogLevel::Error) {
+            std::cerr << _line;
         } else {
-            std::cout << line;
+            std::cout << _line;
         }
     }
 
     if (_postLogCallback) {
-        _postLogCallback(line);
+        _postLogCallback(_line);
     }
 }
 
-void Logger::addTag(const std::string& tag)
+void Logger::addBytesSent(std::size_t bytes)
+{
+    _totalBytesSent += bytes;
+}
+
+void Logger::addBytesReceived(std::size_t bytes)
+{
+    _totalBytesReceived += bytes;
+}
+
+void Logger::addPacketSent()
+{
+    _totalPacketsSent++;
+}
+
+void Logger::addPacketReceived()
+{
+    _totalPacketsReceived++;
+}
+
+void Logger::addPacketDropped()
+{
+    _totalPacketsDropped++;
+}
+
+void Logger::setConsoleOutputEnabled(bool enabled)
 {
     std::lock_guard<std::mutex> lock(_mutex);
-    std::string formattedTag = tag;
+    _consoleEnabled = enabled;
+}
+
+void Logger::setPostLogCallback(std::function<void(const std::string&)> callback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _postLogCallback = std::move(callback);
+}
+
+void Logger::logNetworkStats()
+{
+    std::size_t sent     = _totalBytesSent.exchange(0);
+    std::size_t received = _totalBytesReceived.exchange(0);
+    std::size_t dropped  = _totalPacketsDropped.exchange(0);
+
+    write(LogLevel::Info, -1, "[Net]", "Network Stats (last 5s): Sent=", sent, " bytes, Received=", received,
+          " bytes, Dropped=", dropped, " packets");
+}
+
+std::string Logger::formatTag(const std::string& tag)
+{
     if (!tag.empty() && tag[0] != '[') {
-        formattedTag = "[" + tag + "]";
+        return "[" + tag + "]";
+    }
+    return tag;
+}
+
+void Logger::addTag(const std::string& tag)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enabledTags.insert(formatTag(tag));
+        _tagFilterActive = !_enabledTags.empty();
     }
-    _enabledTags.insert(formattedTag);
-    _tagFilterActive = !_enabledTags.empty();
+    bumpTagGeneration();
 }
 
 void Logger::removeTag(const std::string& tag)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    std::string formattedTag = tag;
-    if (!tag.empty() && tag[0] != '[') {
-        formattedTag = "[" + tag + "]";
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enabledTags.erase(formatTag(tag));
+        _tagFilterActive = !_enabledTags.empty();
     }
-    _enabledTags.erase(formattedTag);
-    _tagFilterActive = !_enabledTags.empty();
+    bumpTagGeneration();
 }
 
 std::vector<std::string> Logger::getEnabledTags() const
@@ -286,9 +520,5 @@ std::vector<std::string> Logger::getAllKnownTags() const
 bool Logger::hasTag(const std::string& tag) const
 {
     std::lock_guard<std::mutex> lock(_mutex);
-    std::string formattedTag = tag;
-    if (!tag.empty() && tag[0] != '[') {
-        formattedTag = "[" + tag + "]";
-    }
-    return _enabledTags.contains(formattedTag);
+    return _enabledTags.contains(formatTag(tag));
 }
@@ -0,0 +1,218 @@
+#include "ecs/ArchetypeStorage.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace
+{
+    std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    std::byte* allocateBlock(std::size_t bytes)
+    {
+        return static_cast<std::byte*>(
+            ::operator new(std::max<std::size_t>(bytes, 1), std::align_val_t{ArchetypeStorage::kColumnAlign}));
+    }
+} // namespace
+
+void ArchetypeBlockDeleter::operator()(std::byte* block) const
+{
+    ::operator delete(block, std::align_val_t{ArchetypeStorage::kColumnAlign});
+}
+
+bool Archetype::contains(std::size_t componentIndex) const
+{
+    return componentIndex < columns.size() && columns[componentIndex] != ArchetypeStorage::npos;
+}
+
+void* Archetype::column(const ArchetypeChunk& chunk, std::size_t componentIndex) const
+{
+    return chunk.block.get() + offsets[columns[componentIndex]];
+}
+
+ArchetypeStorage::~ArchetypeStorage()
+{
+    clear();
+}
+
+void ArchetypeStorage::remove(EntityId id, std::size_t componentIndex)
+{
+    if (id >= locations_.size())
+        return;
+    const std::size_t current = locations_[id].archetype;
+    if (current == npos || !archetypes_[current].contains(componentIndex))
+        return;
+    migrate(id, removeTarget(current, componentIndex));
+}
+
+void ArchetypeStorage::destroy(EntityId id)
+{
+    if (id >= locations_.size() || locations_[id].archetype == npos)
+        return;
+    migrate(id, npos);
+}
+
+void ArchetypeStorage::clear()
+{
+    for (auto& archetype : archetypes_) {
+        destroyRows(archetype);
+    }
+    archetypes_.clear();
+    lookup_.clear();
+    locations_.clear();
+}
+
+void ArchetypeStorage::compact(EntityId entityCount)
+{
+    if (locations_.size() > entityCount)
+        locations_.resize(entityCount);
+    locations_.shrink_to_fit();
+    for (auto& archetype : archetypes_) {
+        while (!archetype.chunks.empty() && archetype.chunks.back().entities.empty()) {
+            archetype.chunks.pop_back();
+        }
+        archetype.chunks.shrink_to_fit();
+    }
+}
+
+std::size_t ArchetypeStorage::archetypeCount() const
+{
+    return archetypes_.size();
+}
+
+const Archetype& ArchetypeStorage::archetype(std::size_t index) const
+{
+    return archetypes_[index];
+}
+
+void* ArchetypeStorage::componentAt(const Location& location, std::size_t componentIndex) const
+{
+    const auto& archetype = archetypes_[location.archetype];
+    const auto& chunk     = archetype.chunks[location.chunk];
+    return static_cast<std::byte*>(archetype.column(chunk, componentIndex)) +
+           location.row * archetype.sizes[archetype.columns[componentIndex]];
+}
+
+std::size_t ArchetypeStorage::addTarget(std::size_t from, std::size_t componentIndex)
+{
+    if (from == npos)
+        return findOrCreateArchetype({componentIndex});
+    if (const auto it = archetypes_[from].addEdges.find(componentIndex); it != archetypes_[from].addEdges.end())
+        return it->second;
+    auto components = archetypes_[from].components;
+    components.insert(std::upper_bound(components.begin(), components.end(), componentIndex), componentIndex);
+    const std::size_t target                   = findOrCreateArchetype(components);
+    archetypes_[from].addEdges[componentIndex] = target;
+    return target;
+}
+
+std::size_t ArchetypeStorage::removeTarget(std::size_t from, std::size_t componentIndex)
+{
+    if (const auto it = archetypes_[from].removeEdges.find(componentIndex); it != archetypes_[from].removeEdges.end())
+        return it->second;
+    auto components = archetypes_[from].components;
+    components.erase(std::find(components.begin(), components.end(), componentIndex));
+    const std::size_t target                      = components.empty() ? npos : findOrCreateArchetype(components);
+    archetypes_[from].removeEdges[componentIndex] = target;
+    return target;
+}
+
+std::size_t ArchetypeStorage::findOrCreateArchetype(const std::vector<std::size_t>& components)
+{
+    if (const auto it = lookup_.find(components); it != lookup_.end())
+        return it->second;
+
+    Archetype archetype;
+    archetype.components = components;
+    archetype.columns.assign(components.back() + 1, npos);
+    std::size_t rowBytes = 0;
+    for (std::size_t column = 0; column < components.size(); ++column) {
+        const auto& info                      = infos_[components[column]];
+        archetype.columns[components[column]] = column;
+        archetype.sizes.push_back(info.size);
+        rowBytes += info.size;
+    }
+    archetype.capacity = std::max<std::size_t>(1, kChunkBytes / std::max<std::size_t>(rowBytes, 1));
+    std::size_t offset = 0;
+    for (std::size_t column = 0; column < components.size(); ++column) {
+        const auto& info = infos_[components[column]];
+        offset           = alignUp(offset, std::max(info.align, kColumnAlign));
+        archetype.offsets.push_back(offset);
+        offset += info.size * archetype.capacity;
+    }
+    archetype.blockBytes = offset;
+
+    archetypes_.push_back(std::move(archetype));
+    lookup_.emplace(components, archetypes_.size() - 1);
+    return archetypes_.size() - 1;
+}
+
+void ArchetypeStorage::migrate(EntityId id, std::size_t target)
+{
+    const Location source = locations_[id];
+    Location destination{};
+    if (target != npos)
+        destination = allocateRow(target, id);
+    if (source.archetype != npos) {
+        const auto& from = archetypes_[source.archetype];
+        for (std::size_t componentIndex : from.components) {
+            void* src = componentAt(source, componentIndex);
+            if (target != npos && archetypes_[target].contains(componentIndex))
+                infos_[componentIndex].moveConstruct(componentAt(destination, componentIndex), src);
+            infos_[componentIndex].destroy(src);
+        }
+        releaseRow(source);
+    }
+    locations_[id] = destination;
+}
+
+ArchetypeStorage::Location ArchetypeStorage::allocateRow(std::size_t archetypeIndex, EntityId id)
+{
+    auto& archetype = archetypes_[archetypeIndex];
+    if (archetype.chunks.empty() || archetype.chunks.back().entities.size() == archetype.capacity) {
+        ArchetypeChunk chunk;
+        chunk.block.reset(allocateBlock(archetype.blockBytes));
+        chunk.entities.reserve(archetype.capacity);
+        archetype.chunks.push_back(std::move(chunk));
+    }
+    auto& chunk = archetype.chunks.back();
+    chunk.entities.push_back(id);
+    return Location{archetypeIndex, archetype.chunks.size() - 1, chunk.entities.size() - 1};
+}
+
+void ArchetypeStorage::releaseRow(const Location& location)
+{
+    auto& archetype           = archetypes_[location.archetype];
+    auto& last                = archetype.chunks.back();
+    const std::size_t lastRow = last.entities.size() - 1;
+    const Location tail{location.archetype, archetype.chunks.size() - 1, lastRow};
+    if (location.chunk != tail.chunk || location.row != tail.row) {
+        const EntityId moved = last.entities[lastRow];
+        for (std::size_t componentIndex : archetype.components) {
+            void* src = componentAt(tail, componentIndex);
+            infos_[componentIndex].moveConstruct(componentAt(location, componentIndex), src);
+            infos_[componentIndex].destroy(src);
+        }
+        archetype.chunks[location.chunk].entities[location.row] = moved;
+        locations_[moved]                                       = location;
+    }
+    last.entities.pop_back();
+    if (last.entities.empty() && archetype.chunks.size() > 1)
+        archetype.chunks.pop_back();
+}
+
+void ArchetypeStorage::destroyRows(Archetype& archetype)
+{
+    for (auto& chunk : archetype.chunks) {
+        for (std::size_t componentIndex : archetype.components) {
+            auto* column           = static_cast<std::byte*>(archetype.column(chunk, componentIndex));
+            const std::size_t size = archetype.sizes[archetype.columns[componentIndex]];
+            for (std::size_t row = 0; row < chunk.entities.size(); ++row) {
+                infos_[componentIndex].destroy(column + row * size);
+            }
+        }
+        chunk.entities.clear();
+    }
+}
@@ -4,6 +4,18 @@
 #include <stdexcept>
 #include <utility>
 
+Registry::Registry(StorageMode mode)
+{
+    if (mode == StorageMode::Archetype) {
+        archetypes_ = std::make_unique<ArchetypeStorage>();
+    }
+}
+
+StorageMode Registry::storageMode() const
+{
+    return archetypes_ ? StorageMode::Archetype : StorageMode::SparseSet;
+}
+
 EntityId Registry::createEntity()
 {
     if (!freeIds_.empty()) {
@@ -15,6 +27,9 @@ EntityId Registry::createEntity()
     }
     const EntityId id = nextId_++;
     alive_.push_back(true);
+    if (id >= generations_.size()) {
+        generations_.push_back(0);
+    }
     appendSignatureForNewEntity();
     return id;
 }
@@ -25,10 +40,17 @@ void Registry::destroyEntity(EntityId id)
         return;
     }
     alive_[id] = false;
+    ++generations_[id];
     resetSignature(id);
     freeIds_.push_back(id);
-    for (auto& [_, storage] : storages_) {
-        storage->reset(id);
+    tags_.erase(id);
+    if (archetypes_) {
+        archetypes_->destroy(id);
+    }
+    for (auto& storage : storages_) {
+        if (storage) {
+            storage->remove(id);
+        }
     }
 }
 
@@ -37,20 +59,75 @@ bool Registry::isAlive(EntityId id) const
     return id < alive_.size() && alive_[id];
 }
 
+bool Registry::isAlive(Entity entity) const
+{
+    return isAlive(entity.index) && generations_[entity.index] == entity.generation;
+}
+
+Entity Registry::handle(EntityId id) const
+{
+    return Entity{id, generation(id)};
+}
+
+std::uint32_t Registry::generation(EntityId id) const
+{
+    if (id >= generations_.size()) {
+        return 0;
+    }
+    return generations_[id];
+}
+
 void Registry::clear()
 {
     storages_.clear();
+    if (archetypes_) {
+        archetypes_->clear();
+    }
     freeIds_.clear();
     alive_.clear();
+    generations_.clear();
     signatures_.clear();
+    tags_.clear();
     nextId_ = 0;
 }
 
+void Registry::compact()
+{
+    EntityId count = nextId_;
+    while (count > 0 && !alive_[count - 1]) {
+        --count;
+    }
+    if (count != nextId_) {
+        freeIds_.erase(std::remove_if(freeIds_.begin(), freeIds_.end(), [count](EntityId id) { return id >= count; }),
+                       freeIds_.end());
+        nextId_ = count;
+        alive_.resize(count);
+        signatures_.resize(static_cast<std::size_t>(count) * signatureWordCount_);
+    }
+    freeIds_.shrink_to_fit();
+    alive_.shrink_to_fit();
+    signatures_.shrink_to_fit();
+    for (auto& storage : storages_) {
+        if (storage) {
+            storage->compact(count);
+        }
+    }
+    if (archetypes_) {
+        archetypes_->compact(count);
+    }
+    tags_.compact(count);
+}
+
 EntityId Registry::entityCount() const
 {
     return nextId_;
 }
 
+std::uint32_t Registry::tagMask(EntityId id) const
+{
+    return isAlive(id) ? tags_.mask(id) : 0;
+}
+
 void Registry::ensureSignatureWordCount(std::size_t componentIndex)
 {
     const std::size_t requiredWords = componentIndex / SIGNATURE_WORD_BITS + 1;
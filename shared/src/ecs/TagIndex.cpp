@@ -0,0 +1,93 @@
+#include "ecs/TagIndex.hpp"
+
+#include "errors/RegistryError.hpp"
+
+#include <bit>
+#include <string>
+
+void TagIndex::assign(EntityId id, std::uint32_t mask)
+{
+    mask &= kAllTags;
+    if (id >= masks_.size()) {
+        masks_.resize(static_cast<std::size_t>(id) + 1, 0);
+        positions_.resize(static_cast<std::size_t>(id) + 1);
+    }
+    const std::uint32_t previous = masks_[id];
+    if (previous == mask)
+        return;
+    for (std::size_t bit = 0; bit < kMaxTags; ++bit) {
+        const std::uint32_t flag = 1U << bit;
+        const bool had           = (previous & flag) != 0;
+        const bool has           = (mask & flag) != 0;
+        if (had && !has)
+            removeFrom(bit, id);
+        else if (!had && has)
+            insert(bit, id);
+    }
+    masks_[id] = mask;
+}
+
+void TagIndex::erase(EntityId id)
+{
+    if (id >= masks_.size() || masks_[id] == 0)
+        return;
+    for (std::size_t bit = 0; bit < kMaxTags; ++bit) {
+        if ((masks_[id] & (1U << bit)) != 0)
+            removeFrom(bit, id);
+    }
+    masks_[id] = 0;
+}
+
+void TagIndex::clear()
+{
+    for (auto& dense : dense_) {
+        dense.clear();
+    }
+    positions_.clear();
+    masks_.clear();
+}
+
+void TagIndex::compact(EntityId entityCount)
+{
+    if (masks_.size() > entityCount) {
+        masks_.resize(entityCount);
+        positions_.resize(entityCount);
+    }
+    masks_.shrink_to_fit();
+    positions_.shrink_to_fit();
+    for (auto& dense : dense_) {
+        dense.shrink_to_fit();
+    }
+}
+
+std::uint32_t TagIndex::mask(EntityId id) const
+{
+    return id < masks_.size() ? masks_[id] : 0;
+}
+
+const std::vector<EntityId>& TagIndex::entities(std::uint32_t tag) const
+{
+    static const std::vector<EntityId> empty;
+    tag &= kAllTags;
+    if (tag == 0)
+        return empty;
+    if (!std::has_single_bit(tag))
+        throw RegistryError("Tag lookup expects a single tag, got mask " + std::to_string(tag));
+    return dense_[static_cast<std::size_t>(std::countr_zero(tag))];
+}
+
+void TagIndex::insert(std::size_t bit, EntityId id)
+{
+    positions_[id][bit] = static_cast<std::uint32_t>(dense_[bit].size());
+    dense_[bit].push_back(id);
+}
+
+void TagIndex::removeFrom(std::size_t bit, EntityId id)
+{
+    auto& dense               = dense_[bit];
+    const std::uint32_t index = positions_[id][bit];
+    const EntityId last       = dense.back();
+    dense[index]              = last;
+    positions_[last][bit]     = index;
+    dense.pop_back();
+}
@@ -0,0 +1,139 @@
+#include "network/BitStream.hpp"
+
+#include <algorithm>
+
+void BitWriter::writeBits(std::uint32_t value, unsigned count)
+{
+    while (count > 0) {
+        std::size_t used = bits_ % 8;
+        if (used == 0)
+            bytes_.push_back(0);
+        unsigned take  = std::min(count, static_cast<unsigned>(8 - used));
+        unsigned shift = count - take;
+        auto chunk     = static_cast<std::uint8_t>((value >> shift) & ((1u << take) - 1u));
+        bytes_.back() |= static_cast<std::uint8_t>(chunk << (8 - used - take));
+        bits_ += take;
+        count -= take;
+    }
+}
+
+void BitWriter::writeBool(bool value)
+{
+    writeBits(value ? 1u : 0u, 1);
+}
+
+void BitWriter::writeVarUInt(std::uint32_t value, unsigned groupBits)
+{
+    const std::uint32_t limit = 1u << groupBits;
+    while (value >= limit) {
+        writeBits((value & (limit - 1u)) | limit, groupBits + 1);
+        value >>= groupBits;
+    }
+    writeBits(value, groupBits + 1);
+}
+
+void BitWriter::writeVarInt(std::int32_t value, unsigned groupBits)
+{
+    writeVarUInt(zigZag(value), groupBits);
+}
+
+std::size_t BitWriter::bitCount() const
+{
+    return bits_;
+}
+
+std::size_t BitWriter::byteCount() const
+{
+    return bytes_.size();
+}
+
+const std::vector<std::uint8_t>& BitWriter::bytes() const
+{
+    return bytes_;
+}
+
+void BitWriter::clear()
+{
+    bytes_.clear();
+    bits_ = 0;
+}
+
+std::size_t BitWriter::varUIntBits(std::uint32_t value, unsigned groupBits)
+{
+    std::size_t groups = 1;
+    while (value >= (1u << groupBits)) {
+        value >>= groupBits;
+        ++groups;
+    }
+    return groups * (groupBits + 1);
+}
+
+std::uint32_t BitWriter::zigZag(std::int32_t value)
+{
+    return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+}
+
+BitReader::BitReader(const std::uint8_t* data, std::size_t size) : data_(data), size_(data == nullptr ? 0 : size) {}
+
+bool BitReader::readBits(unsigned count, std::uint32_t& out)
+{
+    if (count > bitsRemaining())
+        return false;
+    std::uint32_t value = 0;
+    while (count > 0) {
+        std::size_t used = bit_ % 8;
+        unsigned take    = std::min(count, static_cast<unsigned>(8 - used));
+        auto chunk       = static_cast<std::uint32_t>(data_[bit_ / 8] >> (8 - used - take)) & ((1u << take) - 1u);
+        value            = (value << take) | chunk;
+        bit_ += take;
+        count -= take;
+    }
+    out = value;
+    return true;
+}
+
+bool BitReader::readBool(bool& out)
+{
+    std::uint32_t bit = 0;
+    if (!readBits(1, bit))
+        return false;
+    out = bit != 0;
+    return true;
+}
+
+bool BitReader::readVarUInt(std::uint32_t& out, unsigned groupBits)
+{
+    std::uint32_t value = 0;
+    unsigned shift      = 0;
+    while (shift < 32) {
+        std::uint32_t group = 0;
+        if (!readBits(groupBits + 1, group))
+            return false;
+        value |= (group & ((1u << groupBits) - 1u)) << shift;
+        if ((group >> groupBits) == 0) {
+            out = value;
+            return true;
+        }
+        shift += groupBits;
+    }
+    return false;
+}
+
+bool BitReader::readVarInt(std::int32_t& out, unsigned groupBits)
+{
+    std::uint32_t raw = 0;
+    if (!readVarUInt(raw, groupBits))
+        return false;
+    out = unZigZag(raw);
+    return true;
+}
+
+std::size_t BitReader::bitsRemaining() const
+{
+    return size_ * 8 - bit_;
+}
+
+std::int32_t BitReader::unZigZag(std::uint32_t value)
+{
+    return static_cast<std::int32_t>((value >> 1) ^ (~(value & 1u) + 1u));
+}
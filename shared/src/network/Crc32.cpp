@@ -0,0 +1,173 @@
+#include "network/Crc32.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define RTYPE_CRC32_X86 1
+#include <nmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define RTYPE_TARGET_SSE42
+#else
+#define RTYPE_TARGET_SSE42 __attribute__((target("sse4.2")))
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define RTYPE_CRC32_ARM 1
+#include <arm_acle.h>
+#endif
+
+namespace
+{
+    using Kernel = std::uint32_t (*)(const std::uint8_t*, std::size_t) noexcept;
+    using Tables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+    constexpr Tables makeTables(std::uint32_t polynomial)
+    {
+        Tables tables{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t crc = i;
+            for (int b = 0; b < 8; ++b)
+                crc = (crc & 1u) != 0u ? (crc >> 1) ^ polynomial : crc >> 1;
+            tables[0][i] = crc;
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            for (std::size_t t = 1; t < tables.size(); ++t)
+                tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+        return tables;
+    }
+
+    constexpr Tables kIeeeTables       = makeTables(0xEDB88320u);
+    constexpr Tables kCastagnoliTables = makeTables(0x82F63B78u);
+
+    std::uint32_t load32(const std::uint8_t* p)
+    {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+               (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    std::uint32_t slicingBy8(const Tables& t, const std::uint8_t* data, std::size_t len) noexcept
+    {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (; len >= 8; data += 8, len -= 8) {
+            const std::uint32_t lo = load32(data) ^ crc;
+            const std::uint32_t hi = load32(data + 4);
+            crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+                  t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        }
+        for (; len > 0; ++data, --len)
+            crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    std::uint32_t ieeeSoftware(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return slicingBy8(kIeeeTables, data, len);
+    }
+
+    std::uint32_t castagnoliSoftware(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return slicingBy8(kCastagnoliTables, data, len);
+    }
+
+#if defined(RTYPE_CRC32_X86)
+    bool hasSse42() noexcept
+    {
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#else
+        return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+    }
+
+    RTYPE_TARGET_SSE42 std::uint32_t castagnoliSse42(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        std::uint64_t crc = 0xFFFFFFFFu;
+        for (; len >= 8; data += 8, len -= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = _mm_crc32_u64(crc, word);
+        }
+        auto crc32 = static_cast<std::uint32_t>(crc);
+        for (; len > 0; ++data, --len)
+            crc32 = _mm_crc32_u8(crc32, *data);
+        return ~crc32;
+    }
+#endif
+
+#if defined(RTYPE_CRC32_ARM)
+    template <bool Castagnoli> std::uint32_t armv8(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (; len >= 8; data += 8, len -= 8) {
+            std::uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            crc = Castagnoli ? __crc32cd(crc, word) : __crc32d(crc, word);
+        }
+        for (; len > 0; ++data, --len)
+            crc = Castagnoli ? __crc32cb(crc, *data) : __crc32b(crc, *data);
+        return ~crc;
+    }
+#endif
+
+    struct Dispatch
+    {
+        Kernel ieee;
+        Kernel castagnoli;
+        const char* ieeeName;
+        const char* castagnoliName;
+    };
+
+    Dispatch select() noexcept
+    {
+#if defined(RTYPE_CRC32_X86)
+        if (hasSse42())
+            return {ieeeSoftware, castagnoliSse42, "slicing-by-8", "sse4.2"};
+#elif defined(RTYPE_CRC32_ARM)
+        return {armv8<false>, armv8<true>, "armv8", "armv8"};
+#endif
+        return {ieeeSoftware, castagnoliSoftware, "slicing-by-8", "slicing-by-8"};
+    }
+
+    const Dispatch& dispatch() noexcept
+    {
+        static const Dispatch selected = select();
+        return selected;
+    }
+} // namespace
+
+namespace Crc32
+{
+    std::uint32_t ieee(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return dispatch().ieee(data, len);
+    }
+
+    std::uint32_t ieeePortable(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return ieeeSoftware(data, len);
+    }
+
+    std::uint32_t castagnoli(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return dispatch().castagnoli(data, len);
+    }
+
+    std::uint32_t castagnoliPortable(const std::uint8_t* data, std::size_t len) noexcept
+    {
+        return castagnoliSoftware(data, len);
+    }
+
+    const char* ieeeBackend() noexcept
+    {
+        return dispatch().ieeeName;
+    }
+
+    const char* castagnoliBackend() noexcept
+    {
+        return dispatch().castagnoliName;
+    }
+} // namespace Crc32
@@ -11,20 +11,31 @@ namespace Compression
         if (input.empty())
             return {};
 
-        int maxCompressedSize = LZ4_compressBound(static_cast<int>(input.size()));
-        std::vector<std::uint8_t> output(maxCompressedSize);
+        std::vector<std::uint8_t> output(compressBound(input.size()));
+        std::size_t compressedSize = compressInto(input.data(), input.size(), output.data(), output.size());
 
-        int compressedSize =
-            LZ4_compress_default(reinterpret_cast<const char*>(input.data()), reinterpret_cast<char*>(output.data()),
-                                 static_cast<int>(input.size()), maxCompressedSize);
-
-        if (compressedSize <= 0)
+        if (compressedSize == 0)
             throw CompressionError("LZ4 compression failed");
 
         output.resize(compressedSize);
         return output;
     }
 
+    std::size_t compressBound(std::size_t inputSize)
+    {
+        return static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(inputSize)));
+    }
+
+    std::size_t compressInto(const std::uint8_t* data, std::size_t size, std::uint8_t* out, std::size_t capacity)
+    {
+        if (size == 0 || capacity == 0)
+            return 0;
+
+        int compressedSize = LZ4_compress_default(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out),
+                                                  static_cast<int>(size), static_cast<int>(capacity));
+        return compressedSize > 0 ? static_cast<std::size_t>(compressedSize) : 0;
+    }
+
     std::vector<std::uint8_t> decompress(const std::uint8_t* data, std::size_t compressedLen, std::size_t originalSize)
     {
         if (compressedLen == 0 || originalSize == 0)
@@ -0,0 +1,279 @@
+#include "network/SnapshotCodec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace SnapshotCodec
+{
+    namespace
+    {
+        constexpr std::array<std::uint16_t, kMaskBits> kMaskLayout = {
+            kFieldType, kFieldPosX, kFieldPosY, kFieldVelX, kFieldVelY, kFieldHealth, kFieldStatus, kFieldScore};
+
+        std::uint16_t zigZag16(std::int16_t delta)
+        {
+            return static_cast<std::uint16_t>((static_cast<std::uint16_t>(delta) << 1) ^
+                                              static_cast<std::uint16_t>(delta >> 15));
+        }
+
+        std::int16_t unZigZag16(std::uint16_t value)
+        {
+            return static_cast<std::int16_t>((value >> 1) ^ static_cast<std::uint16_t>(~(value & 1u) + 1u));
+        }
+
+        std::int16_t wrappedDelta(std::int16_t current, std::int16_t base)
+        {
+            return static_cast<std::int16_t>(static_cast<std::uint16_t>(current) - static_cast<std::uint16_t>(base));
+        }
+
+        unsigned deltaWidth(std::uint16_t zigzag)
+        {
+            return std::max(1u, static_cast<unsigned>(std::bit_width(zigzag)));
+        }
+
+        std::size_t quantizedBits(std::int16_t value, const std::int16_t* base)
+        {
+            if (base == nullptr)
+                return 16;
+            return kDeltaWidthBits + deltaWidth(zigZag16(wrappedDelta(value, *base)));
+        }
+
+        void writeQuantized(BitWriter& out, std::int16_t value, const std::int16_t* base)
+        {
+            if (base == nullptr) {
+                out.writeBits(static_cast<std::uint16_t>(value), 16);
+                return;
+            }
+            std::uint16_t zigzag = zigZag16(wrappedDelta(value, *base));
+            unsigned width       = deltaWidth(zigzag);
+            out.writeBits(width - 1, kDeltaWidthBits);
+            out.writeBits(zigzag, width);
+        }
+
+        bool readQuantized(BitReader& in, std::int16_t& value, const std::int16_t* base)
+        {
+            std::uint32_t raw = 0;
+            if (base == nullptr) {
+                if (!in.readBits(16, raw))
+                    return false;
+                value = static_cast<std::int16_t>(raw);
+                return true;
+            }
+            std::uint32_t width = 0;
+            if (!in.readBits(kDeltaWidthBits, width) || !in.readBits(width + 1, raw))
+                return false;
+            auto delta = static_cast<std::uint16_t>(unZigZag16(static_cast<std::uint16_t>(raw)));
+            value      = static_cast<std::int16_t>(static_cast<std::uint16_t>(*base) + delta);
+            return true;
+        }
+
+        std::int32_t scoreValue(const EntityFields& fields, const EntityFields* base)
+        {
+            if (base == nullptr)
+                return fields.score;
+            return static_cast<std::int32_t>(static_cast<std::uint32_t>(fields.score) -
+                                             static_cast<std::uint32_t>(base->score));
+        }
+
+        const std::int16_t* baseField(const EntityFields* base, std::int16_t EntityFields::* field)
+        {
+            return base != nullptr ? &(base->*field) : nullptr;
+        }
+    } // namespace
+
+    std::uint8_t compactMask(std::uint16_t mask)
+    {
+        std::uint8_t compact = 0;
+        for (std::size_t i = 0; i < kMaskLayout.size(); ++i) {
+            if (mask & kMaskLayout[i])
+                compact |= static_cast<std::uint8_t>(1u << i);
+        }
+        return compact;
+    }
+
+    std::uint16_t expandMask(std::uint8_t compact)
+    {
+        std::uint16_t mask = 0;
+        for (std::size_t i = 0; i < kMaskLayout.size(); ++i) {
+            if (compact & (1u << i))
+                mask |= kMaskLayout[i];
+        }
+        return mask;
+    }
+
+    std::uint16_t changedFields(const EntityFields& current, const EntityFields& previous)
+    {
+        std::uint16_t mask = 0;
+        if (current.type != previous.type)
+            mask |= kFieldType;
+        if (current.posX != previous.posX)
+            mask |= kFieldPosX;
+        if (current.posY != previous.posY)
+            mask |= kFieldPosY;
+        if (current.velX != previous.velX)
+            mask |= kFieldVelX;
+        if (current.velY != previous.velY)
+            mask |= kFieldVelY;
+        if (current.health != previous.health)
+            mask |= kFieldHealth;
+        if (current.status != previous.status)
+            mask |= kFieldStatus;
+        if (current.score != previous.score)
+            mask |= kFieldScore;
+        return mask;
+    }
+
+    void apply(EntityFields& target, const EntityFields& source, std::uint16_t mask)
+    {
+        if (mask & kFieldType)
+            target.type = source.type;
+        if (mask & kFieldPosX)
+            target.posX = source.posX;
+        if (mask & kFieldPosY)
+            target.posY = source.posY;
+        if (mask & kFieldVelX)
+            target.velX = source.velX;
+        if (mask & kFieldVelY)
+            target.velY = source.velY;
+        if (mask & kFieldHealth)
+            target.health = source.health;
+        if (mask & kFieldStatus)
+            target.status = source.status;
+        if (mask & kFieldScore)
+            target.score = source.score;
+    }
+
+    void writeBaseline(BitWriter& out, std::uint32_t tick, std::optional<std::uint32_t> baselineTick)
+    {
+        out.writeBool(baselineTick.has_value());
+        if (baselineTick.has_value())
+            out.writeVarUInt(tick - *baselineTick);
+    }
+
+    bool readBaseline(BitReader& in, std::uint32_t tick, std::optional<std::uint32_t>& baselineTick)
+    {
+        bool hasBaseline = false;
+        if (!in.readBool(hasBaseline))
+            return false;
+        baselineTick.reset();
+        if (!hasBaseline)
+            return true;
+        std::uint32_t age = 0;
+        if (!in.readVarUInt(age))
+            return false;
+        baselineTick = tick - age;
+        return true;
+    }
+
+    std::size_t entityBits(std::uint32_t idGap, bool hasBaseline, const EntityHeader& header,
+                           const EntityFields& fields, const EntityFields* base)
+    {
+        const EntityFields* from = hasBaseline && header.delta ? base : nullptr;
+        std::size_t bits         = BitWriter::varUIntBits(idGap, kIdGroupBits) + (hasBaseline ? 1 : 0) + kMaskBits;
+        if (header.mask & kFieldType)
+            bits += 8;
+        if (header.mask & kFieldPosX)
+            bits += quantizedBits(fields.posX, baseField(from, &EntityFields::posX));
+        if (header.mask & kFieldPosY)
+            bits += quantizedBits(fields.posY, baseField(from, &EntityFields::posY));
+        if (header.mask & kFieldVelX)
+            bits += quantizedBits(fields.velX, baseField(from, &EntityFields::velX));
+        if (header.mask & kFieldVelY)
+            bits += quantizedBits(fields.velY, baseField(from, &EntityFields::velY));
+        if (header.mask & kFieldHealth)
+            bits += 16;
+        if (header.mask & kFieldStatus)
+            bits += 8;
+        if (header.mask & kFieldScore)
+            bits += BitWriter::varUIntBits(BitWriter::zigZag(scoreValue(fields, from)));
+        return bits;
+    }
+
+    void writeEntity(BitWriter& out, std::uint32_t& nextId, bool hasBaseline, const EntityHeader& header,
+                     const EntityFields& fields, const EntityFields* base)
+    {
+        const EntityFields* from = hasBaseline && header.delta ? base : nullptr;
+        out.writeVarUInt(header.id - nextId, kIdGroupBits);
+        nextId = header.id + 1;
+        if (hasBaseline)
+            out.writeBool(from != nullptr);
+        out.writeBits(compactMask(header.mask), kMaskBits);
+
+        if (header.mask & kFieldType)
+            out.writeBits(fields.type, 8);
+        if (header.mask & kFieldPosX)
+            writeQuantized(out, fields.posX, baseField(from, &EntityFields::posX));
+        if (header.mask & kFieldPosY)
+            writeQuantized(out, fields.posY, baseField(from, &EntityFields::posY));
+        if (header.mask & kFieldVelX)
+            writeQuantized(out, fields.velX, baseField(from, &EntityFields::velX));
+        if (header.mask & kFieldVelY)
+            writeQuantized(out, fields.velY, baseField(from, &EntityFields::velY));
+        if (header.mask & kFieldHealth)
+            out.writeBits(static_cast<std::uint16_t>(fields.health), 16);
+        if (header.mask & kFieldStatus)
+            out.writeBits(fields.status, 8);
+        if (header.mask & kFieldScore)
+            out.writeVarInt(scoreValue(fields, from));
+    }
+
+    bool readEntityHeader(BitReader& in, std::uint32_t& nextId, bool hasBaseline, EntityHeader& header)
+    {
+        std::uint32_t gap     = 0;
+        std::uint32_t compact = 0;
+        if (!in.readVarUInt(gap, kIdGroupBits))
+            return false;
+        header.id    = nextId + gap;
+        nextId       = header.id + 1;
+        header.delta = false;
+        if (hasBaseline && !in.readBool(header.delta))
+            return false;
+        if (!in.readBits(kMaskBits, compact))
+            return false;
+        header.mask = expandMask(static_cast<std::uint8_t>(compact));
+        return true;
+    }
+
+    bool readEntityFields(BitReader& in, const EntityHeader& header, const EntityFields* base, EntityFields& fields)
+    {
+        if (header.delta && base == nullptr)
+            return false;
+        const EntityFields* from = header.delta ? base : nullptr;
+        fields                   = from != nullptr ? *from : EntityFields{};
+        std::uint32_t raw        = 0;
+
+        if (header.mask & kFieldType) {
+            if (!in.readBits(8, raw))
+                return false;
+            fields.type = static_cast<std::uint8_t>(raw);
+        }
+        if ((header.mask & kFieldPosX) && !readQuantized(in, fields.posX, baseField(from, &EntityFields::posX)))
+            return false;
+        if ((header.mask & kFieldPosY) && !readQuantized(in, fields.posY, baseField(from, &EntityFields::posY)))
+            return false;
+        if ((header.mask & kFieldVelX) && !readQuantized(in, fields.velX, baseField(from, &EntityFields::velX)))
+            return false;
+        if ((header.mask & kFieldVelY) && !readQuantized(in, fields.velY, baseField(from, &EntityFields::velY)))
+            return false;
+        if (header.mask & kFieldHealth) {
+            if (!in.readBits(16, raw))
+                return false;
+            fields.health = static_cast<std::int16_t>(raw);
+        }
+        if (header.mask & kFieldStatus) {
+            if (!in.readBits(8, raw))
+                return false;
+            fields.status = static_cast<std::uint8_t>(raw);
+        }
+        if (header.mask & kFieldScore) {
+            std::int32_t score = 0;
+            if (!in.readVarInt(score))
+                return false;
+            fields.score = from != nullptr ? static_cast<std::int32_t>(static_cast<std::uint32_t>(from->score) +
+                                                                       static_cast<std::uint32_t>(score))
+                                           : score;
+        }
+        return true;
+    }
+} // namespace SnapshotCodec
@@ -0,0 +1,180 @@
+#include "network/UdpReactor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#elif defined(__linux__)
+#include <sys/epoll.h>
+#include <unistd.h>
+#else
+#include <poll.h>
+#endif
+
+namespace
+{
+    constexpr std::size_t kWakerIndex = static_cast<std::size_t>(-1);
+    constexpr int kMaxEvents          = 16;
+
+    int toMillis(std::chrono::milliseconds timeout)
+    {
+        if (timeout.count() < 0)
+            return -1;
+        return static_cast<int>(std::min<std::chrono::milliseconds::rep>(timeout.count(), INT_MAX));
+    }
+} // namespace
+
+UdpReactor::UdpReactor(std::size_t datagramSize) : datagramSize_(datagramSize) {}
+
+UdpReactor::~UdpReactor()
+{
+    close();
+}
+
+bool UdpReactor::open()
+{
+    close();
+    if (!waker_.open(IpEndpoint::v4(127, 0, 0, 1, 0)))
+        return false;
+    wakeEndpoint_ = waker_.localEndpoint();
+#if defined(__linux__)
+    int fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (fd < 0) {
+        waker_.close();
+        return false;
+    }
+    poller_ = fd;
+#else
+    poller_ = 0;
+#endif
+    if (!registerHandle(waker_.nativeHandle(), kWakerIndex)) {
+        close();
+        return false;
+    }
+    storage_.assign(UdpSocket::kMaxBatch * datagramSize_, 0);
+    buffers_.clear();
+    for (std::size_t i = 0; i < UdpSocket::kMaxBatch; ++i)
+        buffers_.push_back(UdpRecvBuffer{storage_.data() + i * datagramSize_, datagramSize_, 0, IpEndpoint{}});
+    return true;
+}
+
+void UdpReactor::close()
+{
+#if defined(__linux__)
+    if (poller_ != -1)
+        ::close(static_cast<int>(poller_));
+#endif
+    poller_ = -1;
+    waker_.close();
+    watches_.clear();
+}
+
+bool UdpReactor::isOpen() const
+{
+    return poller_ != -1;
+}
+
+bool UdpReactor::watch(UdpSocket& socket, Handler handler)
+{
+    if (!isOpen() || !socket.isOpen())
+        return false;
+    watches_.push_back(Watch{&socket, std::move(handler)});
+    if (!registerHandle(socket.nativeHandle(), watches_.size() - 1)) {
+        watches_.pop_back();
+        return false;
+    }
+    return true;
+}
+
+bool UdpReactor::registerHandle(std::intptr_t handle, std::size_t index)
+{
+#if defined(__linux__)
+    epoll_event ev{};
+    ev.events   = EPOLLIN;
+    ev.data.u64 = index;
+    return ::epoll_ctl(static_cast<int>(poller_), EPOLL_CTL_ADD, static_cast<int>(handle), &ev) == 0;
+#else
+    (void) handle;
+    (void) index;
+    return true;
+#endif
+}
+
+std::size_t UdpReactor::poll(std::chrono::milliseconds timeout)
+{
+    if (!isOpen())
+        return 0;
+    std::size_t received = 0;
+#if defined(__linux__)
+    std::array<epoll_event, kMaxEvents> events{};
+    int ready = ::epoll_wait(static_cast<int>(poller_), events.data(), kMaxEvents, toMillis(timeout));
+    for (int i = 0; i < ready; ++i) {
+        const auto index = static_cast<std::size_t>(events[static_cast<std::size_t>(i)].data.u64);
+        if (index == kWakerIndex)
+            drainWaker();
+        else
+            received += drain(watches_[index]);
+    }
+#else
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> fds(watches_.size() + 1);
+    for (std::size_t i = 0; i < watches_.size(); ++i)
+        fds[i] = WSAPOLLFD{static_cast<SOCKET>(watches_[i].socket->nativeHandle()), POLLRDNORM, 0};
+    fds.back() = WSAPOLLFD{static_cast<SOCKET>(waker_.nativeHandle()), POLLRDNORM, 0};
+    int ready  = ::WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), toMillis(timeout));
+#else
+    std::vector<pollfd> fds(watches_.size() + 1);
+    for (std::size_t i = 0; i < watches_.size(); ++i)
+        fds[i] = pollfd{static_cast<int>(watches_[i].socket->nativeHandle()), POLLIN, 0};
+    fds.back() = pollfd{static_cast<int>(waker_.nativeHandle()), POLLIN, 0};
+    int ready  = ::poll(fds.data(), static_cast<nfds_t>(fds.size()), toMillis(timeout));
+#endif
+    if (ready <= 0)
+        return 0;
+    for (std::size_t i = 0; i < watches_.size(); ++i) {
+        if (fds[i].revents != 0)
+            received += drain(watches_[i]);
+    }
+    if (fds.back().revents != 0)
+        drainWaker();
+#endif
+    return received;
+}
+
+void UdpReactor::wake()
+{
+    const std::uint8_t signal = 1;
+    waker_.sendTo(&signal, 1, wakeEndpoint_);
+}
+
+std::size_t UdpReactor::drain(Watch& watch)
+{
+    std::size_t total = 0;
+    while (true) {
+        auto res = watch.socket->recvBatch(buffers_);
+        if (!res.ok()) {
+            if (res.error == UdpError::Interrupted)
+                continue;
+            break;
+        }
+        for (std::size_t i = 0; i < res.size; ++i)
+            watch.handler(buffers_[i].data, buffers_[i].size, buffers_[i].src);
+        total += res.size;
+        if (res.size < buffers_.size())
+            break;
+    }
+    return total;
+}
+
+void UdpReactor::drainWaker()
+{
+    std::array<std::uint8_t, 16> scratch{};
+    IpEndpoint src{};
+    while (waker_.recvFrom(scratch.data(), scratch.size(), src).ok())
+        continue;
+}
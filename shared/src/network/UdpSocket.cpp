@@ -1,5 +1,6 @@
 #include "network/UdpSocket.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -17,6 +18,7 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -254,6 +256,49 @@ UdpResult UdpSocket::sendTo(const std::uint8_t* data, std::size_t len, const IpE
 #endif
 }
 
+UdpResult UdpSocket::sendBatch(std::span<const UdpDatagram> datagrams)
+{
+    if (fd_ == -1)
+        return {0, UdpError::NotOpen};
+#if defined(__linux__)
+    std::array<mmsghdr, kMaxBatch> msgs{};
+    std::array<iovec, kMaxBatch> iovs{};
+    std::array<sockaddr_in, kMaxBatch> addrs{};
+    std::size_t sent = 0;
+    while (sent < datagrams.size()) {
+        const std::size_t count = std::min(kMaxBatch, datagrams.size() - sent);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& d               = datagrams[sent + i];
+            addrs[i]                    = toSockaddr(d.dst);
+            iovs[i].iov_base            = const_cast<std::uint8_t*>(d.data);
+            iovs[i].iov_len             = d.size;
+            msgs[i].msg_hdr             = msghdr{};
+            msgs[i].msg_hdr.msg_name    = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            msgs[i].msg_hdr.msg_iov     = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen  = 1;
+        }
+        int done = ::sendmmsg(static_cast<int>(fd_), msgs.data(), static_cast<unsigned int>(count), 0);
+        if (done < 0) {
+            if (errno == EINTR)
+                continue;
+            return {sent, mapErr(errno)};
+        }
+        sent += static_cast<std::size_t>(done);
+    }
+    return {sent, UdpError::None};
+#else
+    std::size_t sent = 0;
+    for (const auto& d : datagrams) {
+        auto res = sendTo(d.data, d.size, d.dst);
+        if (!res.ok())
+            return {sent, res.error};
+        ++sent;
+    }
+    return {sent, UdpError::None};
+#endif
+}
+
 UdpResult UdpSocket::recvFrom(std::uint8_t* buf, std::size_t len, IpEndpoint& src)
 {
     if (fd_ == -1)
@@ -280,6 +325,47 @@ UdpResult UdpSocket::recvFrom(std::uint8_t* buf, std::size_t len, IpEndpoint& sr
 #endif
 }
 
+UdpResult UdpSocket::recvBatch(std::span<UdpRecvBuffer> buffers)
+{
+    if (fd_ == -1)
+        return {0, UdpError::NotOpen};
+#if defined(__linux__)
+    std::array<mmsghdr, kMaxBatch> msgs{};
+    std::array<iovec, kMaxBatch> iovs{};
+    std::array<sockaddr_in, kMaxBatch> addrs{};
+    const std::size_t count = std::min(kMaxBatch, buffers.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        iovs[i].iov_base            = buffers[i].data;
+        iovs[i].iov_len             = buffers[i].capacity;
+        msgs[i].msg_hdr.msg_name    = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        msgs[i].msg_hdr.msg_iov     = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen  = 1;
+    }
+    int got = ::recvmmsg(static_cast<int>(fd_), msgs.data(), static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+    if (got < 0)
+        return {0, mapErr(errno)};
+    for (std::size_t i = 0; i < static_cast<std::size_t>(got); ++i) {
+        buffers[i].size = msgs[i].msg_len;
+        buffers[i].src  = fromSockaddr(addrs[i]);
+    }
+    return {static_cast<std::size_t>(got), UdpError::None};
+#else
+    std::size_t got = 0;
+    for (auto& buffer : buffers) {
+        auto res = recvFrom(buffer.data, buffer.capacity, buffer.src);
+        if (!res.ok()) {
+            if (got == 0)
+                return {0, res.error};
+            break;
+        }
+        buffer.size = res.size;
+        ++got;
+    }
+    return {got, UdpError::None};
+#endif
+}
+
 IpEndpoint UdpSocket::localEndpoint() const
 {
     if (fd_ == -1)
@@ -298,3 +384,8 @@ IpEndpoint UdpSocket::localEndpoint() const
     return fromSockaddr(sa);
 #endif
 }
+
+std::intptr_t UdpSocket::nativeHandle() const
+{
+    return fd_;
+}
@@ -0,0 +1,75 @@
+#include "profiling/HdrHistogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+std::size_t HdrHistogram::bucketIndex(std::uint64_t value)
+{
+    value = std::min(value, kMaxValue);
+    if (value < kSubBuckets)
+        return static_cast<std::size_t>(value);
+    const auto exponent     = static_cast<unsigned>(std::bit_width(value)) - kSubBucketBits;
+    const std::uint64_t sub = value >> exponent;
+    return static_cast<std::size_t>(kSubBuckets + (exponent - 1) * kHalfBuckets + (sub - kHalfBuckets));
+}
+
+std::uint64_t HdrHistogram::bucketUpperBound(std::size_t index)
+{
+    if (index < kSubBuckets)
+        return index;
+    const std::size_t offset = index - kSubBuckets;
+    const auto exponent      = static_cast<unsigned>(offset / kHalfBuckets) + 1;
+    const std::uint64_t sub  = offset % kHalfBuckets + kHalfBuckets;
+    return ((sub + 1) << exponent) - 1;
+}
+
+void HdrHistogram::record(std::uint64_t value)
+{
+    value = std::min(value, kMaxValue);
+    ++counts_[bucketIndex(value)];
+    ++count_;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+    sum_ += static_cast<double>(value);
+}
+
+void HdrHistogram::merge(const HdrHistogram& other)
+{
+    for (std::size_t i = 0; i < kBucketCount; ++i)
+        counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+}
+
+void HdrHistogram::reset()
+{
+    counts_.fill(0);
+    count_ = 0;
+    min_   = kMaxValue;
+    max_   = 0;
+    sum_   = 0.0;
+}
+
+double HdrHistogram::mean() const
+{
+    return count_ == 0 ? 0.0 : sum_ / static_cast<double>(count_);
+}
+
+std::uint64_t HdrHistogram::valueAtPercentile(double percentile) const
+{
+    if (count_ == 0)
+        return 0;
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const auto target    = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count_))));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        seen += counts_[i];
+        if (seen >= target)
+            return std::clamp(bucketUpperBound(i), min_, max_);
+    }
+    return max_;
+}
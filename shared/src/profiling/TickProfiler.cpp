@@ -0,0 +1,198 @@
+#include "profiling/TickProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+    struct ZoneRegistry
+    {
+        std::mutex mutex;
+        std::vector<const char*> names;
+    };
+
+    ZoneRegistry& zoneRegistry()
+    {
+        static ZoneRegistry registry;
+        return registry;
+    }
+
+    void writeEscaped(std::ostream& out, const char* text)
+    {
+        for (const char* c = text; *c != '\0'; ++c) {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            out << *c;
+        }
+    }
+
+    void writeEscaped(std::ostream& out, const std::string& text)
+    {
+        writeEscaped(out, text.c_str());
+    }
+} // namespace
+
+thread_local TickProfiler* TickProfiler::current_ = nullptr;
+
+TickProfiler::TickProfiler(std::size_t traceTicks) : trace_(traceTicks)
+{
+    events_.reserve(64);
+}
+
+std::uint16_t TickProfiler::registerZone(const char* name)
+{
+    auto& registry = zoneRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (std::size_t i = 0; i < registry.names.size(); ++i) {
+        if (std::strcmp(registry.names[i], name) == 0)
+            return static_cast<std::uint16_t>(i);
+    }
+    registry.names.push_back(name);
+    return static_cast<std::uint16_t>(registry.names.size() - 1);
+}
+
+const char* TickProfiler::zoneName(std::uint16_t zone)
+{
+    auto& registry = zoneRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return zone < registry.names.size() ? registry.names[zone] : "?";
+}
+
+std::int64_t TickProfiler::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+void TickProfiler::beginTick(std::uint32_t tick)
+{
+    previous_ = current_;
+    current_  = this;
+    tick_     = tick;
+    depth_    = 0;
+    events_.clear();
+}
+
+void TickProfiler::endTick()
+{
+    current_ = previous_;
+
+    for (const auto& event : events_) {
+        if (event.zone >= tickTotals_.size())
+            tickTotals_.resize(event.zone + 1U, -1);
+        if (tickTotals_[event.zone] < 0) {
+            tickTotals_[event.zone] = 0;
+            touched_.push_back(event.zone);
+        }
+        tickTotals_[event.zone] += event.end - event.start;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::uint16_t zone : touched_) {
+        if (zone >= histograms_.size())
+            histograms_.resize(zone + 1U);
+        if (!histograms_[zone])
+            histograms_[zone] = std::make_unique<HdrHistogram>();
+        histograms_[zone]->record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, tickTotals_[zone])));
+        tickTotals_[zone] = -1;
+    }
+    touched_.clear();
+    ++ticks_;
+
+    if (!trace_.empty()) {
+        auto& slot = trace_[traceNext_];
+        slot.tick  = tick_;
+        slot.events.assign(events_.begin(), events_.end());
+        traceNext_  = (traceNext_ + 1) % trace_.size();
+        traceCount_ = std::min(traceCount_ + 1, trace_.size());
+    }
+}
+
+std::vector<ZoneStats> TickProfiler::stats() const
+{
+    std::vector<ZoneStats> result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t zone = 0; zone < histograms_.size(); ++zone) {
+        const auto& histogram = histograms_[zone];
+        if (!histogram || histogram->count() == 0)
+            continue;
+        ZoneStats stats;
+        stats.name  = zoneName(static_cast<std::uint16_t>(zone));
+        stats.count = histogram->count();
+        stats.mean  = std::chrono::nanoseconds(static_cast<std::int64_t>(histogram->mean()));
+        stats.p50   = std::chrono::nanoseconds(histogram->valueAtPercentile(50.0));
+        stats.p99   = std::chrono::nanoseconds(histogram->valueAtPercentile(99.0));
+        stats.max   = std::chrono::nanoseconds(histogram->max());
+        result.push_back(stats);
+    }
+    return result;
+}
+
+std::uint64_t TickProfiler::ticks() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ticks_;
+}
+
+void TickProfiler::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& histogram : histograms_) {
+        if (histogram)
+            histogram->reset();
+    }
+    for (auto& slot : trace_)
+        slot.events.clear();
+    traceNext_  = 0;
+    traceCount_ = 0;
+    ticks_      = 0;
+}
+
+bool TickProfiler::writeChromeTrace(const std::string& path, int threadId, const std::string& threadName) const
+{
+    std::vector<TickTrace> ticks;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ticks.reserve(traceCount_);
+        const std::size_t first = (traceNext_ + trace_.size() - traceCount_) % std::max<std::size_t>(1, trace_.size());
+        for (std::size_t i = 0; i < traceCount_; ++i)
+            ticks.push_back(trace_[(first + i) % trace_.size()]);
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open())
+        return false;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId << ",\"args\":{\"name\":\"";
+    writeEscaped(out, threadName);
+    out << "\"}}";
+    for (const auto& tick : ticks) {
+        for (const auto& event : tick.events) {
+            out << ",\n{\"name\":\"";
+            writeEscaped(out, zoneName(event.zone));
+            out << "\",\"cat\":\"tick\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+                << ",\"ts\":" << static_cast<double>(event.start) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.end - event.start) / 1000.0 << ",\"args\":{\"tick\":"
+                << tick.tick << ",\"depth\":" << event.depth << "}}";
+        }
+    }
+    out << "\n]}\n";
+    return out.good();
+}
+
+ProfileTick::ProfileTick(TickProfiler& profiler, std::uint32_t tick) : profiler_(profiler)
+{
+    profiler_.beginTick(tick);
+    depth_ = profiler_.enter();
+    start_ = TickProfiler::now();
+}
+
+ProfileTick::~ProfileTick()
+{
+    static const std::uint16_t tickZone = TickProfiler::registerZone("tick");
+    profiler_.leave(tickZone, depth_, start_, TickProfiler::now());
+    profiler_.endTick();
+}
@@ -0,0 +1,265 @@
+#include "rollback/FrameHistoryStorage.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    constexpr std::array<std::uint8_t, FrameHistoryStorage::kMaxStateSize> kZeroState{};
+
+    void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+    {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    std::uint64_t getVarint(const std::uint8_t*& in)
+    {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0;; shift += 7) {
+            std::uint8_t byte = *in++;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return value;
+        }
+    }
+
+    const std::uint8_t* findBase(const std::vector<std::uint32_t>& ids, const std::uint8_t* states,
+                                 std::size_t stateSize, std::uint32_t id, std::size_t& cursor)
+    {
+        while (cursor < ids.size() && ids[cursor] < id)
+            ++cursor;
+        if (cursor < ids.size() && ids[cursor] == id)
+            return states + cursor * stateSize;
+        return kZeroState.data();
+    }
+} // namespace
+
+FrameHistoryStorage::FrameHistoryStorage(std::size_t stateSize, std::size_t window, std::size_t keyframeInterval)
+    : stateSize_(std::min(stateSize, kMaxStateSize)), window_(std::max<std::size_t>(window, 1)),
+      keyframeInterval_(std::max<std::size_t>(keyframeInterval, 1))
+{
+    slots_.resize(window_ + keyframeInterval_);
+    arena_.resize(slots_.size() * kInitialFrameBytes);
+}
+
+void FrameHistoryStorage::push(std::uint64_t tick, std::span<const std::uint32_t> ids, const std::uint8_t* states,
+                               std::uint32_t checksum)
+{
+    if (latest_ && tick <= *latest_) {
+        for (auto& slot : slots_) {
+            if (slot.valid && slot.tick >= tick)
+                slot.valid = false;
+        }
+    }
+    const bool keyframe = !latest_ || tick != *latest_ + 1 || sinceKeyframe_ + 1 >= keyframeInterval_;
+    sinceKeyframe_      = keyframe ? 0 : sinceKeyframe_ + 1;
+
+    Slot& slot = slots_[slotIndex(tick)];
+    slot.valid = false;
+    encode(ids, states, keyframe);
+
+    slot.offset = reserve(encoded_.size(), tick);
+    std::memcpy(arena_.data() + slot.offset, encoded_.data(), encoded_.size());
+    slot.tick     = tick;
+    slot.keyTick  = keyframe ? tick : slots_[slotIndex(tick - 1)].keyTick;
+    slot.bytes    = encoded_.size();
+    slot.checksum = checksum;
+    slot.valid    = true;
+
+    latest_ = tick;
+    lastIds_.assign(ids.begin(), ids.end());
+    lastStates_.assign(states, states + ids.size() * stateSize_);
+}
+
+std::optional<std::span<const std::uint8_t>> FrameHistoryStorage::decode(std::uint64_t tick,
+                                                                        std::vector<std::uint32_t>& ids) const
+{
+    const Slot* target = find(tick);
+    if (target == nullptr)
+        return std::nullopt;
+
+    std::size_t current = 0;
+    for (std::uint64_t t = target->keyTick; t <= tick; ++t) {
+        const Slot& slot = slots_[slotIndex(t)];
+        if (!slot.valid || slot.tick != t)
+            return std::nullopt;
+        decodeFrame(slot, current, current ^ 1);
+        current ^= 1;
+    }
+    ids.assign(decodedIds_[current].begin(), decodedIds_[current].end());
+    return std::span<const std::uint8_t>(decodedStates_[current]);
+}
+
+bool FrameHistoryStorage::contains(std::uint64_t tick) const
+{
+    return find(tick) != nullptr;
+}
+
+std::optional<std::uint32_t> FrameHistoryStorage::checksum(std::uint64_t tick) const
+{
+    const Slot* slot = find(tick);
+    if (slot == nullptr)
+        return std::nullopt;
+    return slot->checksum;
+}
+
+std::optional<std::pair<std::uint64_t, std::uint64_t>> FrameHistoryStorage::tickRange() const
+{
+    if (!latest_)
+        return std::nullopt;
+    std::optional<std::uint64_t> oldest;
+    for (const auto& slot : slots_) {
+        if (find(slot.tick) == &slot && (!oldest || slot.tick < *oldest))
+            oldest = slot.tick;
+    }
+    if (!oldest)
+        return std::nullopt;
+    return std::make_pair(*oldest, *latest_);
+}
+
+std::size_t FrameHistoryStorage::size() const
+{
+    return static_cast<std::size_t>(
+        std::count_if(slots_.begin(), slots_.end(), [this](const Slot& slot) { return find(slot.tick) == &slot; }));
+}
+
+std::size_t FrameHistoryStorage::window() const
+{
+    return window_;
+}
+
+std::size_t FrameHistoryStorage::arenaBytes() const
+{
+    return arena_.size();
+}
+
+void FrameHistoryStorage::clear()
+{
+    for (auto& slot : slots_)
+        slot.valid = false;
+    head_ = 0;
+    latest_.reset();
+    sinceKeyframe_ = 0;
+    lastIds_.clear();
+    lastStates_.clear();
+}
+
+std::size_t FrameHistoryStorage::slotIndex(std::uint64_t tick) const
+{
+    return static_cast<std::size_t>(tick % slots_.size());
+}
+
+const FrameHistoryStorage::Slot* FrameHistoryStorage::find(std::uint64_t tick) const
+{
+    if (!latest_ || tick > *latest_ || *latest_ - tick >= window_)
+        return nullptr;
+    const Slot& slot = slots_[slotIndex(tick)];
+    return slot.valid && slot.tick == tick ? &slot : nullptr;
+}
+
+bool FrameHistoryStorage::live(const Slot& slot, std::uint64_t tick) const
+{
+    return slot.valid && slot.tick + slots_.size() > tick;
+}
+
+void FrameHistoryStorage::encode(std::span<const std::uint32_t> ids, const std::uint8_t* states, bool keyframe)
+{
+    encoded_.clear();
+    putVarint(encoded_, ids.size());
+    std::uint32_t previousId = 0;
+    std::size_t cursor       = 0;
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        const std::uint8_t* state = states + i * stateSize_;
+        const std::uint8_t* base  = kZeroState.data();
+        if (!keyframe)
+            base = findBase(lastIds_, lastStates_.data(), stateSize_, ids[i], cursor);
+
+        std::uint64_t mask = 0;
+        for (std::size_t b = 0; b < stateSize_; ++b) {
+            if (state[b] != base[b])
+                mask |= std::uint64_t{1} << b;
+        }
+        putVarint(encoded_, ids[i] - previousId);
+        putVarint(encoded_, mask);
+        for (std::size_t b = 0; b < stateSize_; ++b) {
+            if (mask & (std::uint64_t{1} << b))
+                encoded_.push_back(static_cast<std::uint8_t>(state[b] ^ base[b]));
+        }
+        previousId = ids[i];
+    }
+}
+
+void FrameHistoryStorage::decodeFrame(const Slot& slot, std::size_t from, std::size_t to) const
+{
+    const bool keyframe       = slot.keyTick == slot.tick;
+    const auto& baseIds       = decodedIds_[from];
+    const std::uint8_t* bases = decodedStates_[from].data();
+    auto& ids                 = decodedIds_[to];
+    auto& states              = decodedStates_[to];
+
+    const std::uint8_t* in = arena_.data() + slot.offset;
+    const auto count       = static_cast<std::size_t>(getVarint(in));
+    ids.resize(count);
+    states.resize(count * stateSize_);
+
+    std::uint32_t id   = 0;
+    std::size_t cursor = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        id += static_cast<std::uint32_t>(getVarint(in));
+        ids[i]                   = id;
+        std::uint64_t mask       = getVarint(in);
+        const std::uint8_t* base = keyframe ? kZeroState.data() : findBase(baseIds, bases, stateSize_, id, cursor);
+        std::uint8_t* state      = states.data() + i * stateSize_;
+        for (std::size_t b = 0; b < stateSize_; ++b)
+            state[b] = (mask & (std::uint64_t{1} << b)) ? static_cast<std::uint8_t>(base[b] ^ *in++) : base[b];
+    }
+}
+
+std::size_t FrameHistoryStorage::reserve(std::size_t bytes, std::uint64_t tick)
+{
+    std::size_t offset = head_;
+    if (offset + bytes > arena_.size())
+        offset = 0;
+    if (offset + bytes > arena_.size() || overlaps(offset, bytes, tick)) {
+        grow(bytes, tick);
+        offset = head_;
+    }
+    head_ = offset + bytes;
+    return offset;
+}
+
+bool FrameHistoryStorage::overlaps(std::size_t offset, std::size_t bytes, std::uint64_t tick) const
+{
+    return std::any_of(slots_.begin(), slots_.end(), [&](const Slot& slot) {
+        return live(slot, tick) && slot.offset < offset + bytes && offset < slot.offset + slot.bytes;
+    });
+}
+
+void FrameHistoryStorage::grow(std::size_t bytes, std::uint64_t tick)
+{
+    std::vector<Slot*> kept;
+    std::size_t used = 0;
+    for (auto& slot : slots_) {
+        if (!live(slot, tick)) {
+            slot.valid = false;
+            continue;
+        }
+        kept.push_back(&slot);
+        used += slot.bytes;
+    }
+    std::sort(kept.begin(), kept.end(), [](const Slot* a, const Slot* b) { return a->tick < b->tick; });
+
+    std::vector<std::uint8_t> arena(std::max(arena_.size(), (used + bytes) * 2));
+    std::size_t offset = 0;
+    for (Slot* slot : kept) {
+        std::memcpy(arena.data() + offset, arena_.data() + slot->offset, slot->bytes);
+        slot->offset = offset;
+        offset += slot->bytes;
+    }
+    arena_.swap(arena);
+    head_ = offset;
+}
@@ -0,0 +1,99 @@
+#include "rollback/StateHash.hpp"
+
+#include "network/Crc32.hpp"
+
+#include <array>
+#include <bit>
+
+namespace
+{
+    void put32(std::uint8_t* out, std::uint32_t v)
+    {
+        out[0] = static_cast<std::uint8_t>(v & 0xFF);
+        out[1] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
+        out[2] = static_cast<std::uint8_t>((v >> 16) & 0xFF);
+        out[3] = static_cast<std::uint8_t>((v >> 24) & 0xFF);
+    }
+
+    bool sameFields(const StateHashFields& a, const StateHashFields& b)
+    {
+        return std::bit_cast<std::uint32_t>(a.posX) == std::bit_cast<std::uint32_t>(b.posX) &&
+               std::bit_cast<std::uint32_t>(a.posY) == std::bit_cast<std::uint32_t>(b.posY) && a.health == b.health;
+    }
+} // namespace
+
+std::uint32_t StateHash::entityHash(EntityId id, const StateHashFields& fields)
+{
+    std::array<std::uint8_t, 16> bytes{};
+    put32(bytes.data(), id);
+    put32(bytes.data() + 4, std::bit_cast<std::uint32_t>(fields.posX));
+    put32(bytes.data() + 8, std::bit_cast<std::uint32_t>(fields.posY));
+    bytes[12] = static_cast<std::uint8_t>(static_cast<std::uint16_t>(fields.health) & 0xFF);
+    bytes[13] = static_cast<std::uint8_t>(static_cast<std::uint16_t>(fields.health) >> 8);
+    return Crc32::castagnoli(bytes.data(), bytes.size());
+}
+
+std::uint32_t StateHash::combine(std::uint32_t sum, std::uint32_t count)
+{
+    std::array<std::uint8_t, 8> bytes{};
+    put32(bytes.data(), sum);
+    put32(bytes.data() + 4, count);
+    return Crc32::castagnoli(bytes.data(), bytes.size());
+}
+
+bool StateHash::update(EntityId id, const StateHashFields& fields)
+{
+    if (id >= entries_.size())
+        entries_.resize(static_cast<std::size_t>(id) + 1);
+    Entry& entry = entries_[id];
+    if (entry.present && sameFields(entry.fields, fields))
+        return false;
+
+    const std::uint32_t hash = entityHash(id, fields);
+    if (entry.present)
+        sum_ -= entry.hash;
+    else
+        ++count_;
+    sum_ += hash;
+    entry = Entry{true, fields, hash};
+    return true;
+}
+
+void StateHash::erase(EntityId id)
+{
+    if (id >= entries_.size() || !entries_[id].present)
+        return;
+    sum_ -= entries_[id].hash;
+    --count_;
+    entries_[id].present = false;
+}
+
+void StateHash::retain(std::span<const EntityId> sortedIds)
+{
+    std::size_t cursor = 0;
+    for (EntityId id = 0; id < entries_.size(); ++id) {
+        if (!entries_[id].present)
+            continue;
+        while (cursor < sortedIds.size() && sortedIds[cursor] < id)
+            ++cursor;
+        if (cursor == sortedIds.size() || sortedIds[cursor] != id)
+            erase(id);
+    }
+}
+
+std::uint32_t StateHash::value() const
+{
+    return combine(sum_, count_);
+}
+
+std::size_t StateHash::size() const
+{
+    return count_;
+}
+
+void StateHash::clear()
+{
+    entries_.clear();
+    sum_   = 0;
+    count_ = 0;
+}
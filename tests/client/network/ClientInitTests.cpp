@@ -19,3 +19,65 @@ TEST(ClientInitTest, BuildClientHello)
     EXPECT_EQ(hdr.sequenceId, sequence);
     EXPECT_EQ(hdr.payloadSize, 0);
 }
+
+TEST(ClientInitTest, BuildClientHelloCarriesRoomToken)
+{
+    auto pkt    = buildClientHello(1, 7);
+    auto hdrOpt = PacketHeader::decode(pkt.data(), pkt.size());
+    ASSERT_TRUE(hdrOpt.has_value());
+    EXPECT_EQ(hdrOpt->tickId, 7U);
+    EXPECT_EQ(PacketHeader::crc32(pkt.data(), pkt.size() - PacketHeader::kCrcSize),
+              (static_cast<std::uint32_t>(pkt[pkt.size() - 4]) << 24) |
+                  (static_cast<std::uint32_t>(pkt[pkt.size() - 3]) << 16) |
+                  (static_cast<std::uint32_t>(pkt[pkt.size() - 2]) << 8) | pkt[pkt.size() - 1]);
+}
+
+namespace
+{
+    std::vector<std::uint8_t> serverPacket(MessageType type, std::uint16_t sequence)
+    {
+        PacketHeader hdr{};
+        hdr.packetType  = static_cast<std::uint8_t>(PacketType::ServerToClient);
+        hdr.messageType = static_cast<std::uint8_t>(type);
+        hdr.sequenceId  = sequence;
+        auto encoded    = hdr.encode();
+        return std::vector<std::uint8_t>(encoded.begin(), encoded.end());
+    }
+
+    std::vector<PacketHeader> drainRaw(NetPipelines& net)
+    {
+        std::vector<PacketHeader> out;
+        std::vector<std::uint8_t> packet;
+        while (net.raw.tryPop(packet)) {
+            auto hdr = PacketHeader::decode(packet.data(), packet.size());
+            if (hdr.has_value())
+                out.push_back(*hdr);
+        }
+        return out;
+    }
+} // namespace
+
+TEST(ClientInitTest, ForwardRawPacketHoldsReliableMessagesWhileQueueIsFull)
+{
+    NetPipelines net;
+    for (std::size_t i = 0; i < net.raw.capacity(); ++i)
+        forwardRawPacket(net, serverPacket(MessageType::Snapshot, 0));
+
+    forwardRawPacket(net, serverPacket(MessageType::Snapshot, 1));
+    forwardRawPacket(net, serverPacket(MessageType::EntitySpawn, 2));
+    forwardRawPacket(net, serverPacket(MessageType::GameEnd, 3));
+    forwardRawPacket(net, serverPacket(MessageType::ServerPong, 4));
+    EXPECT_EQ(net.rawDropped.load(), 2u);
+    EXPECT_EQ(net.rawPending.size(), 2u);
+    EXPECT_EQ(drainRaw(net).size(), net.raw.capacity());
+
+    forwardRawPacket(net, serverPacket(MessageType::Snapshot, 5));
+    EXPECT_TRUE(net.rawPending.empty());
+    auto forwarded = drainRaw(net);
+    ASSERT_EQ(forwarded.size(), 3u);
+    EXPECT_EQ(forwarded[0].messageType, static_cast<std::uint8_t>(MessageType::EntitySpawn));
+    EXPECT_EQ(forwarded[1].messageType, static_cast<std::uint8_t>(MessageType::GameEnd));
+    EXPECT_EQ(forwarded[2].messageType, static_cast<std::uint8_t>(MessageType::Snapshot));
+    EXPECT_EQ(forwarded[2].sequenceId, 5);
+    EXPECT_EQ(net.rawDropped.load(), 2u);
+}
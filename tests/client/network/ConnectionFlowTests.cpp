@@ -1,3 +1,4 @@
+#include "concurrency/SpscQueue.hpp"
 #include "concurrency/ThreadSafeQueue.hpp"
 #include "network/NetworkMessageHandler.hpp"
 #include "network/PacketHeader.hpp"
@@ -9,12 +10,12 @@
 class ConnectionFlowTest : public ::testing::Test
 {
   protected:
-    ThreadSafeQueue<std::vector<std::uint8_t>> rawQueue;
-    ThreadSafeQueue<SnapshotParseResult> snapshotQueue;
+    SpscQueue<std::vector<std::uint8_t>> rawQueue;
+    SpscQueue<SnapshotParseResult> snapshotQueue;
     ThreadSafeQueue<LevelInitData> levelInitQueue;
     ThreadSafeQueue<LevelEventData> levelEventQueue;
-    ThreadSafeQueue<EntitySpawnPacket> spawnQueue;
-    ThreadSafeQueue<EntityDestroyedPacket> destroyQueue;
+    SpscQueue<EntitySpawnPacket> spawnQueue;
+    SpscQueue<EntityDestroyedPacket> destroyQueue;
 
     std::atomic<bool> handshakeFlag{false};
     std::atomic<bool> allReadyFlag{false};
@@ -1,11 +1,14 @@
+#include "concurrency/SpscQueue.hpp"
 #include "concurrency/ThreadSafeQueue.hpp"
 #include "network/LevelInitData.hpp"
 #include "network/NetworkMessageHandler.hpp"
 #include "network/PacketHeader.hpp"
 #include "network/Packing.hpp"
+#include "network/SnapshotCodec.hpp"
 #include "network/SnapshotParser.hpp"
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <vector>
 
 namespace
@@ -24,28 +27,28 @@ namespace
         out.push_back(static_cast<std::uint8_t>(v & 0xFF));
     }
 
-    void writeQ16(std::vector<std::uint8_t>& out, float v)
-    {
-        std::int16_t q = Packing::quantizeTo16(v, 10.0F);
-        out.push_back(static_cast<std::uint8_t>((q >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(q & 0xFF));
-    }
-
-    std::vector<std::uint8_t> makeSnapshotPacket()
+    std::vector<std::uint8_t> makeSnapshotPacket(std::uint32_t tick = 0)
     {
         PacketHeader h{};
         h.packetType  = static_cast<std::uint8_t>(PacketType::ServerToClient);
         h.messageType = static_cast<std::uint8_t>(MessageType::Snapshot);
+        h.tickId      = tick;
 
         std::vector<std::uint8_t> buf;
         auto hdr = h.encode();
         buf.insert(buf.end(), hdr.begin(), hdr.end());
 
+        SnapshotCodec::EntityFields fields{};
+        fields.posY = Packing::quantizeTo16(-5.0F, SnapshotCodec::kPositionScale);
+        fields.velX = Packing::quantizeTo16(10.0F, SnapshotCodec::kVelocityScale);
+        BitWriter stream;
+        SnapshotCodec::writeBaseline(stream, tick, std::nullopt);
+        std::uint32_t nextId = 0;
+        SnapshotCodec::EntityHeader header{123, SnapshotCodec::kFieldPosY | SnapshotCodec::kFieldVelX, false};
+        SnapshotCodec::writeEntity(stream, nextId, false, header, fields, nullptr);
+
         writeU16(buf, 1);
-        writeU32(buf, 123);
-        writeU16(buf, 0x00C);
-        writeQ16(buf, -5.0F);
-        writeQ16(buf, 10.0F);
+        buf.insert(buf.end(), stream.bytes().begin(), stream.bytes().end());
 
         std::size_t payloadSize = buf.size() - PacketHeader::kSize;
         buf[13]                 = static_cast<std::uint8_t>((payloadSize >> 8) & 0xFF);
@@ -75,8 +78,8 @@ namespace
 
 TEST(NetworkMessageHandler, DispatchesSnapshotToParsedQueue)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     NetworkMessageHandler handler(raw, parsed, levelInit);
 
@@ -95,8 +98,8 @@ TEST(NetworkMessageHandler, DispatchesSnapshotToParsedQueue)
 
 TEST(NetworkMessageHandler, IgnoresNonSnapshot)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     NetworkMessageHandler handler(raw, parsed, levelInit);
 
@@ -109,8 +112,8 @@ TEST(NetworkMessageHandler, IgnoresNonSnapshot)
 
 TEST(NetworkMessageHandler, IgnoresInvalidHeader)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     NetworkMessageHandler handler(raw, parsed, levelInit);
 
@@ -124,8 +127,8 @@ TEST(NetworkMessageHandler, IgnoresInvalidHeader)
 
 TEST(NetworkMessageHandler, IgnoresCrcMismatch)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     NetworkMessageHandler handler(raw, parsed, levelInit);
 
@@ -140,11 +143,78 @@ TEST(NetworkMessageHandler, IgnoresCrcMismatch)
 
 TEST(NetworkMessageHandler, NoCrashOnEmptyQueue)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> raw;
-    ThreadSafeQueue<SnapshotParseResult> parsed;
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed;
     ThreadSafeQueue<LevelInitData> levelInit;
     NetworkMessageHandler handler(raw, parsed, levelInit);
     handler.poll();
     SnapshotParseResult out;
     EXPECT_FALSE(parsed.tryPop(out));
 }
+
+TEST(NetworkMessageHandler, SnapshotDroppedOnFullQueueIsNotAcknowledged)
+{
+    SpscQueue<std::vector<std::uint8_t>> raw;
+    SpscQueue<SnapshotParseResult> parsed(2);
+    ThreadSafeQueue<LevelInitData> levelInit;
+    ThreadSafeQueue<LevelEventData> levelEvents;
+    SpscQueue<EntitySpawnPacket> spawns;
+    SpscQueue<EntityDestroyedPacket> destroys;
+    std::atomic<std::uint32_t> ackTick{0};
+    NetworkMessageHandler handler(raw, parsed, levelInit, levelEvents, spawns, destroys, nullptr, nullptr, nullptr,
+                                  nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &ackTick);
+
+    raw.push(makeSnapshotPacket(10));
+    raw.push(makeSnapshotPacket(11));
+    handler.poll();
+    EXPECT_EQ(ackTick.load(), 11u);
+
+    raw.push(makeSnapshotPacket(12));
+    handler.poll();
+    EXPECT_EQ(ackTick.load(), 11u);
+
+    SnapshotParseResult out;
+    ASSERT_TRUE(parsed.tryPop(out));
+    EXPECT_EQ(out.header.tickId, 10u);
+    raw.push(makeSnapshotPacket(13));
+    handler.poll();
+    EXPECT_EQ(ackTick.load(), 13u);
+}
+
+TEST(NetworkMessageHandler, SpawnAndDestroyEventsSurviveFullQueues)
+{
+    SpscQueue<std::vector<std::uint8_t>> raw(16);
+    SpscQueue<SnapshotParseResult> parsed;
+    ThreadSafeQueue<LevelInitData> levelInit;
+    ThreadSafeQueue<LevelEventData> levelEvents;
+    SpscQueue<EntitySpawnPacket> spawns(2);
+    SpscQueue<EntityDestroyedPacket> destroys(2);
+    NetworkMessageHandler handler(raw, parsed, levelInit, levelEvents, spawns, destroys);
+
+    for (std::uint32_t id = 1; id <= 5; ++id) {
+        EntitySpawnPacket spawn{};
+        spawn.entityId  = id;
+        auto spawnBytes = spawn.encode();
+        raw.push(std::vector<std::uint8_t>(spawnBytes.begin(), spawnBytes.end()));
+        EntityDestroyedPacket destroy{};
+        destroy.entityId  = id;
+        auto destroyBytes = destroy.encode();
+        raw.push(std::vector<std::uint8_t>(destroyBytes.begin(), destroyBytes.end()));
+    }
+    handler.poll();
+
+    std::vector<std::uint32_t> spawned;
+    std::vector<std::uint32_t> destroyed;
+    for (int round = 0; round < 4; ++round) {
+        EntitySpawnPacket spawn{};
+        while (spawns.tryPop(spawn))
+            spawned.push_back(spawn.entityId);
+        EntityDestroyedPacket destroy{};
+        while (destroys.tryPop(destroy))
+            destroyed.push_back(destroy.entityId);
+        handler.poll();
+    }
+    const std::vector<std::uint32_t> expected{1, 2, 3, 4, 5};
+    EXPECT_EQ(spawned, expected);
+    EXPECT_EQ(destroyed, expected);
+}
@@ -0,0 +1,52 @@
+#include "network/SnapshotHistory.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    std::shared_ptr<SnapshotHistory::State> stateWith(std::initializer_list<std::uint32_t> ids)
+    {
+        auto state = std::make_shared<SnapshotHistory::State>();
+        for (std::uint32_t id : ids)
+            (*state)[id] = SnapshotCodec::EntityFields{};
+        return state;
+    }
+} // namespace
+
+TEST(SnapshotHistory, EvictsOldestTicksBeyondCapacity)
+{
+    SnapshotHistory history;
+    for (std::uint32_t tick = 1; tick <= SnapshotHistory::kCapacity + 2; ++tick)
+        history.store(tick, stateWith({tick}));
+
+    EXPECT_EQ(history.size(), SnapshotHistory::kCapacity);
+    EXPECT_FALSE(history.find(1));
+    EXPECT_FALSE(history.find(2));
+    ASSERT_TRUE(history.find(3));
+    EXPECT_TRUE(history.find(3)->contains(3));
+}
+
+TEST(SnapshotHistory, DerivedStatesDropForgottenEntitiesUntilResent)
+{
+    SnapshotHistory history;
+    history.store(1, stateWith({4, 5}));
+    history.forget(4);
+
+    auto derived = history.derive(history.find(1));
+    EXPECT_FALSE(derived->contains(4));
+    EXPECT_TRUE(derived->contains(5));
+    EXPECT_TRUE(history.find(1)->contains(4));
+
+    (*derived)[4] = SnapshotCodec::EntityFields{};
+    history.store(2, derived);
+    EXPECT_TRUE(history.derive(history.find(2))->contains(4));
+}
+
+TEST(SnapshotHistory, ReplacesStateStoredForSameTick)
+{
+    SnapshotHistory history;
+    history.store(7, stateWith({1}));
+    history.store(7, stateWith({2}));
+    EXPECT_EQ(history.size(), 1u);
+    EXPECT_TRUE(history.find(7)->contains(2));
+}
@@ -1,27 +1,27 @@
 #include "network/PacketHeader.hpp"
 #include "network/Packing.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "network/SnapshotHistory.hpp"
 #include "network/SnapshotParser.hpp"
 
-#include <bit>
 #include <gtest/gtest.h>
 
 namespace
 {
-    std::vector<std::uint8_t> buildSnapshot(std::uint16_t entityCount,
-                                            const std::vector<std::vector<std::uint8_t>>& entityPayloads)
+    std::vector<std::uint8_t> buildSnapshot(std::uint16_t entityCount, const BitWriter& stream,
+                                            std::uint32_t tick = 0)
     {
         PacketHeader h{};
         h.packetType  = static_cast<std::uint8_t>(PacketType::ServerToClient);
         h.messageType = static_cast<std::uint8_t>(MessageType::Snapshot);
+        h.tickId      = tick;
 
         std::vector<std::uint8_t> buf;
         auto hdr = h.encode();
         buf.insert(buf.end(), hdr.begin(), hdr.end());
         buf.push_back(static_cast<std::uint8_t>((entityCount >> 8) & 0xFF));
         buf.push_back(static_cast<std::uint8_t>(entityCount & 0xFF));
-        for (auto& payload : entityPayloads) {
-            buf.insert(buf.end(), payload.begin(), payload.end());
-        }
+        buf.insert(buf.end(), stream.bytes().begin(), stream.bytes().end());
         std::size_t payloadSize = buf.size() - PacketHeader::kSize;
         buf[13]                 = static_cast<std::uint8_t>((payloadSize >> 8) & 0xFF);
         buf[14]                 = static_cast<std::uint8_t>(payloadSize & 0xFF);
@@ -36,57 +36,35 @@ namespace
         return buf;
     }
 
-    std::vector<std::uint8_t> entityPayload(std::uint32_t id, std::uint16_t mask, const std::vector<std::uint8_t>& data)
+    BitWriter absoluteStream()
     {
-        std::vector<std::uint8_t> out;
-        out.push_back(static_cast<std::uint8_t>((id >> 24) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((id >> 16) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((id >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(id & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((mask >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(mask & 0xFF));
-        out.insert(out.end(), data.begin(), data.end());
-        return out;
+        BitWriter stream;
+        SnapshotCodec::writeBaseline(stream, 0, std::nullopt);
+        return stream;
     }
 
-    void writeQ16(std::vector<std::uint8_t>& out, float v)
+    std::int16_t q16(float v)
     {
-        std::int16_t q = Packing::quantizeTo16(v, 10.0F);
-        out.push_back(static_cast<std::uint8_t>((q >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(q & 0xFF));
-    }
-
-    void writeFloat(std::vector<std::uint8_t>& out, float v)
-    {
-        auto bits = std::bit_cast<std::uint32_t>(v);
-        out.push_back(static_cast<std::uint8_t>((bits >> 24) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((bits >> 16) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>((bits >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(bits & 0xFF));
-    }
-
-    void writeU16(std::vector<std::uint8_t>& out, std::uint16_t v)
-    {
-        out.push_back(static_cast<std::uint8_t>((v >> 8) & 0xFF));
-        out.push_back(static_cast<std::uint8_t>(v & 0xFF));
+        return Packing::quantizeTo16(v, SnapshotCodec::kPositionScale);
     }
 } // namespace
 
 TEST(SnapshotParser, ParsesSingleEntityWithFields)
 {
-    std::vector<std::uint8_t> data;
-    data.push_back(7);
-    writeQ16(data, 1.5F);
-    writeQ16(data, -2.5F);
-    writeQ16(data, 0.5F);
-    writeQ16(data, -0.25F);
-    writeU16(data, 50);
-    data.push_back(Packing::pack44(3, 5));
-    writeFloat(data, 0.1F);
-    data.push_back(1);
-
-    auto payload = entityPayload(42, 0x1FF, data);
-    auto pkt     = buildSnapshot(1, {payload});
+    SnapshotCodec::EntityFields fields{};
+    fields.type   = 7;
+    fields.posX   = q16(1.5F);
+    fields.posY   = q16(-2.5F);
+    fields.velX   = q16(0.5F);
+    fields.velY   = q16(-0.25F);
+    fields.health = 50;
+    fields.status = Packing::pack44(3, 5);
+    fields.score  = 1200;
+
+    auto stream          = absoluteStream();
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(stream, nextId, false, {42, SnapshotCodec::kWireFields, false}, fields, nullptr);
+    auto pkt = buildSnapshot(1, stream);
 
     auto parsed = SnapshotParser::parse(pkt);
     ASSERT_TRUE(parsed.has_value());
@@ -105,15 +83,15 @@ TEST(SnapshotParser, ParsesSingleEntityWithFields)
     EXPECT_EQ(*e.statusEffects, 3u);
     EXPECT_TRUE(e.lives.has_value());
     EXPECT_EQ(*e.lives, 5);
-    EXPECT_TRUE(e.orientation.has_value());
-    EXPECT_NEAR(*e.orientation, 0.1F, 1e-5F);
-    EXPECT_TRUE(e.dead.has_value());
-    EXPECT_TRUE(*e.dead);
+    EXPECT_TRUE(e.score.has_value());
+    EXPECT_EQ(*e.score, 1200);
+    EXPECT_FALSE(e.orientation.has_value());
+    EXPECT_FALSE(e.dead.has_value());
 }
 
 TEST(SnapshotParser, RejectsWrongPacketType)
 {
-    auto pkt    = buildSnapshot(0, {});
+    auto pkt    = buildSnapshot(0, absoluteStream());
     pkt[5]      = static_cast<std::uint8_t>(PacketType::ClientToServer);
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
@@ -121,7 +99,7 @@ TEST(SnapshotParser, RejectsWrongPacketType)
 
 TEST(SnapshotParser, RejectsWrongMessageType)
 {
-    auto pkt    = buildSnapshot(0, {});
+    auto pkt    = buildSnapshot(0, absoluteStream());
     pkt[6]      = static_cast<std::uint8_t>(MessageType::Input);
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
@@ -129,7 +107,7 @@ TEST(SnapshotParser, RejectsWrongMessageType)
 
 TEST(SnapshotParser, RejectsCrcMismatch)
 {
-    auto pkt = buildSnapshot(0, {});
+    auto pkt = buildSnapshot(0, absoluteStream());
     pkt.back() ^= 0xFF;
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
@@ -137,7 +115,7 @@ TEST(SnapshotParser, RejectsCrcMismatch)
 
 TEST(SnapshotParser, ParsesZeroEntities)
 {
-    auto pkt    = buildSnapshot(0, {});
+    auto pkt    = buildSnapshot(0, absoluteStream());
     auto parsed = SnapshotParser::parse(pkt);
     ASSERT_TRUE(parsed.has_value());
     EXPECT_TRUE(parsed->entities.empty());
@@ -145,42 +123,47 @@ TEST(SnapshotParser, ParsesZeroEntities)
 
 TEST(SnapshotParser, RejectsTruncatedEntityHeader)
 {
-    auto payload = entityPayload(1, 0xFFFF, {});
-    payload.resize(5);
-    auto pkt    = buildSnapshot(1, {payload});
+    auto stream = absoluteStream();
+    stream.writeBits(0x1F, 5);
+    auto pkt    = buildSnapshot(1, stream);
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
 }
 
 TEST(SnapshotParser, RejectsMissingFieldData)
 {
-    std::vector<std::uint8_t> data;
-    auto payload = entityPayload(1, 0x001, data);
-    auto pkt     = buildSnapshot(1, {payload});
-    auto parsed  = SnapshotParser::parse(pkt);
+    auto stream = absoluteStream();
+    stream.writeVarUInt(1, SnapshotCodec::kIdGroupBits);
+    stream.writeBits(SnapshotCodec::compactMask(SnapshotCodec::kFieldPosX), SnapshotCodec::kMaskBits);
+    auto pkt    = buildSnapshot(1, stream);
+    auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
 }
 
 TEST(SnapshotParser, RejectsPayloadTooShortForCount)
 {
-    auto pkt    = buildSnapshot(2, {});
+    auto pkt    = buildSnapshot(2, absoluteStream());
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
 }
 
 TEST(SnapshotParser, ParsesMultipleEntities)
 {
-    std::vector<std::uint8_t> e1data;
-    e1data.push_back(2);
-    writeQ16(e1data, 10.0F);
-    auto e1 = entityPayload(10, 0x003, e1data);
+    SnapshotCodec::EntityFields first{};
+    first.type = 2;
+    first.posX = q16(10.0F);
+    SnapshotCodec::EntityFields second{};
+    second.posY = q16(-1.0F);
+    second.velX = q16(2.0F);
+
+    auto stream          = absoluteStream();
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(stream, nextId, false,
+                               {10, SnapshotCodec::kFieldType | SnapshotCodec::kFieldPosX, false}, first, nullptr);
+    SnapshotCodec::writeEntity(stream, nextId, false,
+                               {20, SnapshotCodec::kFieldPosY | SnapshotCodec::kFieldVelX, false}, second, nullptr);
+    auto pkt = buildSnapshot(2, stream);
 
-    std::vector<std::uint8_t> e2data;
-    writeQ16(e2data, -1.0F);
-    writeQ16(e2data, 2.0F);
-    auto e2 = entityPayload(20, 0x00C, e2data);
-
-    auto pkt    = buildSnapshot(2, {e1, e2});
     auto parsed = SnapshotParser::parse(pkt);
     ASSERT_TRUE(parsed.has_value());
     ASSERT_EQ(parsed->entities.size(), 2u);
@@ -202,3 +185,52 @@ TEST(SnapshotParser, RejectsIfBufferSmallerThanHeaderPlusCrc)
     auto parsed = SnapshotParser::parse(pkt);
     EXPECT_FALSE(parsed.has_value());
 }
+
+TEST(SnapshotParser, DecodesDeltaAgainstStoredBaseline)
+{
+    SnapshotHistory history;
+    SnapshotCodec::EntityFields base{};
+    base.type = 3;
+    base.posX = q16(100.0F);
+    base.posY = q16(50.0F);
+
+    auto full            = absoluteStream();
+    std::uint32_t nextId = 0;
+    const std::uint16_t fullMask =
+        SnapshotCodec::kFieldType | SnapshotCodec::kFieldPosX | SnapshotCodec::kFieldPosY;
+    SnapshotCodec::writeEntity(full, nextId, false, {5, fullMask, false}, base, nullptr);
+    ASSERT_TRUE(SnapshotParser::parse(buildSnapshot(1, full, 10), &history).has_value());
+
+    auto moved = base;
+    moved.posX = q16(100.3F);
+    BitWriter delta;
+    SnapshotCodec::writeBaseline(delta, 12, 10);
+    nextId = 0;
+    SnapshotCodec::writeEntity(delta, nextId, true, {5, SnapshotCodec::kFieldPosX, true}, moved, &base);
+
+    auto parsed = SnapshotParser::parse(buildSnapshot(1, delta, 12), &history);
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(parsed->entities.size(), 1u);
+    EXPECT_NEAR(*parsed->entities[0].posX, 100.3F, 0.01F);
+    EXPECT_FALSE(parsed->entities[0].posY.has_value());
+
+    auto stored = history.find(12);
+    ASSERT_TRUE(stored);
+    EXPECT_EQ(stored->at(5).posY, base.posY);
+    EXPECT_EQ(stored->at(5).posX, moved.posX);
+}
+
+TEST(SnapshotParser, RejectsDeltaWithUnknownBaseline)
+{
+    SnapshotHistory history;
+    SnapshotCodec::EntityFields base{};
+    BitWriter delta;
+    SnapshotCodec::writeBaseline(delta, 12, 10);
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(delta, nextId, true, {5, SnapshotCodec::kFieldPosX, true}, base, &base);
+    auto pkt = buildSnapshot(1, delta, 12);
+
+    EXPECT_FALSE(SnapshotParser::parse(pkt, &history).has_value());
+    EXPECT_FALSE(SnapshotParser::parse(pkt).has_value());
+    EXPECT_EQ(history.size(), 0u);
+}
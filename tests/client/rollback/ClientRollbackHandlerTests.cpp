@@ -96,3 +96,22 @@ TEST_F(ClientRollbackHandlerTest, HistoryManagement)
     EXPECT_EQ(handler.getHistorySize(), 0);
     EXPECT_FALSE(handler.hasSnapshot(1));
 }
+
+TEST_F(ClientRollbackHandlerTest, ChecksumUsesTheSharedStateHash)
+{
+    EntityId e1 = registry.createEntity();
+    registry.emplace<TransformComponent>(e1, TransformComponent::create(10.0f, 20.0f));
+    registry.emplace<HealthComponent>(e1, HealthComponent::create(100));
+    EntityId e2 = registry.createEntity();
+    registry.emplace<TransformComponent>(e2, TransformComponent::create(-5.0f, 3.0f));
+
+    StateHash expected;
+    expected.update(e1, {10.0f, 20.0f, 100});
+    expected.update(e2, {-5.0f, 3.0f, 0});
+
+    EXPECT_EQ(handler.captureState(1, registry), expected.value());
+
+    registry.destroyEntity(e2);
+    expected.erase(e2);
+    EXPECT_EQ(handler.captureState(2, registry), expected.value());
+}
@@ -2,63 +2,67 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 class ClientStateHistoryTest : public ::testing::Test
 {
   protected:
     ClientStateHistory history;
+    std::vector<EntityId> ids;
+    std::vector<ClientEntityState> states;
 };
 
 TEST_F(ClientStateHistoryTest, InitialState)
 {
     EXPECT_TRUE(history.empty());
     EXPECT_EQ(history.size(), 0);
-    EXPECT_FALSE(history.getLatest().has_value());
+    EXPECT_FALSE(history.getTickRange().has_value());
 }
 
 TEST_F(ClientStateHistoryTest, AddSnapshot)
 {
-    std::unordered_map<EntityId, ClientEntityState> entities;
-    entities[1] = {10.0f, 20.0f, 1.0f, 0.0f, 100, true};
+    ids.push_back(1);
+    states.push_back({10.0f, 20.0f, 1.0f, 0.0f, 100, true});
 
-    history.addSnapshot(100, entities, 12345);
+    history.addSnapshot(100, ids, states, 12345);
 
     EXPECT_FALSE(history.empty());
     EXPECT_EQ(history.size(), 1);
 
-    auto latest = history.getLatest();
-    ASSERT_TRUE(latest.has_value());
-    EXPECT_EQ(latest->get().tick, 100);
-    EXPECT_EQ(latest->get().checksum, 12345);
-    EXPECT_EQ(latest->get().entities.at(1).posX, 10.0f);
+    ClientStateSnapshot snapshot;
+    ASSERT_TRUE(history.getSnapshot(100, snapshot));
+    EXPECT_EQ(snapshot.tick, 100);
+    EXPECT_EQ(snapshot.checksum, 12345);
+    ASSERT_EQ(snapshot.ids.size(), 1U);
+    EXPECT_EQ(snapshot.ids[0], 1U);
+    EXPECT_EQ(snapshot.states[0].posX, 10.0f);
+    EXPECT_EQ(snapshot.states[0].health, 100);
 }
 
 TEST_F(ClientStateHistoryTest, GetSnapshotByTick)
 {
-    std::unordered_map<EntityId, ClientEntityState> entities;
-    history.addSnapshot(100, entities, 111);
-    history.addSnapshot(101, entities, 222);
-    history.addSnapshot(102, entities, 333);
+    history.addSnapshot(100, ids, states, 111);
+    history.addSnapshot(101, ids, states, 222);
+    history.addSnapshot(102, ids, states, 333);
 
-    auto s101 = history.getSnapshot(101);
+    auto s101 = history.getChecksum(101);
     ASSERT_TRUE(s101.has_value());
-    EXPECT_EQ(s101->get().checksum, 222);
+    EXPECT_EQ(*s101, 222);
 
-    auto s99 = history.getSnapshot(99);
+    auto s99 = history.getChecksum(99);
     EXPECT_FALSE(s99.has_value());
 }
 
 TEST_F(ClientStateHistoryTest, CircularBufferLogic)
 {
-    std::unordered_map<EntityId, ClientEntityState> entities;
-
     for (std::uint64_t i = 0; i < ClientStateHistory::HISTORY_SIZE; ++i) {
-        history.addSnapshot(i, entities, static_cast<std::uint32_t>(i));
+        history.addSnapshot(i, ids, states, static_cast<std::uint32_t>(i));
     }
 
     EXPECT_EQ(history.size(), ClientStateHistory::HISTORY_SIZE);
     EXPECT_TRUE(history.hasSnapshot(0));
 
-    history.addSnapshot(ClientStateHistory::HISTORY_SIZE, entities, 999);
+    history.addSnapshot(ClientStateHistory::HISTORY_SIZE, ids, states, 999);
 
     EXPECT_EQ(history.size(), ClientStateHistory::HISTORY_SIZE);
     EXPECT_FALSE(history.hasSnapshot(0));
@@ -68,8 +72,7 @@ TEST_F(ClientStateHistoryTest, CircularBufferLogic)
 
 TEST_F(ClientStateHistoryTest, Clear)
 {
-    std::unordered_map<EntityId, ClientEntityState> entities;
-    history.addSnapshot(100, entities, 111);
+    history.addSnapshot(100, ids, states, 111);
 
     history.clear();
 
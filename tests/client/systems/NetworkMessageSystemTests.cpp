@@ -6,12 +6,12 @@
 
 TEST(NetworkMessageSystemTest, PollsHandler)
 {
-    ThreadSafeQueue<std::vector<std::uint8_t>> rawQueue;
-    ThreadSafeQueue<SnapshotParseResult> snapshotQueue;
+    SpscQueue<std::vector<std::uint8_t>> rawQueue;
+    SpscQueue<SnapshotParseResult> snapshotQueue;
     ThreadSafeQueue<LevelInitData> levelInitQueue;
     ThreadSafeQueue<LevelEventData> levelEventQueue;
-    ThreadSafeQueue<EntitySpawnPacket> spawnQueue;
-    ThreadSafeQueue<EntityDestroyedPacket> destroyQueue;
+    SpscQueue<EntitySpawnPacket> spawnQueue;
+    SpscQueue<EntityDestroyedPacket> destroyQueue;
 
     NetworkMessageHandler handler(rawQueue, snapshotQueue, levelInitQueue, levelEventQueue, spawnQueue, destroyQueue);
     NetworkMessageSystem system(handler);
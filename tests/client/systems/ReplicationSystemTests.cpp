@@ -4,7 +4,7 @@
 #include "components/SpriteComponent.hpp"
 #include "components/TransformComponent.hpp"
 #include "components/VelocityComponent.hpp"
-#include "concurrency/ThreadSafeQueue.hpp"
+#include "concurrency/SpscQueue.hpp"
 #include "ecs/Registry.hpp"
 #include "graphics/backends/sfml/SFMLTexture.hpp"
 #include "level/EntityTypeRegistry.hpp"
@@ -74,7 +74,7 @@ class ReplicationSystemTests : public ::testing::Test
   protected:
     ReplicationSystemTests() : system(queue, types) {}
 
-    ThreadSafeQueue<SnapshotParseResult> queue;
+    SpscQueue<SnapshotParseResult> queue;
     EntityTypeRegistry types;
     Registry registry;
     ReplicationSystem system;
@@ -0,0 +1,149 @@
+#include "game/GameInstance.hpp"
+#include "network/EntitySpawnPacket.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class GameInstanceTestAccess
+{
+  public:
+    static Registry& registry(GameInstance& instance)
+    {
+        return instance.registry_;
+    }
+
+    static EntityId addPlayer(GameInstance& instance, std::uint32_t playerId)
+    {
+        instance.addPlayerEntity(playerId);
+        return instance.playerEntities_.at(playerId);
+    }
+
+    static void handleDeathAndRespawn(GameInstance& instance)
+    {
+        instance.handleDeathAndRespawn();
+    }
+
+    static void processAllyPurchase(GameInstance& instance, const std::vector<PlayerCommand>& commands)
+    {
+        instance.processAllyPurchase(commands);
+    }
+
+    static void processShieldPurchase(GameInstance& instance, const std::vector<PlayerCommand>& commands)
+    {
+        instance.processShieldPurchase(commands);
+    }
+
+    static SendThread& sendThread(GameInstance& instance)
+    {
+        return instance.sendThread_;
+    }
+};
+
+namespace
+{
+    bool recvSpawn(UdpSocket& rx, EntitySpawnPacket& out, int attempts = 500)
+    {
+        std::array<std::uint8_t, EntitySpawnPacket::kSize> buf{};
+        IpEndpoint src{};
+        for (int i = 0; i < attempts; ++i) {
+            auto r = rx.recvFrom(buf.data(), buf.size(), src);
+            if (r.ok()) {
+                auto decoded = EntitySpawnPacket::decode(buf.data(), r.size);
+                if (decoded) {
+                    out = *decoded;
+                    return true;
+                }
+            } else if (r.error == UdpError::WouldBlock) {
+                std::this_thread::sleep_for(1ms);
+            }
+        }
+        return false;
+    }
+
+    PlayerCommand command(EntityId entity, InputFlag flag)
+    {
+        return PlayerCommand{static_cast<std::uint32_t>(entity), static_cast<std::uint16_t>(flag), 0.0F, 0.0F, 0.0F,
+                             1, 1};
+    }
+} // namespace
+
+class GameInstanceArchetypeTest : public ::testing::Test
+{
+  protected:
+    std::atomic<bool> runningFlag = true;
+    GameInstance instance{1, 0, runningFlag, StorageMode::Archetype};
+};
+
+TEST_F(GameInstanceArchetypeTest, RunsOnArchetypeRegistry)
+{
+    EXPECT_EQ(GameInstanceTestAccess::registry(instance).storageMode(), StorageMode::Archetype);
+}
+
+TEST_F(GameInstanceArchetypeTest, SimultaneousLastLifeDeathsEndTheGame)
+{
+    Registry& registry = GameInstanceTestAccess::registry(instance);
+    const EntityId p1  = GameInstanceTestAccess::addPlayer(instance, 1);
+    const EntityId p2  = GameInstanceTestAccess::addPlayer(instance, 2);
+    for (EntityId player : {p1, p2}) {
+        registry.get<LivesComponent>(player).current  = 1;
+        registry.get<HealthComponent>(player).current = 0;
+    }
+
+    int endCalls            = 0;
+    bool won                = true;
+    std::size_t resultCount = 0;
+    instance.setGameEndCallback([&](std::uint32_t, const std::vector<PlayerGameResult>& results, bool isWin) {
+        ++endCalls;
+        won         = isWin;
+        resultCount = results.size();
+    });
+
+    GameInstanceTestAccess::handleDeathAndRespawn(instance);
+
+    for (EntityId player : {p1, p2}) {
+        EXPECT_TRUE(registry.has<RespawnTimerComponent>(player));
+        EXPECT_EQ(registry.get<LivesComponent>(player).current, 0);
+    }
+    EXPECT_EQ(endCalls, 1);
+    EXPECT_FALSE(won);
+    EXPECT_EQ(resultCount, 2u);
+}
+
+TEST_F(GameInstanceArchetypeTest, PurchaseSpawnPacketsCarryEntityPositions)
+{
+    UdpSocket rx;
+    ASSERT_TRUE(rx.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    SendThread& send = GameInstanceTestAccess::sendThread(instance);
+    ASSERT_TRUE(send.start());
+    send.setClients({rx.localEndpoint()});
+
+    Registry& registry = GameInstanceTestAccess::registry(instance);
+    const EntityId p1  = GameInstanceTestAccess::addPlayer(instance, 1);
+    GameInstanceTestAccess::addPlayer(instance, 2);
+    registry.get<ScoreComponent>(p1).value = AllyComponent::kAllyCost + ShieldComponent::kShieldCost;
+    const auto player                      = registry.get<TransformComponent>(p1);
+
+    GameInstanceTestAccess::processAllyPurchase(instance, {command(p1, InputFlag::Interact)});
+    EntitySpawnPacket ally{};
+    ASSERT_TRUE(recvSpawn(rx, ally));
+    ASSERT_TRUE(registry.has<TransformComponent>(ally.entityId));
+    EXPECT_FLOAT_EQ(ally.posX, player.x);
+    EXPECT_FLOAT_EQ(ally.posY, player.y + 30.0F);
+    EXPECT_FLOAT_EQ(registry.get<TransformComponent>(ally.entityId).y, ally.posY);
+
+    GameInstanceTestAccess::processShieldPurchase(instance, {command(p1, InputFlag::BuyShield)});
+    EntitySpawnPacket shield{};
+    ASSERT_TRUE(recvSpawn(rx, shield));
+    ASSERT_TRUE(registry.has<TransformComponent>(shield.entityId));
+    EXPECT_FLOAT_EQ(shield.posX, player.x + 40.0F);
+    EXPECT_FLOAT_EQ(shield.posY, player.y);
+    EXPECT_FLOAT_EQ(registry.get<TransformComponent>(shield.entityId).x, shield.posX);
+
+    send.stop();
+}
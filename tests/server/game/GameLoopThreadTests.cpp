@@ -20,7 +20,7 @@ static bool waitForTicks(std::atomic<int>& counter, int target, int attempts = 2
 
 TEST(GameLoopThread, RunsAtApprox60Hz)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::vector<std::chrono::steady_clock::time_point> times;
     std::atomic<int> ticks{0};
     GameLoopThread loop(inputs, [&](const GameLoopThread::TickInputs&) {
@@ -45,7 +45,7 @@ TEST(GameLoopThread, RunsAtApprox60Hz)
 
 TEST(GameLoopThread, RunsAtCustomRate)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::vector<std::chrono::steady_clock::time_point> times;
     std::atomic<int> ticks{0};
     GameLoopThread loop(
@@ -72,7 +72,7 @@ TEST(GameLoopThread, RunsAtCustomRate)
 
 TEST(GameLoopThread, DrainsInputQueueEachTick)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::atomic<int> processed{0};
     GameLoopThread loop(inputs,
                         [&](const GameLoopThread::TickInputs& batch) { processed += static_cast<int>(batch.size()); });
@@ -89,7 +89,7 @@ TEST(GameLoopThread, DrainsInputQueueEachTick)
 
 TEST(GameLoopThread, ProcessesNewInputsAcrossTicks)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::atomic<int> processed{0};
     GameLoopThread loop(inputs,
                         [&](const GameLoopThread::TickInputs& batch) { processed += static_cast<int>(batch.size()); });
@@ -112,7 +112,7 @@ TEST(GameLoopThread, ProcessesNewInputsAcrossTicks)
 
 TEST(GameLoopThread, ContinuesWhenWorkSlowerThanTick)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::atomic<int> ticks{0};
     GameLoopThread loop(inputs, [&](const GameLoopThread::TickInputs&) {
         std::this_thread::sleep_for(5ms);
@@ -126,7 +126,7 @@ TEST(GameLoopThread, ContinuesWhenWorkSlowerThanTick)
 
 TEST(GameLoopThread, EmptyBatchStillTicks)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::atomic<int> ticks{0};
     std::atomic<int> lastSize{0};
     GameLoopThread loop(inputs, [&](const GameLoopThread::TickInputs& batch) {
@@ -141,7 +141,7 @@ TEST(GameLoopThread, EmptyBatchStillTicks)
 
 TEST(GameLoopThread, StopsHaltsTicks)
 {
-    ThreadSafeQueue<ReceivedInput> inputs;
+    MpscQueue<ReceivedInput> inputs;
     std::atomic<int> ticks{0};
     GameLoopThread loop(inputs, [&](const GameLoopThread::TickInputs&) { ticks.fetch_add(1); });
     ASSERT_TRUE(loop.start());
@@ -0,0 +1,121 @@
+#include "components/Components.hpp"
+#include "network/InputPacket.hpp"
+#include "simulation/GameWorld.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace
+{
+    constexpr int kTicks                = 240;
+    constexpr float kDeltaTime          = 1.0F / 60.0F;
+    constexpr int kEnemies              = 12;
+    constexpr float kEnemyStepY         = 50.0F;
+    constexpr std::int32_t kEnemyHealth = kEnemies / 2 * (20 + 60);
+
+    using EntityState = std::tuple<std::uint32_t, int, int, std::int32_t, bool>;
+
+    struct Outcome
+    {
+        std::vector<EntityState> entities;
+        std::size_t spawned      = 0;
+        std::int32_t enemyHealth = 0;
+    };
+
+    EntityId addPlayer(Registry& registry, float y)
+    {
+        EntityId entity = registry.createEntity();
+        registry.emplace<BoundaryComponent>(entity, BoundaryComponent::create(0.0F, 0.0F, 1246.0F, 702.0F));
+        registry.emplace<TransformComponent>(entity, TransformComponent::create(100.0F, y));
+        registry.emplace<VelocityComponent>(entity, VelocityComponent::create(0.0F, 0.0F));
+        registry.emplace<HealthComponent>(entity, HealthComponent::create(1000));
+        registry.emplace<PlayerInputComponent>(entity);
+        registry.emplace<TagComponent>(entity, TagComponent::create(EntityTag::Player));
+        registry.emplace<LivesComponent>(entity, LivesComponent::create(3, 3));
+        registry.emplace<ScoreComponent>(entity, ScoreComponent::create(0));
+        registry.emplace<HitboxComponent>(entity, HitboxComponent::create(60.0F, 30.0F, 0.0F, 0.0F, true));
+        registry.emplace<OwnershipComponent>(entity, OwnershipComponent::create(entity));
+        return entity;
+    }
+
+    void addEnemy(Registry& registry, int index)
+    {
+        EntityId entity = registry.createEntity();
+        registry.emplace<TransformComponent>(
+            entity, TransformComponent::create(700.0F + 20.0F * static_cast<float>(index),
+                                               60.0F + kEnemyStepY * static_cast<float>(index)));
+        if (index % 3 == 0)
+            registry.emplace<MovementComponent>(entity, MovementComponent::linear(40.0F));
+        else if (index % 3 == 1)
+            registry.emplace<MovementComponent>(entity, MovementComponent::sine(40.0F, 30.0F, 1.5F));
+        else
+            registry.emplace<MovementComponent>(entity, MovementComponent::followPlayer(60.0F));
+        registry.emplace<VelocityComponent>(entity);
+        registry.emplace<TagComponent>(entity, TagComponent::create(EntityTag::Enemy));
+        registry.emplace<HealthComponent>(entity, HealthComponent::create(index % 2 == 0 ? 20 : 60));
+        registry.emplace<HitboxComponent>(entity, HitboxComponent::create(40.0F, 40.0F, 0.0F, 0.0F, true));
+        registry.emplace<ScoreValueComponent>(entity, ScoreValueComponent::create(100));
+        if (index % 2 == 1)
+            registry.emplace<EnemyShootingComponent>(entity, EnemyShootingComponent::create(0.5F, 300.0F, 5));
+    }
+
+    Outcome simulate(StorageMode mode)
+    {
+        GameWorld world(mode);
+        Registry& registry = world.getRegistry();
+        EXPECT_EQ(registry.storageMode(), mode);
+
+        std::map<std::uint32_t, EntityId> players;
+        players[0] = addPlayer(registry, 200.0F);
+        players[1] = addPlayer(registry, 450.0F);
+        for (int i = 0; i < kEnemies; ++i)
+            addEnemy(registry, i);
+
+        Outcome outcome;
+        for (int tick = 1; tick <= kTicks; ++tick) {
+            std::vector<PlayerCommand> commands;
+            for (const auto& [playerId, entity] : players) {
+                std::uint16_t flags = (tick / 40) % 2 == 0 ? static_cast<std::uint16_t>(InputFlag::MoveDown)
+                                                            : static_cast<std::uint16_t>(InputFlag::MoveUp);
+                if (tick % 6 == 0)
+                    flags |= static_cast<std::uint16_t>(InputFlag::Fire);
+                commands.push_back(PlayerCommand{static_cast<std::uint32_t>(entity), flags, 0.0F, 0.0F, 0.0F,
+                                                 static_cast<std::uint16_t>(tick), static_cast<std::uint32_t>(tick)});
+            }
+            world.tick(kDeltaTime, commands, players);
+            for (const auto& event : world.consumeEvents()) {
+                if (std::holds_alternative<EntitySpawnedEvent>(event))
+                    ++outcome.spawned;
+            }
+        }
+
+        for (auto [id, transform] : registry.view<TransformComponent>().each()) {
+            const bool hasHealth      = registry.has<HealthComponent>(id);
+            const std::int32_t health = hasHealth ? registry.get<HealthComponent>(id).current : 0;
+            if (registry.hasTag(id, EntityTag::Enemy))
+                outcome.enemyHealth += health;
+            outcome.entities.emplace_back(registry.tagMask(id), static_cast<int>(transform.x * 16.0F),
+                                          static_cast<int>(transform.y * 16.0F), health,
+                                          registry.has<MissileComponent>(id));
+        }
+        std::sort(outcome.entities.begin(), outcome.entities.end());
+        return outcome;
+    }
+} // namespace
+
+TEST(GameWorldStorage, ArchetypeWorldMatchesSparseSetWorld)
+{
+    const Outcome sparse    = simulate(StorageMode::SparseSet);
+    const Outcome archetype = simulate(StorageMode::Archetype);
+
+    EXPECT_GT(sparse.spawned, 2u * kEnemies);
+    EXPECT_LT(sparse.enemyHealth, kEnemyHealth);
+    EXPECT_EQ(archetype.spawned, sparse.spawned);
+    EXPECT_EQ(archetype.enemyHealth, sparse.enemyHealth);
+    EXPECT_EQ(archetype.entities, sparse.entities);
+}
@@ -0,0 +1,138 @@
+#include "game/RoomScheduler.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    bool waitFor(const std::atomic<int>& counter, int target, int attempts = 300)
+    {
+        for (int i = 0; i < attempts; ++i) {
+            if (counter.load() >= target)
+                return true;
+            std::this_thread::sleep_for(2ms);
+        }
+        return false;
+    }
+} // namespace
+
+TEST(RoomScheduler, TicksEveryRoomOnASmallPool)
+{
+    RoomScheduler scheduler(2);
+    ASSERT_TRUE(scheduler.start());
+    std::array<MpscQueue<ReceivedInput>, 8> inputs;
+    std::array<std::atomic<int>, 8> ticks{};
+    for (std::uint32_t i = 0; i < inputs.size(); ++i) {
+        ASSERT_TRUE(scheduler.add(i, inputs[i], [&ticks, i](const RoomScheduler::TickInputs&) { ticks[i]++; }));
+    }
+    std::this_thread::sleep_for(300ms);
+    scheduler.stop();
+
+    for (std::uint32_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_GE(ticks[i].load(), 12) << "room " << i;
+        EXPECT_LE(ticks[i].load(), 22) << "room " << i;
+    }
+    EXPECT_EQ(scheduler.roomCount(), 8U);
+}
+
+TEST(RoomScheduler, DrainsTheRoomsInputQueueEachTick)
+{
+    RoomScheduler scheduler(1);
+    ASSERT_TRUE(scheduler.start());
+    MpscQueue<ReceivedInput> inputs;
+    std::atomic<int> processed{0};
+    ASSERT_TRUE(scheduler.add(1, inputs, [&](const RoomScheduler::TickInputs& batch) {
+        processed += static_cast<int>(batch.size());
+    }));
+    for (int i = 0; i < 5; ++i) {
+        ReceivedInput ev{};
+        ev.input.playerId = static_cast<std::uint32_t>(i + 1);
+        inputs.push(ev);
+    }
+    ASSERT_TRUE(waitFor(processed, 5));
+    scheduler.stop();
+    EXPECT_EQ(processed.load(), 5);
+}
+
+TEST(RoomScheduler, RejectsDuplicateRooms)
+{
+    RoomScheduler scheduler(1);
+    MpscQueue<ReceivedInput> inputs;
+    EXPECT_TRUE(scheduler.add(3, inputs, [](const RoomScheduler::TickInputs&) {}));
+    EXPECT_FALSE(scheduler.add(3, inputs, [](const RoomScheduler::TickInputs&) {}));
+    EXPECT_TRUE(scheduler.contains(3));
+    EXPECT_FALSE(scheduler.metrics(4).has_value());
+    EXPECT_TRUE(scheduler.remove(3));
+    EXPECT_FALSE(scheduler.remove(3));
+}
+
+TEST(RoomScheduler, RemoveWaitsForTheTickInFlight)
+{
+    RoomScheduler scheduler(2);
+    ASSERT_TRUE(scheduler.start());
+    MpscQueue<ReceivedInput> inputs;
+    std::atomic<int> started{0};
+    std::atomic<bool> inTick{false};
+    ASSERT_TRUE(scheduler.add(1, inputs, [&](const RoomScheduler::TickInputs&) {
+        inTick = true;
+        started++;
+        std::this_thread::sleep_for(20ms);
+        inTick = false;
+    }));
+    ASSERT_TRUE(waitFor(started, 1));
+    ASSERT_TRUE(scheduler.remove(1));
+    EXPECT_FALSE(inTick.load());
+    int before = started.load();
+    std::this_thread::sleep_for(60ms);
+    EXPECT_EQ(started.load(), before);
+    EXPECT_FALSE(scheduler.contains(1));
+}
+
+TEST(RoomScheduler, IdleWorkersStealOverdueRooms)
+{
+    RoomScheduler scheduler(2);
+    MpscQueue<ReceivedInput> slowInputs;
+    MpscQueue<ReceivedInput> idleInputs;
+    MpscQueue<ReceivedInput> fastInputs;
+    std::atomic<int> fastTicks{0};
+    auto slowTick = [](const RoomScheduler::TickInputs&) { std::this_thread::sleep_for(12ms); };
+    ASSERT_TRUE(scheduler.add(1, slowInputs, slowTick));
+    ASSERT_TRUE(scheduler.add(2, idleInputs, [](const RoomScheduler::TickInputs&) {}));
+    ASSERT_TRUE(scheduler.add(3, fastInputs, [&](const RoomScheduler::TickInputs&) { fastTicks++; }));
+    ASSERT_TRUE(scheduler.start());
+    ASSERT_TRUE(waitFor(fastTicks, 20));
+    scheduler.stop();
+
+    auto slow = scheduler.metrics(1);
+    auto fast = scheduler.metrics(3);
+    ASSERT_TRUE(slow.has_value());
+    ASSERT_TRUE(fast.has_value());
+    EXPECT_GT(slow->stolenTicks + fast->stolenTicks, 0U);
+    EXPECT_LT(fast->meanLateness(), 8ms);
+}
+
+TEST(RoomScheduler, ReportsLatenessWhenThePoolIsOverloaded)
+{
+    RoomScheduler scheduler(1, 1ms);
+    std::array<MpscQueue<ReceivedInput>, 3> inputs;
+    for (std::uint32_t i = 0; i < inputs.size(); ++i) {
+        ASSERT_TRUE(scheduler.add(i, inputs[i],
+                                  [](const RoomScheduler::TickInputs&) { std::this_thread::sleep_for(8ms); }));
+    }
+    ASSERT_TRUE(scheduler.start());
+    std::this_thread::sleep_for(200ms);
+    scheduler.stop();
+
+    auto metrics = scheduler.metrics(0);
+    ASSERT_TRUE(metrics.has_value());
+    EXPECT_GT(metrics->ticks, 0U);
+    EXPECT_GT(metrics->lateTicks, 0U);
+    EXPECT_GT(metrics->overruns, 0U);
+    EXPECT_GE(metrics->maxLateness, metrics->meanLateness());
+    EXPECT_GE(metrics->lastTickDuration, 8ms);
+}
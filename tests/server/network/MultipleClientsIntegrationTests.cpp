@@ -58,7 +58,7 @@ TEST(MultipleClientsIntegration, SendThreadBroadcastsToManyClients)
 
 TEST(MultipleClientsIntegration, ReceiveThreadMaintainsIndependentSequence)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rx(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rx.start());
     auto ep = rx.endpoint();
@@ -15,7 +15,7 @@
 
 using namespace std::chrono_literals;
 
-static bool pollPop(ThreadSafeQueue<ReceivedInput>& q, ReceivedInput& out, int attempts = 200)
+static bool pollPop(MpscQueue<ReceivedInput>& q, ReceivedInput& out, int attempts = 200)
 {
     for (int i = 0; i < attempts; ++i) {
         if (q.tryPop(out))
@@ -54,7 +54,7 @@ static std::string readLogFileFrom(std::streampos startPos)
 
 TEST(InputReceiveThread, EnqueueValidInput)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -91,7 +91,7 @@ TEST(InputReceiveThread, EnqueueValidInput)
 
 TEST(InputReceiveThread, ClientStateStoredOnValidPacket)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -127,7 +127,7 @@ TEST(InputReceiveThread, ClientStateStoredOnValidPacket)
 
 TEST(InputReceiveThread, IgnoreInvalidType)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -150,7 +150,7 @@ TEST(InputReceiveThread, IgnoreInvalidType)
 
 TEST(InputReceiveThread, DropStaleSequence)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -185,7 +185,7 @@ TEST(InputReceiveThread, DropStaleSequence)
 
 TEST(InputReceiveThread, RejectInvalidFlags)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -207,7 +207,7 @@ TEST(InputReceiveThread, RejectInvalidFlags)
 
 TEST(InputReceiveThread, RejectNonFinite)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -229,7 +229,7 @@ TEST(InputReceiveThread, RejectNonFinite)
 
 TEST(InputReceiveThread, RejectWrongSizePacket)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -251,7 +251,7 @@ TEST(InputReceiveThread, RejectWrongSizePacket)
 
 TEST(InputReceiveThread, SeparateSequencePerEndpoint)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -291,7 +291,7 @@ TEST(InputReceiveThread, SeparateSequencePerEndpoint)
 
 TEST(InputReceiveThread, StaleDoesNotUpdateState)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue);
     ASSERT_TRUE(rt.start());
     auto ep = rt.endpoint();
@@ -327,7 +327,7 @@ TEST(InputReceiveThread, StaleDoesNotUpdateState)
 
 TEST(InputReceiveThread, TimeoutEventEmittedAfterSilence)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     ThreadSafeQueue<ClientTimeoutEvent> timeouts;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue, &timeouts, std::chrono::milliseconds(30));
     ASSERT_TRUE(rt.start());
@@ -355,7 +355,7 @@ TEST(InputReceiveThread, TimeoutEventEmittedAfterSilence)
 
 TEST(InputReceiveThread, TimeoutNotEmittedBeforeThreshold)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     ThreadSafeQueue<ClientTimeoutEvent> timeouts;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue, &timeouts, std::chrono::milliseconds(100));
     ASSERT_TRUE(rt.start());
@@ -382,7 +382,7 @@ TEST(InputReceiveThread, TimeoutNotEmittedBeforeThreshold)
 
 TEST(InputReceiveThread, TimeoutNotRepeatedAfterEvent)
 {
-    ThreadSafeQueue<ReceivedInput> queue;
+    MpscQueue<ReceivedInput> queue;
     ThreadSafeQueue<ClientTimeoutEvent> timeouts;
     InputReceiveThread rt(IpEndpoint::v4(127, 0, 0, 1, 0), queue, &timeouts, std::chrono::milliseconds(50));
     ASSERT_TRUE(rt.start());
@@ -0,0 +1,48 @@
+#include "network/SendBufferRing.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(SendBufferRing, BatchCoversBuffersAcquiredSinceBegin)
+{
+    SendBufferRing ring(4);
+    ring.begin();
+    ring.acquire().push_back(1);
+    ring.begin();
+    ring.acquire().push_back(2);
+    ring.acquire().push_back(3);
+
+    auto batch = ring.batch();
+    ASSERT_EQ(batch.size(), 2U);
+    EXPECT_EQ(batch[0].front(), 2);
+    EXPECT_EQ(batch[1].front(), 3);
+}
+
+TEST(SendBufferRing, WrapsKeepingTheCurrentBatchContiguous)
+{
+    SendBufferRing ring(4);
+    ring.begin();
+    ring.acquire();
+    ring.acquire();
+    ring.acquire();
+    ring.begin();
+    ring.acquire().push_back(7);
+    ring.acquire().push_back(8);
+
+    auto batch = ring.batch();
+    ASSERT_EQ(batch.size(), 2U);
+    EXPECT_EQ(batch[0].front(), 7);
+    EXPECT_EQ(batch[1].front(), 8);
+    EXPECT_EQ(ring.slots(), 4U);
+}
+
+TEST(SendBufferRing, GrowsWhenOneBatchNeedsEverySlot)
+{
+    SendBufferRing ring(2);
+    ring.begin();
+    for (std::uint8_t i = 0; i < 3; ++i)
+        ring.acquire().push_back(i);
+
+    EXPECT_EQ(ring.slots(), 3U);
+    EXPECT_EQ(ring.batch().size(), 3U);
+    EXPECT_GE(ring.batch()[2].capacity(), SendBufferRing::kBufferCapacity);
+}
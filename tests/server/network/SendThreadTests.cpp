@@ -130,3 +130,47 @@ TEST(SendThread, HandlesClientListUpdates)
 
     st.stop();
 }
+
+TEST(SendThread, FlushSendsQueuedPacketsInOrder)
+{
+    UdpSocket c;
+    ASSERT_TRUE(c.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto ep = c.localEndpoint();
+
+    SendThread st(IpEndpoint::v4(127, 0, 0, 1, 0), {ep}, 1.0);
+    ASSERT_TRUE(st.start());
+
+    for (std::uint8_t i = 0; i < 5; ++i) {
+        std::vector<std::uint8_t> payload{i, static_cast<std::uint8_t>(i * 2)};
+        st.sendTo(payload, ep);
+    }
+    st.flush();
+
+    std::array<std::uint8_t, 512> buf{};
+    std::size_t size = 0;
+    for (std::uint8_t i = 0; i < 5; ++i) {
+        ASSERT_TRUE(pollRecv(c, buf, size));
+        ASSERT_EQ(size, 2U);
+        EXPECT_EQ(buf[0], i);
+    }
+
+    st.stop();
+}
+
+TEST(SendThread, StopDrainsQueuedPackets)
+{
+    UdpSocket c;
+    ASSERT_TRUE(c.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto ep = c.localEndpoint();
+
+    SendThread st(IpEndpoint::v4(127, 0, 0, 1, 0), {ep}, 1.0);
+    ASSERT_TRUE(st.start());
+    std::vector<std::uint8_t> payload{42};
+    st.sendTo(payload, ep);
+    st.stop();
+
+    std::array<std::uint8_t, 512> buf{};
+    std::size_t size = 0;
+    ASSERT_TRUE(pollRecv(c, buf, size));
+    EXPECT_EQ(buf[0], 42);
+}
@@ -0,0 +1,184 @@
+#include "network/InputReceiveThread.hpp"
+#include "network/SendThread.hpp"
+#include "network/SharedGamePort.hpp"
+
+#include <array>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    std::vector<std::uint8_t> buildTagged(MessageType type, std::uint32_t roomId)
+    {
+        PacketHeader hdr{};
+        hdr.packetType  = static_cast<std::uint8_t>(PacketType::ClientToServer);
+        hdr.messageType = static_cast<std::uint8_t>(type);
+        hdr.tickId      = roomId;
+        auto encoded    = hdr.encode();
+        std::vector<std::uint8_t> out(encoded.begin(), encoded.end());
+        auto crc = PacketHeader::crc32(out.data(), out.size());
+        out.push_back(static_cast<std::uint8_t>((crc >> 24) & 0xFF));
+        out.push_back(static_cast<std::uint8_t>((crc >> 16) & 0xFF));
+        out.push_back(static_cast<std::uint8_t>((crc >> 8) & 0xFF));
+        out.push_back(static_cast<std::uint8_t>(crc & 0xFF));
+        return out;
+    }
+
+    template <typename T> bool pollPop(MpscQueue<T>& q, T& out, int attempts = 200)
+    {
+        for (int i = 0; i < attempts; ++i) {
+            if (q.tryPop(out))
+                return true;
+            std::this_thread::sleep_for(1ms);
+        }
+        return false;
+    }
+
+    struct Room
+    {
+        MpscQueue<ReceivedInput> inputs;
+        MpscQueue<ControlEvent> control;
+        InputReceiveThread receiver{IpEndpoint::v4(127, 0, 0, 1, 0), inputs, control};
+    };
+} // namespace
+
+TEST(SharedGamePort, HelloWithRoomTokenReachesThatRoom)
+{
+    SharedGamePort port(IpEndpoint::v4(127, 0, 0, 1, 0));
+    ASSERT_TRUE(port.start());
+    Room first;
+    Room second;
+    ASSERT_TRUE(first.receiver.start(port, 1));
+    ASSERT_TRUE(second.receiver.start(port, 2));
+    EXPECT_EQ(port.roomCount(), 2U);
+
+    UdpSocket client;
+    ASSERT_TRUE(client.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto hello = buildTagged(MessageType::ClientHello, 2);
+    ASSERT_TRUE(client.sendTo(hello.data(), hello.size(), port.endpoint()).ok());
+
+    ControlEvent got{};
+    ASSERT_TRUE(pollPop(second.control, got));
+    EXPECT_EQ(got.header.messageType, static_cast<std::uint8_t>(MessageType::ClientHello));
+    EXPECT_FALSE(first.control.tryPop(got));
+    EXPECT_EQ(port.roomOf(client.localEndpoint()), 2U);
+
+    first.receiver.stop();
+    second.receiver.stop();
+    port.stop();
+}
+
+TEST(SharedGamePort, BoundEndpointInputRoutesToItsRoom)
+{
+    SharedGamePort port(IpEndpoint::v4(127, 0, 0, 1, 0));
+    ASSERT_TRUE(port.start());
+    Room first;
+    Room second;
+    ASSERT_TRUE(first.receiver.start(port, 1));
+    ASSERT_TRUE(second.receiver.start(port, 2));
+
+    UdpSocket client;
+    ASSERT_TRUE(client.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto join = buildTagged(MessageType::ClientJoinRequest, 1);
+    ASSERT_TRUE(client.sendTo(join.data(), join.size(), port.endpoint()).ok());
+    ControlEvent ctrl{};
+    ASSERT_TRUE(pollPop(first.control, ctrl));
+
+    InputPacket p{};
+    p.header.sequenceId = 1;
+    p.header.tickId     = 99;
+    p.playerId          = 3;
+    auto buf            = p.encode();
+    ASSERT_TRUE(client.sendTo(buf.data(), buf.size(), port.endpoint()).ok());
+
+    ReceivedInput got{};
+    ASSERT_TRUE(pollPop(first.inputs, got));
+    EXPECT_EQ(got.input.playerId, 3U);
+    EXPECT_FALSE(second.inputs.tryPop(got));
+
+    first.receiver.stop();
+    second.receiver.stop();
+    port.stop();
+}
+
+TEST(SharedGamePort, UnboundEndpointsAndUnknownRoomsAreDropped)
+{
+    SharedGamePort port(IpEndpoint::v4(127, 0, 0, 1, 0));
+    ASSERT_TRUE(port.start());
+    Room room;
+    ASSERT_TRUE(room.receiver.start(port, 1));
+
+    UdpSocket client;
+    ASSERT_TRUE(client.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto hello = buildTagged(MessageType::ClientHello, 9);
+    ASSERT_TRUE(client.sendTo(hello.data(), hello.size(), port.endpoint()).ok());
+    InputPacket p{};
+    p.header.sequenceId = 1;
+    auto buf            = p.encode();
+    ASSERT_TRUE(client.sendTo(buf.data(), buf.size(), port.endpoint()).ok());
+
+    ControlEvent ctrl{};
+    ReceivedInput input{};
+    EXPECT_FALSE(pollPop(room.control, ctrl, 50));
+    EXPECT_FALSE(room.inputs.tryPop(input));
+    EXPECT_FALSE(port.roomOf(client.localEndpoint()).has_value());
+
+    room.receiver.stop();
+    port.stop();
+}
+
+TEST(SharedGamePort, DetachForgetsTheRoomsClients)
+{
+    SharedGamePort port(IpEndpoint::v4(127, 0, 0, 1, 0));
+    ASSERT_TRUE(port.start());
+    Room room;
+    ASSERT_TRUE(room.receiver.start(port, 4));
+
+    UdpSocket client;
+    ASSERT_TRUE(client.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    auto hello = buildTagged(MessageType::ClientHello, 4);
+    ASSERT_TRUE(client.sendTo(hello.data(), hello.size(), port.endpoint()).ok());
+    ControlEvent ctrl{};
+    ASSERT_TRUE(pollPop(room.control, ctrl));
+
+    room.receiver.stop();
+    EXPECT_EQ(port.roomCount(), 0U);
+    EXPECT_FALSE(port.roomOf(client.localEndpoint()).has_value());
+    port.stop();
+}
+
+TEST(SharedGamePort, RoomSendThreadSendsFromTheSharedPort)
+{
+    SharedGamePort port(IpEndpoint::v4(127, 0, 0, 1, 0));
+    ASSERT_TRUE(port.start());
+
+    UdpSocket client;
+    ASSERT_TRUE(client.open(IpEndpoint::v4(127, 0, 0, 1, 0)));
+    SendThread st(IpEndpoint::v4(127, 0, 0, 1, 0), {client.localEndpoint()}, 1.0, 1);
+    ASSERT_TRUE(st.start(port));
+    EXPECT_EQ(st.endpoint().port, port.endpoint().port);
+
+    std::vector<std::uint8_t> payload{7, 8};
+    st.sendTo(payload, client.localEndpoint());
+    st.flush();
+
+    std::array<std::uint8_t, 64> buf{};
+    IpEndpoint src{};
+    bool received = false;
+    for (int i = 0; i < 200 && !received; ++i) {
+        auto r = client.recvFrom(buf.data(), buf.size(), src);
+        received = r.ok();
+        if (!received)
+            std::this_thread::sleep_for(1ms);
+    }
+    ASSERT_TRUE(received);
+    EXPECT_EQ(buf[0], 7);
+    EXPECT_EQ(src.port, port.endpoint().port);
+
+    st.stop();
+    port.stop();
+}
@@ -0,0 +1,119 @@
+#include "components/Components.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/CaptureFrame.hpp"
+#include "rollback/RollbackManager.hpp"
+#include "rollback/StateChecksum.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace
+{
+    EntityId spawn(Registry& registry, EntityTag tag, float x, float y)
+    {
+        EntityId id = registry.createEntity();
+        registry.emplace<TransformComponent>(id, TransformComponent::create(x, y));
+        registry.emplace<TagComponent>(id, TagComponent::create(tag));
+        return id;
+    }
+} // namespace
+
+TEST(CaptureFrame, CapturesTransformEntitiesInIdOrder)
+{
+    Registry registry;
+    EntityId a = spawn(registry, EntityTag::Enemy, 1.0F, 2.0F);
+    EntityId b = spawn(registry, EntityTag::Projectile, 3.0F, 4.0F);
+    EntityId c = spawn(registry, EntityTag::Enemy, 5.0F, 6.0F);
+    registry.createEntity();
+    registry.destroyEntity(b);
+
+    CaptureFrame frame;
+    captureFrame(registry, 42, frame);
+
+    EXPECT_EQ(frame.tick, 42U);
+    ASSERT_EQ(frame.size(), 2U);
+    EXPECT_TRUE(std::is_sorted(frame.ids.begin(), frame.ids.end()));
+    EXPECT_EQ(frame.indexOf(a), 0);
+    EXPECT_EQ(frame.indexOf(c), 1);
+    EXPECT_EQ(frame.indexOf(b), -1);
+    EXPECT_FLOAT_EQ(frame.states[1].posX, 5.0F);
+    EXPECT_FLOAT_EQ(frame.states[1].posY, 6.0F);
+}
+
+TEST(CaptureFrame, FillsEveryColumnFromOnePass)
+{
+    Registry registry;
+    EntityId player = spawn(registry, EntityTag::Player, 10.0F, 20.0F);
+    registry.emplace<VelocityComponent>(player, VelocityComponent::create(1.0F, -1.0F));
+    registry.emplace<HealthComponent>(player, HealthComponent::create(80));
+    registry.emplace<ScoreComponent>(player, ScoreComponent::create(500));
+    EntityId shot = spawn(registry, EntityTag::Projectile, 0.0F, 0.0F);
+
+    CaptureFrame frame;
+    captureFrame(registry, 1, frame);
+
+    auto p = static_cast<std::size_t>(frame.indexOf(player));
+    auto s = static_cast<std::size_t>(frame.indexOf(shot));
+    EXPECT_EQ(frame.generations[p], registry.handle(player).generation);
+    EXPECT_EQ(frame.priorities[p], ReplicationPriority::Player);
+    EXPECT_EQ(frame.priorities[s], ReplicationPriority::Projectile);
+    EXPECT_TRUE(frame.fields[p] & SnapshotCodec::kFieldScore);
+    EXPECT_TRUE(frame.fields[p] & SnapshotCodec::kFieldHealth);
+    EXPECT_FALSE(frame.fields[s] & SnapshotCodec::kFieldVelX);
+    EXPECT_EQ(frame.states[p].health, 80);
+    EXPECT_EQ(frame.states[p].score, 500);
+    EXPECT_FLOAT_EQ(frame.states[p].velY, -1.0F);
+}
+
+TEST(CaptureFrame, ReusesColumnsAcrossCaptures)
+{
+    Registry registry;
+    EntityId id = spawn(registry, EntityTag::Enemy, 1.0F, 1.0F);
+    CaptureFrame frame;
+    captureFrame(registry, 1, frame);
+    registry.destroyEntity(id);
+    captureFrame(registry, 2, frame);
+
+    EXPECT_EQ(frame.size(), 0U);
+    EXPECT_TRUE(frame.states.empty());
+    EXPECT_TRUE(frame.priorities.empty());
+}
+
+TEST(CaptureFrame, FeedsChecksumAndRollbackFromTheSameCapture)
+{
+    Registry registry;
+    EntityId id = spawn(registry, EntityTag::Enemy, 7.0F, 8.0F);
+    CaptureFrame frame;
+    captureFrame(registry, 5, frame);
+
+    RollbackManager rollback;
+    std::uint32_t checksum = rollback.captureState(frame);
+    EXPECT_EQ(checksum, StateChecksum::compute(frame));
+    EXPECT_EQ(rollback.getChecksum(5), checksum);
+    EXPECT_EQ(rollback.captureState(6, registry), checksum);
+
+    registry.get<TransformComponent>(id).x = 99.0F;
+    ASSERT_TRUE(rollback.rollbackTo(5, registry));
+    EXPECT_FLOAT_EQ(registry.get<TransformComponent>(id).x, 7.0F);
+}
+
+TEST(CaptureFrame, IncrementalChecksumMatchesAFullRecompute)
+{
+    Registry registry;
+    EntityId moving = spawn(registry, EntityTag::Enemy, 1.0F, 1.0F);
+    EntityId doomed = spawn(registry, EntityTag::Projectile, 2.0F, 2.0F);
+    spawn(registry, EntityTag::Enemy, 3.0F, 3.0F);
+    RollbackManager rollback;
+    CaptureFrame frame;
+
+    captureFrame(registry, 1, frame);
+    rollback.captureState(frame);
+
+    registry.get<TransformComponent>(moving).x = 50.0F;
+    registry.destroyEntity(doomed);
+    spawn(registry, EntityTag::Player, 4.0F, 4.0F);
+    captureFrame(registry, 2, frame);
+
+    EXPECT_EQ(rollback.captureState(frame), StateChecksum::compute(frame));
+}
@@ -0,0 +1,363 @@
+#include "components/Components.hpp"
+#include "network/NetworkCompression.hpp"
+#include "network/SnapshotCodec.hpp"
+#include "replication/ReplicationManager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <optional>
+#include <span>
+
+namespace
+{
+    EntityId spawnEnemy(Registry& registry, float x, float y)
+    {
+        EntityId id = registry.createEntity();
+        registry.emplace<TransformComponent>(id, TransformComponent::create(x, y));
+        registry.emplace<VelocityComponent>(id, VelocityComponent::create(0.0F, 0.0F));
+        registry.emplace<RenderTypeComponent>(id, RenderTypeComponent::create(2));
+        return id;
+    }
+
+    struct DecodedSnapshot
+    {
+        std::optional<std::uint32_t> baselineTick;
+        std::vector<SnapshotCodec::EntityHeader> entities;
+        std::vector<SnapshotCodec::EntityFields> fields;
+    };
+
+    DecodedSnapshot decode(const std::vector<std::uint8_t>& packet, const SnapshotCodec::EntityFields& base = {})
+    {
+        DecodedSnapshot out;
+        auto header = PacketHeader::decode(packet.data(), packet.size());
+        std::vector<std::uint8_t> payload(packet.begin() + PacketHeader::kSize,
+                                          packet.begin() + PacketHeader::kSize + header->payloadSize);
+        if (header->isCompressed)
+            payload = Compression::decompress(payload.data(), payload.size(), header->originalSize);
+
+        std::uint16_t count = static_cast<std::uint16_t>((payload[0] << 8) | payload[1]);
+        BitReader reader(payload.data() + 2, payload.size() - 2);
+        EXPECT_TRUE(SnapshotCodec::readBaseline(reader, header->tickId, out.baselineTick));
+        std::uint32_t nextId = 0;
+        for (std::uint16_t i = 0; i < count; ++i) {
+            SnapshotCodec::EntityHeader entity{};
+            SnapshotCodec::EntityFields fields{};
+            EXPECT_TRUE(SnapshotCodec::readEntityHeader(reader, nextId, out.baselineTick.has_value(), entity));
+            EXPECT_TRUE(SnapshotCodec::readEntityFields(reader, entity, &base, fields));
+            out.entities.push_back(entity);
+            out.fields.push_back(fields);
+        }
+        return out;
+    }
+
+    std::uint16_t firstEntityMask(std::span<const std::vector<std::uint8_t>> packets)
+    {
+        return decode(packets.front()).entities.at(0).mask;
+    }
+
+    EntityId spawnTagged(Registry& registry, float x, float y, EntityTag tag)
+    {
+        EntityId id = registry.createEntity();
+        registry.emplace<TransformComponent>(id, TransformComponent::create(x, y));
+        registry.emplace<TagComponent>(id, TagComponent::create(tag));
+        return id;
+    }
+
+    std::vector<EntityId> sentIds(std::span<const std::vector<std::uint8_t>> packets)
+    {
+        std::vector<EntityId> ids;
+        for (const auto& packet : packets) {
+            for (const auto& entity : decode(packet).entities)
+                ids.push_back(entity.id);
+        }
+        return ids;
+    }
+
+    constexpr std::uint16_t kFullEnemyMask = (1 << 0) | (1 << 1) | (1 << 2) | (1 << 3) | (1 << 4);
+    constexpr std::size_t kTaggedEntityBits = 5 + SnapshotCodec::kMaskBits + 8 + 16 + 16;
+
+    std::size_t budgetFor(std::size_t entities)
+    {
+        return 2 + (1 + entities * kTaggedEntityBits + 7) / 8;
+    }
+} // namespace
+
+TEST(ReplicationManager, SendsFullStateUntilClientAcknowledges)
+{
+    Registry registry;
+    spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    auto first = manager.synchronize("a");
+    ASSERT_EQ(first.packets.size(), 1U);
+    EXPECT_TRUE(first.wasFull);
+    EXPECT_EQ(firstEntityMask(first.packets), kFullEnemyMask);
+
+    manager.capture(registry, 2);
+    auto second = manager.synchronize("a");
+    ASSERT_EQ(second.packets.size(), 1U);
+    EXPECT_EQ(firstEntityMask(second.packets), kFullEnemyMask);
+}
+
+TEST(ReplicationManager, AcknowledgedClientOnlyReceivesChanges)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    ASSERT_TRUE(manager.acknowledge("a", 1));
+
+    manager.capture(registry, 2);
+    auto idle = manager.synchronize("a");
+    EXPECT_TRUE(idle.packets.empty());
+    EXPECT_FALSE(idle.wasFull);
+
+    registry.get<TransformComponent>(id).x = 30.0F;
+    manager.capture(registry, 3);
+    auto moved = manager.synchronize("a");
+    ASSERT_EQ(moved.packets.size(), 1U);
+    EXPECT_EQ(firstEntityMask(moved.packets), 1 << 1);
+}
+
+TEST(ReplicationManager, ResendsUnacknowledgedFieldsAfterLoss)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    manager.acknowledge("a", 1);
+
+    registry.get<TransformComponent>(id).x = 30.0F;
+    manager.capture(registry, 2);
+    manager.synchronize("a");
+
+    registry.get<TransformComponent>(id).x = 10.0F;
+    manager.capture(registry, 3);
+    auto back = manager.synchronize("a");
+    ASSERT_EQ(back.packets.size(), 1U);
+    EXPECT_EQ(firstEntityMask(back.packets), 1 << 1);
+
+    ASSERT_TRUE(manager.acknowledge("a", 3));
+    manager.capture(registry, 4);
+    EXPECT_TRUE(manager.synchronize("a").packets.empty());
+}
+
+TEST(ReplicationManager, ClientsKeepIndependentBaselines)
+{
+    Registry registry;
+    spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    manager.synchronize("b");
+    manager.acknowledge("a", 1);
+
+    manager.capture(registry, 2);
+    EXPECT_TRUE(manager.synchronize("a").packets.empty());
+    auto lossy = manager.synchronize("b");
+    ASSERT_EQ(lossy.packets.size(), 1U);
+    EXPECT_EQ(firstEntityMask(lossy.packets), kFullEnemyMask);
+}
+
+TEST(ReplicationManager, IgnoresStaleAndUnknownAcknowledgements)
+{
+    Registry registry;
+    spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    EXPECT_FALSE(manager.acknowledge("a", 1));
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    manager.capture(registry, 2);
+    manager.synchronize("a");
+
+    EXPECT_FALSE(manager.acknowledge("a", 5));
+    EXPECT_TRUE(manager.acknowledge("a", 2));
+    EXPECT_FALSE(manager.acknowledge("a", 1));
+    EXPECT_EQ(manager.baseline("a")->ackedTick(), 2U);
+    EXPECT_EQ(manager.baseline("a")->pendingFrames(), 0U);
+}
+
+TEST(ReplicationManager, RecycledEntityIsSentInFull)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    manager.acknowledge("a", 1);
+
+    registry.destroyEntity(id);
+    EntityId recycled = spawnEnemy(registry, 10.0F, 20.0F);
+    ASSERT_EQ(recycled, id);
+
+    manager.capture(registry, 2);
+    auto result = manager.synchronize("a");
+    ASSERT_EQ(result.packets.size(), 1U);
+    EXPECT_EQ(firstEntityMask(result.packets), kFullEnemyMask);
+}
+
+TEST(ReplicationManager, DropsBaselineWhenClientStopsAcknowledging)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    manager.acknowledge("a", 1);
+
+    for (std::uint32_t tick = 2; tick < 2 + ClientBaseline::kMaxPendingFrames + 1; ++tick) {
+        registry.get<TransformComponent>(id).x = static_cast<float>(tick);
+        manager.capture(registry, tick);
+        manager.synchronize("a");
+    }
+    EXPECT_FALSE(manager.baseline("a")->acknowledged());
+    EXPECT_EQ(manager.baseline("a")->pendingFrames(), 1U);
+}
+
+TEST(ReplicationManager, SkipsEntitiesOutsideCameraMargin)
+{
+    Registry registry;
+    EntityId player = spawnTagged(registry, 5000.0F, 100.0F, EntityTag::Player);
+    spawnTagged(registry, 5000.0F, 100.0F, EntityTag::Enemy);
+    EntityId ahead = spawnTagged(registry, 1400.0F, 100.0F, EntityTag::Enemy);
+    ReplicationManager manager;
+
+    RelevancyContext context;
+    context.margin = 200.0F;
+    manager.capture(registry, 1, context);
+    EXPECT_EQ(manager.replicatedCount(), 2U);
+
+    auto result = manager.synchronize("a");
+    EXPECT_EQ(sentIds(result.packets), (std::vector<EntityId>{player, ahead}));
+}
+
+TEST(ReplicationManager, SendsBossesBeforeEnemiesAndProjectiles)
+{
+    Registry registry;
+    spawnTagged(registry, 10.0F, 10.0F, EntityTag::Projectile);
+    spawnTagged(registry, 20.0F, 10.0F, EntityTag::Enemy);
+    EntityId boss = spawnTagged(registry, 30.0F, 10.0F, EntityTag::Enemy);
+    EntityId ship = spawnTagged(registry, 40.0F, 10.0F, EntityTag::Player);
+    ReplicationManager manager;
+    manager.setByteBudget(budgetFor(2));
+
+    RelevancyContext context;
+    context.bosses.push_back(registry.handle(boss));
+    manager.capture(registry, 1, context);
+
+    auto result = manager.synchronize("a");
+    EXPECT_EQ(sentIds(result.packets), (std::vector<EntityId>{boss, ship}));
+    EXPECT_EQ(result.deferred, 2U);
+}
+
+TEST(ReplicationManager, RotatesDeferredEntitiesAcrossTicksWithinBudget)
+{
+    Registry registry;
+    EntityId ship = spawnTagged(registry, 10.0F, 10.0F, EntityTag::Player);
+    std::vector<EntityId> shots;
+    for (int i = 0; i < 6; ++i)
+        shots.push_back(spawnTagged(registry, 20.0F + static_cast<float>(i), 10.0F, EntityTag::Projectile));
+    ReplicationManager manager;
+    manager.setByteBudget(budgetFor(3));
+
+    std::vector<EntityId> seen;
+    for (std::uint32_t tick = 1; tick <= 3; ++tick) {
+        manager.capture(registry, tick);
+        auto result = manager.synchronize("a");
+        ASSERT_EQ(result.packets.size(), 1U);
+        auto ids = sentIds(result.packets);
+        ASSERT_EQ(ids.size(), 3U);
+        EXPECT_NE(std::find(ids.begin(), ids.end(), ship), ids.end());
+        EXPECT_EQ(result.deferred, 4U);
+        std::copy_if(ids.begin(), ids.end(), std::back_inserter(seen), [ship](EntityId id) { return id != ship; });
+    }
+    std::sort(seen.begin(), seen.end());
+    EXPECT_EQ(seen, shots);
+}
+
+TEST(ReplicationManager, EncodesMovementAsDeltaAgainstAcknowledgedTick)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    manager.capture(registry, 1);
+    auto full = manager.synchronize("a");
+    ASSERT_TRUE(manager.acknowledge("a", 1));
+
+    registry.get<TransformComponent>(id).x = 10.5F;
+    manager.capture(registry, 2);
+    auto moved = manager.synchronize("a");
+    ASSERT_EQ(moved.packets.size(), 1U);
+    EXPECT_LT(moved.packets[0].size(), full.packets[0].size());
+
+    SnapshotCodec::EntityFields base{};
+    base.posX    = 100;
+    base.posY    = 200;
+    auto decoded = decode(moved.packets[0], base);
+    ASSERT_EQ(decoded.baselineTick, std::optional<std::uint32_t>(1));
+    ASSERT_EQ(decoded.entities.size(), 1U);
+    EXPECT_TRUE(decoded.entities[0].delta);
+    EXPECT_EQ(decoded.entities[0].mask, SnapshotCodec::kFieldPosX);
+    EXPECT_EQ(decoded.fields[0].posX, 105);
+    EXPECT_EQ(decoded.fields[0].posY, 200);
+}
+
+TEST(ReplicationManager, ResendsFieldsCarriedPastAnAcknowledgedFrame)
+{
+    Registry registry;
+    EntityId enemy = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+    manager.setByteBudget(3);
+
+    manager.capture(registry, 1);
+    manager.synchronize("a");
+    ASSERT_TRUE(manager.acknowledge("a", 1));
+
+    registry.get<TransformComponent>(enemy).x = 30.0F;
+    manager.capture(registry, 2);
+    manager.synchronize("a");
+
+    registry.get<TransformComponent>(enemy).x = 10.0F;
+    EntityId ship = spawnTagged(registry, 40.0F, 10.0F, EntityTag::Player);
+    manager.capture(registry, 3);
+    auto crowded = manager.synchronize("a");
+    EXPECT_EQ(sentIds(crowded.packets), (std::vector<EntityId>{ship}));
+    EXPECT_EQ(crowded.deferred, 1U);
+    ASSERT_TRUE(manager.acknowledge("a", 3));
+
+    manager.capture(registry, 4);
+    auto resent = manager.synchronize("a");
+    EXPECT_EQ(sentIds(resent.packets), (std::vector<EntityId>{enemy}));
+    EXPECT_EQ(firstEntityMask(resent.packets), SnapshotCodec::kFieldPosX);
+}
+
+TEST(ReplicationManager, ReusesSendBuffersAcrossTicks)
+{
+    Registry registry;
+    EntityId id = spawnEnemy(registry, 10.0F, 20.0F);
+    ReplicationManager manager;
+
+    std::vector<const std::uint8_t*> buffers;
+    for (std::uint32_t tick = 1; tick <= 3 * SendBufferRing::kDefaultSlots; ++tick) {
+        registry.get<TransformComponent>(id).x += 1.0F;
+        manager.capture(registry, tick);
+        auto result = manager.synchronize("a");
+        ASSERT_EQ(result.packets.size(), 1U);
+        buffers.push_back(result.packets[0].data());
+        ASSERT_TRUE(manager.acknowledge("a", tick));
+    }
+    std::sort(buffers.begin(), buffers.end());
+    buffers.erase(std::unique(buffers.begin(), buffers.end()), buffers.end());
+    EXPECT_EQ(buffers.size(), SendBufferRing::kDefaultSlots);
+}
@@ -0,0 +1,95 @@
+#include "systems/CollisionKernels.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Packed
+    {
+        std::vector<float> minX;
+        std::vector<float> maxX;
+        std::vector<float> minY;
+        std::vector<float> maxY;
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> radius;
+
+        CollisionBatch batch() const
+        {
+            return CollisionBatch{minX.data(),    maxX.data(),    minY.data(),  maxY.data(),
+                                  centerX.data(), centerY.data(), radius.data()};
+        }
+    };
+
+    Packed randomPacked(std::size_t count, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> pos(-100.0F, 100.0F);
+        std::uniform_real_distribution<float> size(0.0F, 30.0F);
+        Packed p;
+        for (std::size_t i = 0; i < count; ++i) {
+            float x = pos(rng);
+            float y = pos(rng);
+            float r = size(rng);
+            p.minX.push_back(x);
+            p.maxX.push_back(x + size(rng));
+            p.minY.push_back(y);
+            p.maxY.push_back(y + size(rng));
+            p.centerX.push_back(x);
+            p.centerY.push_back(y);
+            p.radius.push_back(r);
+        }
+        return p;
+    }
+} // namespace
+
+TEST(CollisionKernels, AabbMatchesScalar)
+{
+    const Packed p   = randomPacked(67, 3);
+    CollisionBatch b = p.batch();
+    for (std::size_t begin = 0; begin < 20; ++begin) {
+        std::array<float, 4> box{p.minX[begin], p.maxX[begin], p.minY[begin], p.maxY[begin]};
+        std::vector<std::uint8_t> simd(67);
+        std::vector<std::uint8_t> scalar(67);
+        CollisionKernels::overlapAabb(b, begin, 67, box, simd.data());
+        CollisionKernels::overlapAabbScalar(b, begin, 67, box, scalar.data());
+        EXPECT_EQ(simd, scalar);
+    }
+}
+
+TEST(CollisionKernels, CircleMatchesScalar)
+{
+    const Packed p   = randomPacked(67, 5);
+    CollisionBatch b = p.batch();
+    for (std::size_t begin = 0; begin < 20; ++begin) {
+        std::vector<std::uint8_t> simd(67);
+        std::vector<std::uint8_t> scalar(67);
+        CollisionKernels::overlapCircle(b, begin, 67, p.centerX[begin], p.centerY[begin], p.radius[begin],
+                                        simd.data());
+        CollisionKernels::overlapCircleScalar(b, begin, 67, p.centerX[begin], p.centerY[begin], p.radius[begin],
+                                              scalar.data());
+        EXPECT_EQ(simd, scalar);
+    }
+}
+
+TEST(CollisionKernels, TouchingEdgesOverlap)
+{
+    std::vector<float> minX{2.0F, 2.5F};
+    std::vector<float> maxX{4.0F, 4.0F};
+    std::vector<float> minY{0.0F, 3.0F};
+    std::vector<float> maxY{2.0F, 5.0F};
+    std::vector<float> centerX{3.0F, 10.0F};
+    std::vector<float> centerY{0.0F, 0.0F};
+    std::vector<float> radius{1.0F, 1.0F};
+    CollisionBatch b{minX.data(), maxX.data(), minY.data(), maxY.data(), centerX.data(), centerY.data(), radius.data()};
+
+    std::uint8_t hits[2]{};
+    CollisionKernels::overlapAabb(b, 0, 2, {0.0F, 2.0F, 0.0F, 2.0F}, hits);
+    EXPECT_EQ(hits[0], 1);
+    EXPECT_EQ(hits[1], 0);
+    CollisionKernels::overlapCircle(b, 0, 2, 0.0F, 0.0F, 2.0F, hits);
+    EXPECT_EQ(hits[0], 1);
+    EXPECT_EQ(hits[1], 0);
+}
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 #include <limits>
+#include <random>
 
 static bool containsPair(const std::vector<Collision>& collisions, EntityId a, EntityId b)
 {
@@ -189,3 +190,243 @@ TEST(CollisionSystem, PolygonSeparatesCorrectly)
     col                                       = sys.detect(registry);
     EXPECT_TRUE(containsPair(col, poly1, poly2));
 }
+
+TEST(CollisionSystem, DetectsOverlapOutsideGridBounds)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    registry.emplace<TransformComponent>(a, TransformComponent::create(-5000.0F, 9000.0F));
+    registry.emplace<TransformComponent>(b, TransformComponent::create(-4999.0F, 9000.0F));
+    registry.emplace<HitboxComponent>(a, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    registry.emplace<HitboxComponent>(b, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+
+    CollisionSystem sys;
+    auto col = sys.detect(registry);
+    EXPECT_TRUE(containsPair(col, a, b));
+}
+
+TEST(CollisionSystem, GridMatchesSingleCellOnDenseScene)
+{
+    Registry registry;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> posX(-100.0F, 1400.0F);
+    std::uniform_real_distribution<float> posY(-100.0F, 800.0F);
+    std::uniform_real_distribution<float> size(4.0F, 120.0F);
+    std::vector<std::array<float, 2>> tri{{{0.0F, 0.0F}, {30.0F, 0.0F}, {15.0F, 25.0F}}};
+    for (int i = 0; i < 600; ++i) {
+        EntityId e = registry.createEntity();
+        registry.emplace<TransformComponent>(e, TransformComponent::create(posX(rng), posY(rng)));
+        if (i % 3 == 0) {
+            registry.emplace<ColliderComponent>(e, ColliderComponent::circle(size(rng) / 2.0F));
+        } else if (i % 3 == 1) {
+            registry.emplace<ColliderComponent>(e, ColliderComponent::polygon(tri));
+        } else {
+            registry.emplace<HitboxComponent>(e, HitboxComponent::create(size(rng), size(rng), 0.0F, 0.0F, true));
+        }
+    }
+
+    CameraBounds bounds;
+    bounds.maxX = 1246.0F;
+    bounds.maxY = 702.0F;
+    CollisionSystem grid;
+    grid.setBounds(bounds, 32.0F);
+    CollisionSystem single;
+    single.setBounds(bounds, 1.0e6F);
+
+    auto expected = single.detect(registry);
+    auto actual   = grid.detect(registry);
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_FALSE(expected.empty());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].a, expected[i].a);
+        EXPECT_EQ(actual[i].b, expected[i].b);
+    }
+}
+
+TEST(CollisionSystem, SkipsPairsWithIncompatibleTags)
+{
+    Registry registry;
+    EntityId enemyA = registry.createEntity();
+    EntityId enemyB = registry.createEntity();
+    EntityId player = registry.createEntity();
+    for (EntityId id : {enemyA, enemyB, player}) {
+        registry.emplace<TransformComponent>(id, TransformComponent::create(0.0F, 0.0F));
+        registry.emplace<HitboxComponent>(id, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    }
+    registry.emplace<TagComponent>(enemyA, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(enemyB, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(player, TagComponent::create(EntityTag::Player));
+
+    CollisionSystem sys;
+    auto col = sys.detect(registry);
+    EXPECT_EQ(col.size(), 2u);
+    EXPECT_FALSE(containsPair(col, enemyA, enemyB));
+    EXPECT_TRUE(containsPair(col, enemyA, player));
+    EXPECT_TRUE(containsPair(col, enemyB, player));
+}
+
+TEST(CollisionSystem, ProjectilesSkipTheirOwnTeam)
+{
+    Registry registry;
+    EntityId player      = registry.createEntity();
+    EntityId enemy       = registry.createEntity();
+    EntityId playerShot  = registry.createEntity();
+    EntityId enemyShot   = registry.createEntity();
+    EntityId untaggedHit = registry.createEntity();
+    for (EntityId id : {player, enemy, playerShot, enemyShot, untaggedHit}) {
+        registry.emplace<TransformComponent>(id, TransformComponent::create(0.0F, 0.0F));
+        registry.emplace<HitboxComponent>(id, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    }
+    registry.emplace<TagComponent>(player, TagComponent::create(EntityTag::Player));
+    registry.emplace<TagComponent>(enemy, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(playerShot, TagComponent::create(EntityTag::Projectile));
+    registry.emplace<TagComponent>(enemyShot, TagComponent::create(EntityTag::Projectile));
+    registry.emplace<MissileComponent>(playerShot, MissileComponent{10, 1.0F, true, 1});
+    registry.emplace<MissileComponent>(enemyShot, MissileComponent{10, 1.0F, false, 1});
+
+    CollisionSystem sys;
+    auto col = sys.detect(registry);
+    EXPECT_TRUE(containsPair(col, playerShot, enemy));
+    EXPECT_TRUE(containsPair(col, enemyShot, player));
+    EXPECT_FALSE(containsPair(col, playerShot, player));
+    EXPECT_FALSE(containsPair(col, enemyShot, enemy));
+    EXPECT_FALSE(containsPair(col, playerShot, enemyShot));
+    EXPECT_TRUE(containsPair(col, untaggedHit, playerShot));
+    EXPECT_TRUE(containsPair(col, untaggedHit, enemy));
+}
+
+TEST(CollisionSystem, ExplicitLayerOverridesTags)
+{
+    Registry registry;
+    EntityId decor  = registry.createEntity();
+    EntityId player = registry.createEntity();
+    EntityId enemy  = registry.createEntity();
+    HitboxComponent decorBox = HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true);
+    decorBox.collisionLayer  = CollisionLayer::Obstacle;
+    decorBox.collisionMask   = CollisionLayer::Enemy;
+    registry.emplace<TransformComponent>(decor, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<HitboxComponent>(decor, decorBox);
+    registry.emplace<TagComponent>(decor, TagComponent::create(EntityTag::Obstacle));
+    for (EntityId id : {player, enemy}) {
+        registry.emplace<TransformComponent>(id, TransformComponent::create(0.0F, 0.0F));
+        registry.emplace<HitboxComponent>(id, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    }
+    registry.emplace<TagComponent>(player, TagComponent::create(EntityTag::Player));
+    registry.emplace<TagComponent>(enemy, TagComponent::create(EntityTag::Enemy));
+
+    CollisionSystem sys;
+    auto col = sys.detect(registry);
+    EXPECT_FALSE(containsPair(col, decor, player));
+    EXPECT_FALSE(containsPair(col, decor, enemy));
+    EXPECT_TRUE(containsPair(col, player, enemy));
+
+    registry.get<HitboxComponent>(decor).collisionMask  = CollisionLayer::All;
+    registry.get<HitboxComponent>(decor).collisionLayer = CollisionLayer::Obstacle | CollisionLayer::Enemy;
+    col                                                 = sys.detect(registry);
+    EXPECT_TRUE(containsPair(col, decor, player));
+}
+
+TEST(CollisionSystem, ReusesCachedShapesWhenNothingMoves)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    registry.emplace<TransformComponent>(a, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<TransformComponent>(b, TransformComponent::create(1.0F, 0.0F));
+    registry.emplace<HitboxComponent>(a, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    registry.emplace<HitboxComponent>(b, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+
+    CollisionSystem sys;
+    sys.detect(registry);
+    EXPECT_EQ(sys.stats().shapesRebuilt, 2u);
+    EXPECT_EQ(sys.stats().shapesReused, 0u);
+
+    auto col = sys.detect(registry);
+    EXPECT_TRUE(containsPair(col, a, b));
+    EXPECT_EQ(sys.stats().shapesRebuilt, 2u);
+    EXPECT_EQ(sys.stats().shapesReused, 2u);
+
+    registry.get<TransformComponent>(b).x = 10.0F;
+    col                                   = sys.detect(registry);
+    EXPECT_FALSE(containsPair(col, a, b));
+    EXPECT_EQ(sys.stats().shapesRebuilt, 3u);
+    EXPECT_EQ(sys.stats().shapesReused, 3u);
+}
+
+TEST(CollisionSystem, RebuildsShapeForRecycledEntity)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    registry.emplace<TransformComponent>(a, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<HitboxComponent>(a, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+
+    CollisionSystem sys;
+    sys.detect(registry);
+    registry.destroyEntity(a);
+    EntityId b = registry.createEntity();
+    registry.emplace<TransformComponent>(b, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<HitboxComponent>(b, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    sys.detect(registry);
+    EXPECT_EQ(sys.stats().shapesRebuilt, 2u);
+    EXPECT_EQ(sys.stats().shapesReused, 0u);
+}
+
+TEST(CollisionSystem, SteadyStateDoesNotAllocate)
+{
+    Registry registry;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(0.0F, 600.0F);
+    std::vector<std::pair<EntityId, float>> bases;
+    for (int i = 0; i < 200; ++i) {
+        EntityId id = registry.createEntity();
+        float x     = pos(rng);
+        registry.emplace<TransformComponent>(id, TransformComponent::create(x, pos(rng)));
+        registry.emplace<HitboxComponent>(id, HitboxComponent::create(24.0F, 24.0F, 0.0F, 0.0F, true));
+        bases.emplace_back(id, x);
+    }
+
+    CollisionSystem sys;
+    auto step = [&](int tick) {
+        for (const auto& [id, x] : bases) {
+            registry.get<TransformComponent>(id).x = x + (tick % 2 == 0 ? 0.5F : 0.0F);
+        }
+        sys.detect(registry);
+    };
+    step(0);
+    step(1);
+    const auto warm = sys.stats().allocations;
+    for (int tick = 0; tick < 50; ++tick) {
+        step(tick);
+    }
+    EXPECT_EQ(sys.stats().allocations, warm);
+    EXPECT_GT(sys.stats().shapesRebuilt, 200u * 50u);
+}
+
+TEST(CollisionSystem, BatchesBoxAndCirclePairsAndKeepsSatForPolygons)
+{
+    Registry registry;
+    EntityId boxA    = registry.createEntity();
+    EntityId boxB    = registry.createEntity();
+    EntityId circleA = registry.createEntity();
+    EntityId circleB = registry.createEntity();
+    EntityId poly    = registry.createEntity();
+    registry.emplace<TransformComponent>(boxA, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<TransformComponent>(boxB, TransformComponent::create(1.0F, 1.0F));
+    registry.emplace<HitboxComponent>(boxA, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    registry.emplace<HitboxComponent>(boxB, HitboxComponent::create(2.0F, 2.0F, 0.0F, 0.0F, true));
+    registry.emplace<TransformComponent>(circleA, TransformComponent::create(300.0F, 300.0F));
+    registry.emplace<TransformComponent>(circleB, TransformComponent::create(303.0F, 300.0F));
+    registry.emplace<ColliderComponent>(circleA, ColliderComponent::circle(2.0F));
+    registry.emplace<ColliderComponent>(circleB, ColliderComponent::circle(2.0F));
+    registry.emplace<TransformComponent>(poly, TransformComponent::create(1.0F, 0.0F));
+    registry.emplace<ColliderComponent>(poly, ColliderComponent::polygon({{0.0F, 0.0F}, {2.0F, 0.0F}, {1.0F, 2.0F}}));
+
+    CollisionSystem sys;
+    auto col = sys.detect(registry);
+    EXPECT_TRUE(containsPair(col, boxA, boxB));
+    EXPECT_TRUE(containsPair(col, circleA, circleB));
+    EXPECT_TRUE(containsPair(col, boxA, poly));
+    EXPECT_EQ(sys.stats().batchedPairs, 2u);
+    EXPECT_EQ(sys.stats().satPairs, 2u);
+}
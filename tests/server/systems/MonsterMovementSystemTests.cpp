@@ -4,6 +4,7 @@
 #include <cmath>
 #include <gtest/gtest.h>
 #include <limits>
+#include <map>
 
 TEST(MonsterMovementSystem, LinearSetsHorizontalVelocity)
 {
@@ -14,7 +15,8 @@ TEST(MonsterMovementSystem, LinearSetsHorizontalVelocity)
     registry.emplace<MovementComponent>(m, MovementComponent::linear(5.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.1F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.1F);
 
     auto& v = registry.get<VelocityComponent>(m);
     EXPECT_FLOAT_EQ(v.vx, -5.0F);
@@ -30,12 +32,13 @@ TEST(MonsterMovementSystem, ZigzagAlternatesVerticalVelocity)
     registry.emplace<MovementComponent>(m, MovementComponent::zigzag(2.0F, 3.0F, 1.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.25F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.25F);
     auto& v1 = registry.get<VelocityComponent>(m);
     EXPECT_FLOAT_EQ(v1.vx, -2.0F);
     EXPECT_FLOAT_EQ(v1.vy, 3.0F);
 
-    sys.update(registry, 0.3F);
+    sys.update(registry, players, 0.3F);
     auto& v2 = registry.get<VelocityComponent>(m);
     EXPECT_FLOAT_EQ(v2.vx, -2.0F);
     EXPECT_FLOAT_EQ(v2.vy, -3.0F);
@@ -50,7 +53,8 @@ TEST(MonsterMovementSystem, SineSetsVerticalVelocity)
     registry.emplace<MovementComponent>(m, MovementComponent::sine(1.0F, 2.0F, 1.0F, 0.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.25F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.25F);
     auto& v = registry.get<VelocityComponent>(m);
     EXPECT_NEAR(v.vy, 2.0F * std::sin(3.14159265F * 0.5F), 1e-4);
     EXPECT_FLOAT_EQ(v.vx, -1.0F);
@@ -70,7 +74,8 @@ TEST(MonsterMovementSystem, ZeroFrequencyStopsVertical)
     registry.emplace<MovementComponent>(m2, MovementComponent::sine(2.0F, 3.0F, 0.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 1.0F);
+    PlayerIndex players;
+    sys.update(registry, players, 1.0F);
 
     auto& v1 = registry.get<VelocityComponent>(m1);
     auto& v2 = registry.get<VelocityComponent>(m2);
@@ -88,8 +93,9 @@ TEST(MonsterMovementSystem, DrivesMovementSystemIntegration)
 
     MonsterMovementSystem ai;
     MovementSystem move;
+    PlayerIndex players;
 
-    ai.update(registry, 1.0F);
+    ai.update(registry, players, 1.0F);
     move.update(registry, 0.5F);
 
     auto& t = registry.get<TransformComponent>(m);
@@ -110,7 +116,8 @@ TEST(MonsterMovementSystem, IndependentTimersPerEntity)
     registry.emplace<MovementComponent>(b, MovementComponent::sine(1.0F, 1.0F, 1.0F, 1.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.25F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.25F);
 
     auto& va = registry.get<VelocityComponent>(a);
     auto& vb = registry.get<VelocityComponent>(b);
@@ -126,9 +133,10 @@ TEST(MonsterMovementSystem, SineAccumulatesTime)
     registry.emplace<MovementComponent>(m, MovementComponent::sine(1.0F, 1.0F, 1.0F, 0.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.1F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.1F);
     float vy1 = registry.get<VelocityComponent>(m).vy;
-    sys.update(registry, 0.2F);
+    sys.update(registry, players, 0.2F);
     float vy2 = registry.get<VelocityComponent>(m).vy;
 
     EXPECT_NE(vy1, vy2);
@@ -145,13 +153,14 @@ TEST(MonsterMovementSystem, ZigzagRepeatsPattern)
     registry.emplace<MovementComponent>(m, MovementComponent::zigzag(1.0F, 2.0F, 1.0F));
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.25F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.25F);
     float vy1 = registry.get<VelocityComponent>(m).vy;
-    sys.update(registry, 0.25F);
+    sys.update(registry, players, 0.25F);
     float vy2 = registry.get<VelocityComponent>(m).vy;
-    sys.update(registry, 0.25F);
+    sys.update(registry, players, 0.25F);
     float vy3 = registry.get<VelocityComponent>(m).vy;
-    sys.update(registry, 0.25F);
+    sys.update(registry, players, 0.25F);
     float vy4 = registry.get<VelocityComponent>(m).vy;
 
     EXPECT_NE(vy1, vy2);
@@ -174,7 +183,8 @@ TEST(MonsterMovementSystem, NonFiniteAmplitudeOrFrequencyZeroesVertical)
     registry.emplace<MovementComponent>(m2, mc2);
 
     MonsterMovementSystem sys;
-    sys.update(registry, 0.1F);
+    PlayerIndex players;
+    sys.update(registry, players, 0.1F);
 
     EXPECT_FLOAT_EQ(registry.get<VelocityComponent>(m1).vy, 0.0F);
     EXPECT_FLOAT_EQ(registry.get<VelocityComponent>(m2).vy, 0.0F);
@@ -191,6 +201,33 @@ TEST(MonsterMovementSystem, SkipsDeadEntities)
     registry.destroyEntity(m);
 
     MonsterMovementSystem sys;
-    EXPECT_NO_THROW(sys.update(registry, 1.0F));
+    PlayerIndex players;
+    EXPECT_NO_THROW(sys.update(registry, players, 1.0F));
     EXPECT_FALSE(registry.has<VelocityComponent>(m));
 }
+
+TEST(MonsterMovementSystem, FollowPlayerMovesTowardNearestIndexedPlayer)
+{
+    Registry registry;
+    EntityId m = registry.createEntity();
+    registry.emplace<TransformComponent>(m, TransformComponent::create(100.0F, 100.0F));
+    registry.emplace<VelocityComponent>(m);
+    registry.emplace<MovementComponent>(m, MovementComponent::followPlayer(10.0F));
+
+    std::map<std::uint32_t, EntityId> playerEntities;
+    for (auto [playerId, x] : {std::pair<std::uint32_t, float>{1, 400.0F}, {2, 100.0F}}) {
+        EntityId p = registry.createEntity();
+        registry.emplace<TransformComponent>(p, TransformComponent::create(x, 0.0F));
+        registry.emplace<TagComponent>(p, TagComponent::create(EntityTag::Player));
+        playerEntities[playerId] = p;
+    }
+
+    MonsterMovementSystem sys;
+    PlayerIndex players;
+    players.rebuild(registry, playerEntities);
+    sys.update(registry, players, 0.1F);
+
+    auto& v = registry.get<VelocityComponent>(m);
+    EXPECT_NEAR(v.vx, 0.0F, 1e-5);
+    EXPECT_NEAR(v.vy, -10.0F, 1e-5);
+}
@@ -0,0 +1,85 @@
+#include "systems/PlayerIndex.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    EntityId spawnPlayer(Registry& registry, float x, float y, std::uint32_t ownerId)
+    {
+        EntityId id = registry.createEntity();
+        registry.emplace<TransformComponent>(id, TransformComponent::create(x, y));
+        registry.emplace<TagComponent>(id, TagComponent::create(EntityTag::Player));
+        registry.emplace<OwnershipComponent>(id, OwnershipComponent::create(ownerId, 0));
+        return id;
+    }
+} // namespace
+
+TEST(PlayerIndex, NearestReturnsClosestPlayer)
+{
+    Registry registry;
+    EntityId far  = spawnPlayer(registry, 500.0F, 0.0F, 1);
+    EntityId near = spawnPlayer(registry, 10.0F, 10.0F, 2);
+
+    PlayerIndex index;
+    index.rebuild(registry, {{1, far}, {2, near}});
+    auto target = index.nearest(0.0F, 0.0F);
+    ASSERT_TRUE(target.has_value());
+    EXPECT_EQ(target->id, near);
+    EXPECT_FLOAT_EQ(target->distanceSquared, 200.0F);
+}
+
+TEST(PlayerIndex, EmptyIndexHasNoTarget)
+{
+    PlayerIndex index;
+    EXPECT_TRUE(index.empty());
+    EXPECT_FALSE(index.nearest(0.0F, 0.0F).has_value());
+    EXPECT_FALSE(index.findByOwner(1).has_value());
+}
+
+TEST(PlayerIndex, SkipsDeadAndUntaggedEntities)
+{
+    Registry registry;
+    EntityId alive = spawnPlayer(registry, 0.0F, 0.0F, 1);
+    EntityId dead  = spawnPlayer(registry, 1.0F, 0.0F, 2);
+    EntityId enemy = registry.createEntity();
+    registry.emplace<TransformComponent>(enemy, TransformComponent::create(0.0F, 0.0F));
+    registry.emplace<TagComponent>(enemy, TagComponent::create(EntityTag::Enemy));
+    registry.destroyEntity(dead);
+
+    PlayerIndex index;
+    index.rebuild(registry, {{1, alive}, {2, dead}, {3, enemy}});
+    ASSERT_EQ(index.size(), 1u);
+    EXPECT_EQ(index.ids().front(), alive);
+}
+
+TEST(PlayerIndex, RefreshReadsMovedPositionsAndDropsDeadPlayers)
+{
+    Registry registry;
+    EntityId a = spawnPlayer(registry, 0.0F, 0.0F, 1);
+    EntityId b = spawnPlayer(registry, 100.0F, 0.0F, 2);
+
+    PlayerIndex index;
+    index.rebuild(registry, {{1, a}, {2, b}});
+    registry.get<TransformComponent>(b).x = 1.0F;
+    registry.destroyEntity(a);
+    index.refresh(registry);
+
+    ASSERT_EQ(index.size(), 1u);
+    auto target = index.nearest(0.0F, 0.0F);
+    ASSERT_TRUE(target.has_value());
+    EXPECT_EQ(target->id, b);
+    EXPECT_FLOAT_EQ(target->x, 1.0F);
+}
+
+TEST(PlayerIndex, FindByOwnerMatchesOwnership)
+{
+    Registry registry;
+    EntityId a = spawnPlayer(registry, 0.0F, 0.0F, 7);
+    EntityId b = spawnPlayer(registry, 0.0F, 0.0F, 9);
+
+    PlayerIndex index;
+    index.rebuild(registry, {{1, a}, {2, b}});
+    EXPECT_EQ(index.findByOwner(9), b);
+    EXPECT_EQ(index.findByOwner(7), a);
+    EXPECT_FALSE(index.findByOwner(3).has_value());
+}
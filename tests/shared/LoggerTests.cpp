@@ -0,0 +1,136 @@
+#include "Logger.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    enum class Color : std::uint8_t
+    {
+        Red = 3
+    };
+
+    int evaluations = 0;
+
+    int counted(int value)
+    {
+        ++evaluations;
+        return value;
+    }
+
+    class CapturedLog
+    {
+      public:
+        explicit CapturedLog(const std::string& tag) : tag_(tag)
+        {
+            Logger::instance().flush();
+            Logger::instance().setConsoleOutputEnabled(false);
+            Logger::instance().setVerbose(true);
+            Logger::instance().addTag(tag_);
+            Logger::instance().setPostLogCallback([this](const std::string& line) { lines_.push_back(line); });
+        }
+
+        ~CapturedLog()
+        {
+            Logger::instance().flush();
+            Logger::instance().setPostLogCallback(nullptr);
+            Logger::instance().removeTag(tag_);
+            Logger::instance().setVerbose(false);
+            Logger::instance().setConsoleOutputEnabled(true);
+        }
+
+        const std::vector<std::string>& lines()
+        {
+            Logger::instance().flush();
+            return lines_;
+        }
+
+      private:
+        std::string tag_;
+        std::vector<std::string> lines_;
+    };
+} // namespace
+
+TEST(LogRecord, FormatsArgumentsWithoutStreams)
+{
+    LogRecord record;
+    record.appendValue("tick=");
+    record.appendValue(42);
+    record.appendValue(' ');
+    record.appendValue(1.5F);
+    record.appendValue(' ');
+    record.appendValue(true);
+    record.appendValue(' ');
+    record.appendValue(Color::Red);
+    record.appendValue(std::string(" done"));
+
+    EXPECT_EQ(record.view(), "tick=42 1.5 true 3 done");
+    EXPECT_TRUE(record.overflow.empty());
+}
+
+TEST(LogRecord, SpillsLongMessagesToTheHeap)
+{
+    LogRecord record;
+    const std::string head(LogRecord::kInlineSize - 2, 'a');
+    record.append(head);
+    record.append("bcd");
+
+    EXPECT_EQ(record.view(), head + "bcd");
+    EXPECT_FALSE(record.overflow.empty());
+}
+
+TEST(Logger, DisabledTagSkipsArgumentEvaluation)
+{
+    CapturedLog capture("[LogEnabled]");
+    evaluations = 0;
+
+    LOG_DEBUG("[LogDisabled]", "value=", counted(1));
+    EXPECT_EQ(evaluations, 0);
+
+    LOG_DEBUG("[LogEnabled]", "value=", counted(2));
+    EXPECT_EQ(evaluations, Logger::compiledIn(LogLevel::Debug) ? 1 : 0);
+
+    Logger::instance().setVerbose(false);
+    LOG_DEBUG("[LogEnabled]", "value=", counted(3));
+    EXPECT_EQ(evaluations, Logger::compiledIn(LogLevel::Debug) ? 1 : 0);
+}
+
+TEST(Logger, TraceBelowCompileTimeFloorIsElided)
+{
+    CapturedLog capture("[LogTrace]");
+    evaluations = 0;
+
+    LOG_TRACE("[LogTrace]", "value=", counted(1));
+    EXPECT_EQ(evaluations, RTYPE_LOG_MIN_LEVEL <= 0 ? 1 : 0);
+    EXPECT_EQ(Logger::compiledIn(LogLevel::Trace), RTYPE_LOG_MIN_LEVEL <= 0);
+    EXPECT_TRUE(Logger::compiledIn(LogLevel::Error));
+}
+
+TEST(Logger, WriterThreadDeliversFormattedLines)
+{
+    CapturedLog capture("[LogWriter]");
+
+    LOG_INFO("[LogWriter]", "value=", 42);
+    Logger::instance().info("[LogWriter] legacy");
+
+    const auto& lines = capture.lines();
+    ASSERT_EQ(lines.size(), 2U);
+    EXPECT_NE(lines[0].find("[System][INFO] [LogWriter] value=42\n"), std::string::npos);
+    EXPECT_NE(lines[1].find("[LogWriter] legacy"), std::string::npos);
+}
+
+TEST(Logger, RecordsFromExitedThreadsAreStillWritten)
+{
+    CapturedLog capture("[LogThread]");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([t] { LOG_INFO("[LogThread]", "worker ", t); });
+    for (auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(capture.lines().size(), 4U);
+}
@@ -0,0 +1,116 @@
+#include "concurrency/MpscQueue.hpp"
+#include "concurrency/SpscQueue.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(MpscQueue, RoundsCapacityToPowerOfTwoAndRejectsWhenFull)
+{
+    MpscQueue<int> q(5);
+    EXPECT_EQ(q.capacity(), 8U);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_TRUE(q.push(i));
+    EXPECT_FALSE(q.push(8));
+    EXPECT_EQ(q.dropped(), 1U);
+
+    int value = -1;
+    ASSERT_TRUE(q.tryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(q.push(8));
+}
+
+TEST(MpscQueue, DrainIntoAppendsInOrderAndRespectsMax)
+{
+    MpscQueue<std::string> q(16);
+    for (int i = 0; i < 10; ++i)
+        q.push(std::to_string(i));
+
+    std::vector<std::string> out{"keep"};
+    EXPECT_EQ(q.drainInto(out, 4), 4U);
+    EXPECT_EQ(q.drainInto(out), 6U);
+    ASSERT_EQ(out.size(), 11U);
+    EXPECT_EQ(out[0], "keep");
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(out[static_cast<std::size_t>(i) + 1], std::to_string(i));
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.drainInto(out), 0U);
+}
+
+TEST(MpscQueue, ManyProducersDeliverEveryItemOnce)
+{
+    MpscQueue<int> q(256);
+    constexpr int kProducers = 4;
+    constexpr int kPerThread = 20000;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&q, p] {
+            for (int i = 0; i < kPerThread; ++i) {
+                while (!q.push(p * kPerThread + i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<int> seen;
+    std::vector<int> lastPerProducer(kProducers, -1);
+    bool ordered = true;
+    while (seen.size() < static_cast<std::size_t>(kProducers * kPerThread)) {
+        std::size_t before = seen.size();
+        q.drainInto(seen);
+        for (std::size_t i = before; i < seen.size(); ++i) {
+            int producer = seen[i] / kPerThread;
+            ordered      = ordered && seen[i] > lastPerProducer[static_cast<std::size_t>(producer)];
+            lastPerProducer[static_cast<std::size_t>(producer)] = seen[i];
+        }
+    }
+    for (auto& t : producers)
+        t.join();
+
+    EXPECT_TRUE(ordered);
+    std::sort(seen.begin(), seen.end());
+    for (int i = 0; i < kProducers * kPerThread; ++i)
+        ASSERT_EQ(seen[static_cast<std::size_t>(i)], i);
+}
+
+TEST(SpscQueue, WrapsAroundAndRejectsWhenFull)
+{
+    SpscQueue<int> q(4);
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(q.push(round * 4 + i));
+        EXPECT_FALSE(q.push(99));
+        std::vector<int> out;
+        EXPECT_EQ(q.drainInto(out), 4U);
+        EXPECT_EQ(out.front(), round * 4);
+        EXPECT_EQ(out.back(), round * 4 + 3);
+    }
+    EXPECT_EQ(q.dropped(), 3U);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueue, ProducerAndConsumerThreadsPreserveOrder)
+{
+    SpscQueue<std::vector<int>> q(64);
+    constexpr int kCount = 50000;
+    std::thread producer([&q] {
+        for (int i = 0; i < kCount; ++i) {
+            while (!q.push(std::vector<int>{i, i + 1}))
+                std::this_thread::yield();
+        }
+    });
+
+    int expected = 0;
+    std::vector<int> item;
+    while (expected < kCount) {
+        if (!q.tryPop(item))
+            continue;
+        ASSERT_EQ(item.size(), 2U);
+        ASSERT_EQ(item[0], expected);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,212 @@
+#include "ecs/Registry.hpp"
+#include "ecs/View.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Position
+    {
+        float x = 0.0F;
+        float y = 0.0F;
+
+        Position() = default;
+        Position(float xVal, float yVal) : x(xVal), y(yVal) {}
+    };
+
+    struct Velocity
+    {
+        float dx = 0.0F;
+        float dy = 0.0F;
+
+        Velocity() = default;
+        Velocity(float dxVal, float dyVal) : dx(dxVal), dy(dyVal) {}
+    };
+
+    struct Name
+    {
+        std::string value;
+        std::shared_ptr<int> handle;
+    };
+} // namespace
+
+TEST(ArchetypeStorage, RegistryReportsMode)
+{
+    Registry sparse;
+    Registry archetype(StorageMode::Archetype);
+    EXPECT_EQ(sparse.storageMode(), StorageMode::SparseSet);
+    EXPECT_EQ(archetype.storageMode(), StorageMode::Archetype);
+}
+
+TEST(ArchetypeStorage, EmplaceGetHasRemove)
+{
+    Registry registry(StorageMode::Archetype);
+    const EntityId entity = registry.createEntity();
+    registry.emplace<Position>(entity, 1.0F, 2.0F);
+    registry.emplace<Velocity>(entity, 3.0F, 4.0F);
+
+    EXPECT_TRUE(registry.has<Position>(entity));
+    EXPECT_TRUE(registry.has<Velocity>(entity));
+    EXPECT_FLOAT_EQ(registry.get<Position>(entity).x, 1.0F);
+    EXPECT_FLOAT_EQ(registry.get<Velocity>(entity).dy, 4.0F);
+
+    registry.remove<Position>(entity);
+    EXPECT_FALSE(registry.has<Position>(entity));
+    EXPECT_THROW(registry.get<Position>(entity), ComponentNotFoundError);
+    EXPECT_FLOAT_EQ(registry.get<Velocity>(entity).dx, 3.0F);
+}
+
+TEST(ArchetypeStorage, EmplaceExistingComponentReplacesValue)
+{
+    Registry registry(StorageMode::Archetype);
+    const EntityId entity = registry.createEntity();
+    registry.emplace<Position>(entity, 1.0F, 2.0F);
+    registry.emplace<Position>(entity, 5.0F, 6.0F);
+    EXPECT_FLOAT_EQ(registry.get<Position>(entity).x, 5.0F);
+}
+
+TEST(ArchetypeStorage, MigrationKeepsOtherEntitiesIntact)
+{
+    Registry registry(StorageMode::Archetype);
+    std::vector<EntityId> ids;
+    for (int i = 0; i < 3000; ++i) {
+        ids.push_back(registry.createEntity());
+        registry.emplace<Position>(ids.back(), static_cast<float>(i), 0.0F);
+    }
+    for (std::size_t i = 0; i < ids.size(); i += 2) {
+        registry.emplace<Velocity>(ids[i], 1.0F, 0.0F);
+    }
+    for (std::size_t i = 0; i < ids.size(); i += 3) {
+        registry.destroyEntity(ids[i]);
+    }
+
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(registry.has<Position>(ids[i]));
+            continue;
+        }
+        EXPECT_FLOAT_EQ(registry.get<Position>(ids[i]).x, static_cast<float>(i));
+        EXPECT_EQ(registry.has<Velocity>(ids[i]), i % 2 == 0);
+    }
+}
+
+TEST(ArchetypeStorage, NonTrivialComponentsAreDestroyed)
+{
+    auto handle = std::make_shared<int>(7);
+    {
+        Registry registry(StorageMode::Archetype);
+        const EntityId first  = registry.createEntity();
+        const EntityId second = registry.createEntity();
+        registry.emplace<Name>(first, Name{"first", handle});
+        registry.emplace<Name>(second, Name{"second", handle});
+        registry.emplace<Position>(first, 1.0F, 1.0F);
+        EXPECT_EQ(handle.use_count(), 3);
+
+        registry.destroyEntity(first);
+        EXPECT_EQ(handle.use_count(), 2);
+        EXPECT_EQ(registry.get<Name>(second).value, "second");
+    }
+    EXPECT_EQ(handle.use_count(), 1);
+}
+
+TEST(ArchetypeStorage, ViewVisitsMatchingArchetypes)
+{
+    Registry registry(StorageMode::Archetype);
+    const EntityId moving = registry.createEntity();
+    const EntityId still  = registry.createEntity();
+    const EntityId named  = registry.createEntity();
+    registry.emplace<Position>(moving, 0.0F, 0.0F);
+    registry.emplace<Velocity>(moving, 2.0F, 3.0F);
+    registry.emplace<Position>(still, 0.0F, 0.0F);
+    registry.emplace<Position>(named, 0.0F, 0.0F);
+    registry.emplace<Velocity>(named, 1.0F, 1.0F);
+    registry.emplace<Name>(named, Name{"named", nullptr});
+
+    std::vector<EntityId> matched;
+    for (auto [id, pos, vel] : registry.view<Position, Velocity>().each()) {
+        matched.push_back(id);
+        pos.x += vel.dx;
+    }
+
+    ASSERT_EQ(matched.size(), 2u);
+    EXPECT_FLOAT_EQ(registry.get<Position>(moving).x, 2.0F);
+    EXPECT_FLOAT_EQ(registry.get<Position>(named).x, 1.0F);
+    EXPECT_FLOAT_EQ(registry.get<Position>(still).x, 0.0F);
+
+    std::size_t count = 0;
+    for (EntityId id : registry.view<Position>()) {
+        (void) id;
+        ++count;
+    }
+    EXPECT_EQ(count, 3u);
+}
+
+TEST(ArchetypeStorage, EachChunkYieldsContiguousColumns)
+{
+    Registry registry(StorageMode::Archetype);
+    for (int i = 0; i < 1000; ++i) {
+        const EntityId id = registry.createEntity();
+        registry.emplace<Position>(id, 0.0F, 0.0F);
+        registry.emplace<Velocity>(id, 1.0F, 2.0F);
+    }
+
+    std::size_t visited = 0;
+    std::size_t chunks  = 0;
+    registry.view<Position, Velocity>().eachChunk(
+        [&](std::size_t count, const EntityId*, Position* pos, Velocity* vel) {
+            for (std::size_t i = 0; i < count; ++i) {
+                pos[i].x += vel[i].dx;
+                pos[i].y += vel[i].dy;
+            }
+            visited += count;
+            ++chunks;
+        });
+
+    EXPECT_EQ(visited, 1000u);
+    EXPECT_LT(chunks, visited);
+    EXPECT_FLOAT_EQ(registry.get<Position>(0).y, 2.0F);
+}
+
+TEST(ArchetypeStorage, RemovingCurrentComponentDuringViewDoesNotSkip)
+{
+    Registry registry(StorageMode::Archetype);
+    std::vector<EntityId> ids;
+    for (int i = 0; i < 4; ++i) {
+        ids.push_back(registry.createEntity());
+        registry.emplace<Position>(ids.back(), 0.0F, 0.0F);
+        registry.emplace<Velocity>(ids.back(), 0.0F, 0.0F);
+    }
+
+    std::size_t visited = 0;
+    for (EntityId id : registry.view<Velocity>()) {
+        ++visited;
+        if (id == ids[0]) {
+            registry.destroyEntity(id);
+        }
+    }
+    EXPECT_EQ(visited, 4u);
+}
+
+TEST(ArchetypeStorage, ClearAndCompact)
+{
+    Registry registry(StorageMode::Archetype);
+    std::vector<EntityId> ids;
+    for (int i = 0; i < 10; ++i) {
+        ids.push_back(registry.createEntity());
+        registry.emplace<Position>(ids.back(), 0.0F, 0.0F);
+    }
+    for (std::size_t i = 5; i < ids.size(); ++i) {
+        registry.destroyEntity(ids[i]);
+    }
+    registry.compact();
+    EXPECT_EQ(registry.entityCount(), 5u);
+    EXPECT_TRUE(registry.has<Position>(ids[4]));
+
+    registry.clear();
+    EXPECT_EQ(registry.entityCount(), 0u);
+    const EntityId fresh = registry.createEntity();
+    EXPECT_FALSE(registry.has<Position>(fresh));
+}
@@ -1,3 +1,4 @@
+#include "components/Components.hpp"
 #include "ecs/Registry.hpp"
 
 #include <gtest/gtest.h>
@@ -92,3 +93,100 @@ TEST(Registry, RemoveMissingComponentIsSafe)
     const EntityId entity = registry.createEntity();
     EXPECT_NO_THROW(registry.remove<Health>(entity));
 }
+
+TEST(Registry, RecycledIdGetsNewGeneration)
+{
+    Registry registry;
+    const EntityId entity = registry.createEntity();
+    const Entity handle   = registry.handle(entity);
+    EXPECT_TRUE(registry.isAlive(handle));
+
+    registry.destroyEntity(entity);
+    const EntityId reused = registry.createEntity();
+    ASSERT_EQ(reused, entity);
+
+    EXPECT_FALSE(registry.isAlive(handle));
+    EXPECT_TRUE(registry.isAlive(registry.handle(reused)));
+    EXPECT_EQ(registry.generation(reused), handle.generation + 1);
+}
+
+TEST(Registry, DestroyEntityReleasesStorageSlot)
+{
+    Registry registry;
+    const EntityId first  = registry.createEntity();
+    const EntityId second = registry.createEntity();
+    registry.emplace<Position>(first, 1.0F, 2.0F);
+    registry.emplace<Position>(second, 3.0F, 4.0F);
+
+    registry.destroyEntity(first);
+
+    std::vector<EntityId> matched;
+    for (EntityId id : registry.view<Position>()) {
+        matched.push_back(id);
+    }
+    ASSERT_EQ(matched.size(), 1u);
+    EXPECT_EQ(matched[0], second);
+    EXPECT_FLOAT_EQ(registry.get<Position>(second).x, 3.0F);
+}
+
+TEST(Registry, CompactTrimsTrailingDeadEntities)
+{
+    Registry registry;
+    std::vector<EntityId> ids;
+    for (int i = 0; i < 8; ++i) {
+        ids.push_back(registry.createEntity());
+        registry.emplace<Position>(ids.back(), 0.0F, 0.0F);
+    }
+    const Entity stale = registry.handle(ids[5]);
+    for (std::size_t i = 2; i < ids.size(); ++i) {
+        registry.destroyEntity(ids[i]);
+    }
+
+    registry.compact();
+    EXPECT_EQ(registry.entityCount(), 2u);
+    EXPECT_TRUE(registry.isAlive(ids[0]));
+    EXPECT_TRUE(registry.isAlive(ids[1]));
+
+    EntityId next = registry.createEntity();
+    EXPECT_EQ(next, 2u);
+    for (int i = 0; i < 3; ++i) {
+        next = registry.createEntity();
+    }
+    EXPECT_EQ(next, ids[5]);
+    EXPECT_FALSE(registry.isAlive(stale));
+    EXPECT_FALSE(registry.has<Position>(next));
+}
+
+TEST(Registry, SharedComponentsHaveDenseStaticIds)
+{
+    static_assert(ComponentTypeId::value<TransformComponent>() == 0);
+    static_assert(ComponentTypeId::value<VelocityComponent>() == 1);
+    static_assert(ComponentTypeId::value<ShieldComponent>() == SharedComponents::size - 1);
+    EXPECT_LT(ComponentTypeId::value<TagComponent>(), ComponentTypeId::kStaticCapacity);
+}
+
+TEST(Registry, UnregisteredComponentsGetDynamicIds)
+{
+    const auto position = ComponentTypeId::value<Position>();
+    const auto health   = ComponentTypeId::value<Health>();
+    EXPECT_GE(position, ComponentTypeId::kStaticCapacity);
+    EXPECT_GE(health, ComponentTypeId::kStaticCapacity);
+    EXPECT_NE(position, health);
+    EXPECT_EQ(position, ComponentTypeId::value<Position>());
+}
+
+TEST(Registry, MixesStaticAndDynamicComponents)
+{
+    Registry registry;
+    const EntityId e = registry.createEntity();
+    registry.emplace<TransformComponent>(e, TransformComponent::create(4.0F, 5.0F));
+    registry.emplace<Health>(e, 7);
+
+    EXPECT_FLOAT_EQ(registry.get<TransformComponent>(e).y, 5.0F);
+    EXPECT_EQ(registry.get<Health>(e).value, 7);
+    EXPECT_FALSE(registry.has<VelocityComponent>(e));
+
+    registry.remove<TransformComponent>(e);
+    EXPECT_FALSE(registry.has<TransformComponent>(e));
+    EXPECT_TRUE(registry.has<Health>(e));
+}
@@ -0,0 +1,146 @@
+#include "components/Components.hpp"
+#include "ecs/Registry.hpp"
+#include "errors/RegistryError.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+    std::vector<EntityId> sorted(std::vector<EntityId> ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+} // namespace
+
+TEST(TagIndex, EmplaceAddsEntityToEachTagSet)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    EntityId c = registry.createEntity();
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(b, TagComponent::create(EntityTag::Enemy | EntityTag::Projectile));
+    registry.emplace<TagComponent>(c, TagComponent::create(EntityTag::Player));
+
+    EXPECT_EQ(sorted(registry.tagged(EntityTag::Enemy)), (std::vector<EntityId>{a, b}));
+    EXPECT_EQ(registry.tagged(EntityTag::Projectile), (std::vector<EntityId>{b}));
+    EXPECT_EQ(registry.tagged(EntityTag::Player), (std::vector<EntityId>{c}));
+    EXPECT_TRUE(registry.tagged(EntityTag::Pickup).empty());
+    EXPECT_TRUE(registry.tagged(EntityTag::None).empty());
+}
+
+TEST(TagIndex, CombinedMaskIsRejected)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(b, TagComponent::create(EntityTag::Projectile));
+
+    EXPECT_THROW(registry.tagged(EntityTag::Enemy | EntityTag::Projectile), RegistryError);
+    EXPECT_THROW(registry.viewTagged<TagComponent>(EntityTag::Enemy | EntityTag::Projectile), RegistryError);
+    EXPECT_EQ(registry.tagged(EntityTag::Enemy), (std::vector<EntityId>{a}));
+}
+
+TEST(TagIndex, DestroyAndRemoveDropEntity)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    EntityId c = registry.createEntity();
+    for (EntityId id : {a, b, c}) {
+        registry.emplace<TagComponent>(id, TagComponent::create(EntityTag::Enemy));
+    }
+
+    registry.destroyEntity(a);
+    registry.remove<TagComponent>(c);
+    EXPECT_EQ(registry.tagged(EntityTag::Enemy), (std::vector<EntityId>{b}));
+    EXPECT_FALSE(registry.hasTag(c, EntityTag::Enemy));
+
+    EntityId reused = registry.createEntity();
+    EXPECT_EQ(reused, a);
+    EXPECT_EQ(registry.tagMask(reused), 0u);
+}
+
+TEST(TagIndex, AddAndRemoveTagKeepSetsInSync)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Enemy));
+
+    registry.addTag<TagComponent>(a, EntityTag::Obstacle);
+    EXPECT_TRUE(registry.get<TagComponent>(a).hasTag(EntityTag::Obstacle));
+    EXPECT_EQ(registry.tagged(EntityTag::Obstacle), (std::vector<EntityId>{a}));
+
+    registry.removeTag<TagComponent>(a, EntityTag::Enemy);
+    EXPECT_FALSE(registry.get<TagComponent>(a).hasTag(EntityTag::Enemy));
+    EXPECT_TRUE(registry.tagged(EntityTag::Enemy).empty());
+    EXPECT_TRUE(registry.hasTag(a, EntityTag::Obstacle));
+}
+
+TEST(TagIndex, ReemplaceReplacesTags)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Pickup));
+
+    EXPECT_TRUE(registry.tagged(EntityTag::Enemy).empty());
+    EXPECT_EQ(registry.tagged(EntityTag::Pickup), (std::vector<EntityId>{a}));
+}
+
+TEST(TagIndex, ViewTaggedFiltersByComponents)
+{
+    Registry registry;
+    EntityId withTransform = registry.createEntity();
+    EntityId bare          = registry.createEntity();
+    EntityId other         = registry.createEntity();
+    registry.emplace<TagComponent>(withTransform, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TransformComponent>(withTransform, TransformComponent::create(4.0F, 2.0F));
+    registry.emplace<TagComponent>(bare, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(other, TagComponent::create(EntityTag::Player));
+    registry.emplace<TransformComponent>(other);
+
+    std::vector<EntityId> seen;
+    for (EntityId id : registry.viewTagged<TransformComponent>(EntityTag::Enemy)) {
+        seen.push_back(id);
+    }
+    EXPECT_EQ(seen, (std::vector<EntityId>{withTransform}));
+
+    float sum = 0.0F;
+    registry.viewTagged<TransformComponent>(EntityTag::Enemy).each([&](EntityId, TransformComponent& t) {
+        sum += t.x;
+    });
+    EXPECT_FLOAT_EQ(sum, 4.0F);
+}
+
+TEST(TagIndex, ArchetypeModeKeepsTagSets)
+{
+    Registry registry(StorageMode::Archetype);
+    EntityId a = registry.createEntity();
+    registry.emplace<TransformComponent>(a);
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Projectile));
+    registry.emplace<VelocityComponent>(a);
+
+    EXPECT_EQ(registry.tagged(EntityTag::Projectile), (std::vector<EntityId>{a}));
+    registry.destroyEntity(a);
+    EXPECT_TRUE(registry.tagged(EntityTag::Projectile).empty());
+}
+
+TEST(TagIndex, ClearAndCompactResetSets)
+{
+    Registry registry;
+    EntityId a = registry.createEntity();
+    EntityId b = registry.createEntity();
+    registry.emplace<TagComponent>(a, TagComponent::create(EntityTag::Enemy));
+    registry.emplace<TagComponent>(b, TagComponent::create(EntityTag::Enemy));
+    registry.destroyEntity(b);
+    registry.compact();
+    EXPECT_EQ(registry.tagged(EntityTag::Enemy), (std::vector<EntityId>{a}));
+
+    registry.clear();
+    EXPECT_TRUE(registry.tagged(EntityTag::Enemy).empty());
+}
@@ -243,3 +243,94 @@ TEST(ViewTests, MultipleViewsSimultaneously)
     ASSERT_EQ(matchedPosHealth.size(), 1);
     EXPECT_EQ(matchedPosHealth[0], e2);
 }
+
+TEST(ViewTests, EachYieldsIdAndComponents)
+{
+    Registry registry;
+    EntityId e1 = registry.createEntity();
+    EntityId e2 = registry.createEntity();
+
+    registry.emplace<Position>(e1, 10.0F, 20.0F);
+    registry.emplace<Velocity>(e1, 1.0F, 2.0F);
+    registry.emplace<Position>(e2, 30.0F, 40.0F);
+
+    std::vector<EntityId> matched;
+    for (auto [id, pos, vel] : registry.view<Position, Velocity>().each()) {
+        matched.push_back(id);
+        pos.x += vel.dx;
+        pos.y += vel.dy;
+    }
+
+    ASSERT_EQ(matched.size(), 1);
+    EXPECT_EQ(matched[0], e1);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e1).x, 11.0F);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e1).y, 22.0F);
+    EXPECT_FLOAT_EQ(registry.get<Position>(e2).x, 30.0F);
+}
+
+TEST(ViewTests, EachOnMissingStorageIsEmpty)
+{
+    Registry registry;
+    EntityId e1 = registry.createEntity();
+    registry.emplace<Position>(e1, 1.0F, 2.0F);
+
+    auto each = registry.view<Position, Health>().each();
+    EXPECT_EQ(each.begin(), each.end());
+}
+
+TEST(ViewTests, IteratesSmallestPool)
+{
+    Registry registry;
+    std::vector<EntityId> ids;
+    for (int i = 0; i < 10; ++i) {
+        ids.push_back(registry.createEntity());
+        registry.emplace<Position>(ids.back(), 0.0F, 0.0F);
+    }
+    registry.emplace<Velocity>(ids[7], 1.0F, 0.0F);
+    registry.emplace<Velocity>(ids[2], 1.0F, 0.0F);
+
+    std::vector<EntityId> matched;
+    for (EntityId id : registry.view<Position, Velocity>()) {
+        matched.push_back(id);
+    }
+
+    ASSERT_EQ(matched.size(), 2);
+    EXPECT_EQ(matched[0], ids[7]);
+    EXPECT_EQ(matched[1], ids[2]);
+}
+
+TEST(ViewTests, SkipsRecycledEntityWithoutComponent)
+{
+    Registry registry;
+    EntityId e1 = registry.createEntity();
+    registry.emplace<Position>(e1, 1.0F, 2.0F);
+    registry.destroyEntity(e1);
+    EntityId reused = registry.createEntity();
+    ASSERT_EQ(reused, e1);
+
+    auto view = registry.view<Position>();
+    EXPECT_EQ(view.begin(), view.end());
+}
+
+TEST(ViewTests, RemovingCurrentComponentDoesNotSkipNext)
+{
+    Registry registry;
+    EntityId e1 = registry.createEntity();
+    EntityId e2 = registry.createEntity();
+    EntityId e3 = registry.createEntity();
+
+    registry.emplace<Health>(e1, 1);
+    registry.emplace<Health>(e2, 2);
+    registry.emplace<Health>(e3, 3);
+
+    std::vector<EntityId> matched;
+    for (EntityId id : registry.view<Health>()) {
+        matched.push_back(id);
+        if (id == e1) {
+            registry.remove<Health>(id);
+        }
+    }
+
+    ASSERT_EQ(matched.size(), 3);
+    EXPECT_FALSE(registry.has<Health>(e1));
+}
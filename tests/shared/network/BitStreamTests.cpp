@@ -0,0 +1,85 @@
+#include "network/BitStream.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(BitStream, RoundTripsUnalignedFields)
+{
+    BitWriter writer;
+    writer.writeBits(0x5, 3);
+    writer.writeBool(true);
+    writer.writeBits(0xABCD, 16);
+    writer.writeBits(0x1, 1);
+    EXPECT_EQ(writer.bitCount(), 21U);
+    EXPECT_EQ(writer.byteCount(), 3U);
+
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    std::uint32_t value = 0;
+    bool flag           = false;
+    ASSERT_TRUE(reader.readBits(3, value));
+    EXPECT_EQ(value, 0x5U);
+    ASSERT_TRUE(reader.readBool(flag));
+    EXPECT_TRUE(flag);
+    ASSERT_TRUE(reader.readBits(16, value));
+    EXPECT_EQ(value, 0xABCDU);
+    ASSERT_TRUE(reader.readBits(1, value));
+    EXPECT_EQ(value, 1U);
+    EXPECT_EQ(reader.bitsRemaining(), 3U);
+}
+
+TEST(BitStream, VarUIntUsesOneGroupPerRange)
+{
+    EXPECT_EQ(BitWriter::varUIntBits(0, 4), 5U);
+    EXPECT_EQ(BitWriter::varUIntBits(15, 4), 5U);
+    EXPECT_EQ(BitWriter::varUIntBits(16, 4), 10U);
+    EXPECT_EQ(BitWriter::varUIntBits(127), 8U);
+    EXPECT_EQ(BitWriter::varUIntBits(128), 16U);
+
+    BitWriter writer;
+    for (std::uint32_t v : {0U, 15U, 16U, 300U, 0xFFFFFFFFU})
+        writer.writeVarUInt(v, 4);
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    for (std::uint32_t expected : {0U, 15U, 16U, 300U, 0xFFFFFFFFU}) {
+        std::uint32_t value = 0;
+        ASSERT_TRUE(reader.readVarUInt(value, 4));
+        EXPECT_EQ(value, expected);
+    }
+}
+
+TEST(BitStream, VarIntZigZagsNegativeValues)
+{
+    EXPECT_EQ(BitWriter::zigZag(0), 0U);
+    EXPECT_EQ(BitWriter::zigZag(-1), 1U);
+    EXPECT_EQ(BitWriter::zigZag(1), 2U);
+
+    BitWriter writer;
+    for (std::int32_t v : {-1, 5, -70000, 2147483647, -2147483647 - 1})
+        writer.writeVarInt(v);
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    for (std::int32_t expected : {-1, 5, -70000, 2147483647, -2147483647 - 1}) {
+        std::int32_t value = 0;
+        ASSERT_TRUE(reader.readVarInt(value));
+        EXPECT_EQ(value, expected);
+    }
+}
+
+TEST(BitStream, ReaderRejectsReadsPastTheEnd)
+{
+    BitWriter writer;
+    writer.writeBits(0x3, 2);
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    std::uint32_t value = 0;
+    bool flag           = false;
+    EXPECT_FALSE(reader.readBits(9, value));
+    EXPECT_TRUE(reader.readBits(8, value));
+    EXPECT_FALSE(reader.readBool(flag));
+}
+
+TEST(BitStream, ClearKeepsWriterReusable)
+{
+    BitWriter writer;
+    writer.writeBits(0xFF, 8);
+    writer.clear();
+    writer.writeBits(0x1, 1);
+    ASSERT_EQ(writer.byteCount(), 1U);
+    EXPECT_EQ(writer.bytes()[0], 0x80);
+}
@@ -0,0 +1,63 @@
+#include "network/Crc32.hpp"
+#include "network/PacketHeader.hpp"
+
+#include <gtest/gtest.h>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::uint32_t bitwise(const std::uint8_t* data, std::size_t len, std::uint32_t polynomial)
+    {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < len; ++i) {
+            crc ^= data[i];
+            for (int b = 0; b < 8; ++b)
+                crc = (crc & 1u) != 0u ? (crc >> 1) ^ polynomial : crc >> 1;
+        }
+        return ~crc;
+    }
+
+    std::vector<std::uint8_t> pattern(std::size_t size)
+    {
+        std::vector<std::uint8_t> data(size);
+        for (std::size_t i = 0; i < size; ++i)
+            data[i] = static_cast<std::uint8_t>(i * 31 + 7);
+        return data;
+    }
+} // namespace
+
+TEST(Crc32, MatchesReferenceCheckValues)
+{
+    std::string_view check = "123456789";
+    const auto* data       = reinterpret_cast<const std::uint8_t*>(check.data());
+    EXPECT_EQ(Crc32::ieee(data, check.size()), 0xCBF43926u);
+    EXPECT_EQ(Crc32::castagnoli(data, check.size()), 0xE3069283u);
+}
+
+TEST(Crc32, DispatchedAndPortableAgreeOnEveryLengthAndAlignment)
+{
+    auto data = pattern(96);
+    for (std::size_t offset = 0; offset < 8; ++offset) {
+        for (std::size_t len = 0; offset + len <= data.size(); ++len) {
+            const std::uint8_t* p = data.data() + offset;
+            ASSERT_EQ(Crc32::ieee(p, len), bitwise(p, len, 0xEDB88320u)) << offset << "+" << len;
+            ASSERT_EQ(Crc32::ieeePortable(p, len), Crc32::ieee(p, len));
+            ASSERT_EQ(Crc32::castagnoli(p, len), bitwise(p, len, 0x82F63B78u)) << offset << "+" << len;
+            ASSERT_EQ(Crc32::castagnoliPortable(p, len), Crc32::castagnoli(p, len));
+        }
+    }
+}
+
+TEST(Crc32, PacketHeaderKeepsTheWireChecksum)
+{
+    auto data = pattern(1400);
+    EXPECT_EQ(PacketHeader::crc32(data.data(), data.size()), bitwise(data.data(), data.size(), 0xEDB88320u));
+    EXPECT_EQ(PacketHeader::crc32(nullptr, 4), 0u);
+}
+
+TEST(Crc32, ReportsABackend)
+{
+    EXPECT_NE(std::string_view(Crc32::ieeeBackend()), "");
+    EXPECT_NE(std::string_view(Crc32::castagnoliBackend()), "");
+}
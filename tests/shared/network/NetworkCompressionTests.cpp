@@ -85,3 +85,24 @@ TEST(NetworkCompression, PartialDecompressionSizeMismatch)
     EXPECT_THROW(
         { Compression::decompress(compressed.data(), compressed.size(), input.size() + 1); }, DecompressionError);
 }
+
+TEST(NetworkCompression, CompressIntoPreallocatedBuffer)
+{
+    std::vector<std::uint8_t> input(1000, 0x42);
+    std::vector<std::uint8_t> output(Compression::compressBound(input.size()));
+
+    std::size_t size = Compression::compressInto(input.data(), input.size(), output.data(), output.size());
+    ASSERT_GT(size, 0U);
+    EXPECT_LT(size, 50U);
+
+    auto decompressed = Compression::decompress(output.data(), size, input.size());
+    EXPECT_EQ(input, decompressed);
+}
+
+TEST(NetworkCompression, CompressIntoReportsInsufficientCapacity)
+{
+    std::vector<std::uint8_t> input = {0xDE, 0xAD, 0xBE, 0xEF, 0x12, 0x34, 0x56, 0x78};
+    std::vector<std::uint8_t> output(input.size() - 1);
+
+    EXPECT_EQ(Compression::compressInto(input.data(), input.size(), output.data(), output.size()), 0U);
+}
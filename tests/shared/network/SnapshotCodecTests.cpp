@@ -0,0 +1,148 @@
+#include "network/SnapshotCodec.hpp"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    SnapshotCodec::EntityFields sampleFields()
+    {
+        SnapshotCodec::EntityFields fields{};
+        fields.type   = 7;
+        fields.posX   = 1200;
+        fields.posY   = -340;
+        fields.velX   = -25;
+        fields.velY   = 4;
+        fields.health = 90;
+        fields.status = 0x25;
+        fields.score  = 1500;
+        return fields;
+    }
+
+    constexpr std::uint16_t kAllFields = SnapshotCodec::kWireFields;
+} // namespace
+
+TEST(SnapshotCodec, CompactMaskKeepsOnlyWireFields)
+{
+    EXPECT_EQ(SnapshotCodec::expandMask(SnapshotCodec::compactMask(kAllFields)), kAllFields);
+    EXPECT_EQ(SnapshotCodec::compactMask(SnapshotCodec::kFieldScore), 0x80);
+    EXPECT_EQ(SnapshotCodec::compactMask((1 << 7) | (1 << 8)), 0);
+}
+
+TEST(SnapshotCodec, ChangedFieldsComparesQuantizedValues)
+{
+    auto a = sampleFields();
+    auto b = a;
+    EXPECT_EQ(SnapshotCodec::changedFields(a, b), 0);
+    b.posY  = -339;
+    b.score = 1501;
+    EXPECT_EQ(SnapshotCodec::changedFields(a, b), SnapshotCodec::kFieldPosY | SnapshotCodec::kFieldScore);
+
+    SnapshotCodec::apply(a, b, SnapshotCodec::kFieldPosY);
+    EXPECT_EQ(a.posY, -339);
+    EXPECT_EQ(a.score, 1500);
+}
+
+TEST(SnapshotCodec, RoundTripsAbsoluteEntities)
+{
+    auto fields = sampleFields();
+    BitWriter writer;
+    SnapshotCodec::writeBaseline(writer, 50, std::nullopt);
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(writer, nextId, false, {12, kAllFields, false}, fields, nullptr);
+    SnapshotCodec::writeEntity(writer, nextId, false, {14, SnapshotCodec::kFieldPosX, false}, fields, nullptr);
+
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    std::optional<std::uint32_t> baseline;
+    ASSERT_TRUE(SnapshotCodec::readBaseline(reader, 50, baseline));
+    EXPECT_FALSE(baseline.has_value());
+
+    std::uint32_t readId = 0;
+    SnapshotCodec::EntityHeader header{};
+    SnapshotCodec::EntityFields decoded{};
+    ASSERT_TRUE(SnapshotCodec::readEntityHeader(reader, readId, false, header));
+    ASSERT_TRUE(SnapshotCodec::readEntityFields(reader, header, nullptr, decoded));
+    EXPECT_EQ(header.id, 12U);
+    EXPECT_EQ(header.mask, kAllFields);
+    EXPECT_EQ(decoded, fields);
+
+    ASSERT_TRUE(SnapshotCodec::readEntityHeader(reader, readId, false, header));
+    ASSERT_TRUE(SnapshotCodec::readEntityFields(reader, header, nullptr, decoded));
+    EXPECT_EQ(header.id, 14U);
+    EXPECT_EQ(decoded.posX, fields.posX);
+    EXPECT_EQ(decoded.posY, 0);
+}
+
+TEST(SnapshotCodec, DeltaEncodesAgainstBaseline)
+{
+    auto base    = sampleFields();
+    auto current = base;
+    current.posX += 3;
+    current.posY -= 40;
+    current.score += 250;
+    const std::uint16_t mask = SnapshotCodec::changedFields(current, base);
+
+    BitWriter writer;
+    SnapshotCodec::writeBaseline(writer, 100, 97);
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(writer, nextId, true, {3, mask, true}, current, &base);
+
+    BitWriter absolute;
+    std::uint32_t absoluteId = 0;
+    SnapshotCodec::writeEntity(absolute, absoluteId, true, {3, mask, false}, current, nullptr);
+    EXPECT_LT(writer.bitCount(), absolute.bitCount());
+
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    std::optional<std::uint32_t> baseline;
+    ASSERT_TRUE(SnapshotCodec::readBaseline(reader, 100, baseline));
+    EXPECT_EQ(baseline, std::optional<std::uint32_t>(97));
+
+    std::uint32_t readId = 0;
+    SnapshotCodec::EntityHeader header{};
+    SnapshotCodec::EntityFields decoded{};
+    ASSERT_TRUE(SnapshotCodec::readEntityHeader(reader, readId, true, header));
+    EXPECT_TRUE(header.delta);
+    EXPECT_FALSE(SnapshotCodec::readEntityFields(reader, header, nullptr, decoded));
+
+    BitReader retry(writer.bytes().data(), writer.byteCount());
+    readId = 0;
+    ASSERT_TRUE(SnapshotCodec::readBaseline(retry, 100, baseline));
+    ASSERT_TRUE(SnapshotCodec::readEntityHeader(retry, readId, true, header));
+    ASSERT_TRUE(SnapshotCodec::readEntityFields(retry, header, &base, decoded));
+    EXPECT_EQ(decoded, current);
+}
+
+TEST(SnapshotCodec, DeltaWrapsAcrossQuantizedRange)
+{
+    SnapshotCodec::EntityFields base{};
+    base.posX    = 32767;
+    auto current = base;
+    current.posX = -32768;
+
+    BitWriter writer;
+    std::uint32_t nextId = 0;
+    SnapshotCodec::writeEntity(writer, nextId, true, {0, SnapshotCodec::kFieldPosX, true}, current, &base);
+    EXPECT_EQ(writer.bitCount(), 5U + 1U + SnapshotCodec::kMaskBits + SnapshotCodec::kDeltaWidthBits + 2U);
+
+    BitReader reader(writer.bytes().data(), writer.byteCount());
+    std::uint32_t readId = 0;
+    SnapshotCodec::EntityHeader header{};
+    SnapshotCodec::EntityFields decoded{};
+    ASSERT_TRUE(SnapshotCodec::readEntityHeader(reader, readId, true, header));
+    ASSERT_TRUE(SnapshotCodec::readEntityFields(reader, header, &base, decoded));
+    EXPECT_EQ(decoded.posX, -32768);
+}
+
+TEST(SnapshotCodec, EntityBitsMatchesWriter)
+{
+    auto base    = sampleFields();
+    auto current = base;
+    current.posX += 1000;
+    current.velY = -4;
+    for (bool delta : {false, true}) {
+        SnapshotCodec::EntityHeader header{900, kAllFields, delta};
+        BitWriter writer;
+        std::uint32_t nextId = 880;
+        SnapshotCodec::writeEntity(writer, nextId, true, header, current, &base);
+        EXPECT_EQ(SnapshotCodec::entityBits(20, true, header, current, &base), writer.bitCount());
+    }
+}
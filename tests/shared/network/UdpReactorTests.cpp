@@ -0,0 +1,114 @@
+#include "network/UdpReactor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    IpEndpoint loopback(std::uint16_t port)
+    {
+        return IpEndpoint::v4(127, 0, 0, 1, port);
+    }
+} // namespace
+
+TEST(UdpReactor, TimesOutWhenIdle)
+{
+    UdpSocket rx;
+    ASSERT_TRUE(rx.open(loopback(0)));
+    UdpReactor reactor;
+    ASSERT_TRUE(reactor.open());
+    ASSERT_TRUE(reactor.watch(rx, [](const std::uint8_t*, std::size_t, const IpEndpoint&) {}));
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(reactor.poll(20ms), 0U);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 15ms);
+}
+
+TEST(UdpReactor, DrainsABurstInOnePoll)
+{
+    UdpSocket rx;
+    ASSERT_TRUE(rx.open(loopback(0)));
+    UdpSocket tx;
+    ASSERT_TRUE(tx.open(loopback(0)));
+
+    std::vector<std::uint8_t> seen;
+    UdpReactor reactor;
+    ASSERT_TRUE(reactor.open());
+    ASSERT_TRUE(reactor.watch(rx, [&](const std::uint8_t* data, std::size_t size, const IpEndpoint& from) {
+        ASSERT_EQ(size, 1U);
+        EXPECT_EQ(from.port, tx.localEndpoint().port);
+        seen.push_back(data[0]);
+    }));
+
+    const std::size_t burst = UdpSocket::kMaxBatch + 36;
+    for (std::size_t i = 0; i < burst; ++i) {
+        auto byte = static_cast<std::uint8_t>(i);
+        ASSERT_TRUE(tx.sendTo(&byte, 1, loopback(rx.localEndpoint().port)).ok());
+    }
+    std::this_thread::sleep_for(10ms);
+
+    EXPECT_EQ(reactor.poll(1000ms), burst);
+    ASSERT_EQ(seen.size(), burst);
+    for (std::size_t i = 0; i < burst; ++i)
+        EXPECT_EQ(seen[i], static_cast<std::uint8_t>(i));
+}
+
+TEST(UdpReactor, RoutesEachSocketToItsHandler)
+{
+    UdpSocket a;
+    UdpSocket b;
+    ASSERT_TRUE(a.open(loopback(0)));
+    ASSERT_TRUE(b.open(loopback(0)));
+    UdpSocket tx;
+    ASSERT_TRUE(tx.open(loopback(0)));
+
+    int onA = 0;
+    int onB = 0;
+    UdpReactor reactor;
+    ASSERT_TRUE(reactor.open());
+    ASSERT_TRUE(reactor.watch(a, [&](const std::uint8_t*, std::size_t, const IpEndpoint&) { ++onA; }));
+    ASSERT_TRUE(reactor.watch(b, [&](const std::uint8_t*, std::size_t, const IpEndpoint&) { ++onB; }));
+
+    const std::uint8_t byte = 7;
+    ASSERT_TRUE(tx.sendTo(&byte, 1, loopback(b.localEndpoint().port)).ok());
+    ASSERT_TRUE(tx.sendTo(&byte, 1, loopback(b.localEndpoint().port)).ok());
+    ASSERT_TRUE(tx.sendTo(&byte, 1, loopback(a.localEndpoint().port)).ok());
+    for (int i = 0; i < 10 && onA + onB < 3; ++i)
+        reactor.poll(100ms);
+    EXPECT_EQ(onA, 1);
+    EXPECT_EQ(onB, 2);
+}
+
+TEST(UdpReactor, WakeInterruptsABlockingPoll)
+{
+    UdpSocket rx;
+    ASSERT_TRUE(rx.open(loopback(0)));
+    UdpReactor reactor;
+    ASSERT_TRUE(reactor.open());
+    ASSERT_TRUE(reactor.watch(rx, [](const std::uint8_t*, std::size_t, const IpEndpoint&) {}));
+
+    std::atomic<bool> returned{false};
+    std::thread poller([&] {
+        reactor.poll(UdpReactor::kInfinite);
+        returned = true;
+    });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(returned);
+    reactor.wake();
+    poller.join();
+    EXPECT_TRUE(returned);
+}
+
+TEST(UdpReactor, RejectsClosedSockets)
+{
+    UdpSocket closed;
+    UdpReactor reactor;
+    EXPECT_FALSE(reactor.watch(closed, [](const std::uint8_t*, std::size_t, const IpEndpoint&) {}));
+    ASSERT_TRUE(reactor.open());
+    EXPECT_FALSE(reactor.watch(closed, [](const std::uint8_t*, std::size_t, const IpEndpoint&) {}));
+}
@@ -53,3 +53,78 @@ TEST(UdpSocket, SendReceiveLoopback)
     }
     EXPECT_EQ(src.addr[0], 127);
 }
+
+TEST(UdpSocket, SendBatchDeliversEveryDatagramInOrder)
+{
+    UdpSocket rxA;
+    UdpSocket rxB;
+    ASSERT_TRUE(rxA.open(loopback(0)));
+    ASSERT_TRUE(rxB.open(loopback(0)));
+    UdpSocket tx;
+    ASSERT_TRUE(tx.open(loopback(0)));
+
+    const std::size_t count = UdpSocket::kMaxBatch * 2 + 3;
+    std::vector<std::array<std::uint8_t, 2>> payloads(count);
+    std::vector<UdpDatagram> datagrams;
+    for (std::size_t i = 0; i < count; ++i) {
+        payloads[i] = {static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i % 2)};
+        datagrams.push_back(UdpDatagram{payloads[i].data(), payloads[i].size(),
+                                        loopback((i % 2 == 0 ? rxA : rxB).localEndpoint().port)});
+    }
+    auto sr = tx.sendBatch(datagrams);
+    ASSERT_TRUE(sr.ok());
+    ASSERT_EQ(sr.size, count);
+
+    std::array<std::uint8_t, 16> buf{};
+    IpEndpoint src{};
+    for (std::size_t i = 0; i < count; ++i) {
+        UdpSocket& rx = i % 2 == 0 ? rxA : rxB;
+        UdpResult rr{0, UdpError::WouldBlock};
+        for (int attempt = 0; attempt < 1000 && !rr.ok(); ++attempt)
+            rr = rx.recvFrom(buf.data(), buf.size(), src);
+        ASSERT_TRUE(rr.ok()) << i;
+        ASSERT_EQ(rr.size, 2U);
+        EXPECT_EQ(buf[0], static_cast<std::uint8_t>(i));
+    }
+}
+
+TEST(UdpSocket, SendBatchOnClosedSocketFails)
+{
+    UdpSocket tx;
+    std::array<std::uint8_t, 1> byte{};
+    UdpDatagram datagram{byte.data(), byte.size(), loopback(9)};
+    auto sr = tx.sendBatch(std::span<const UdpDatagram>(&datagram, 1));
+    EXPECT_EQ(sr.error, UdpError::NotOpen);
+    EXPECT_EQ(sr.size, 0U);
+}
+
+TEST(UdpSocket, RecvBatchDrainsPendingDatagrams)
+{
+    UdpSocket rx;
+    ASSERT_TRUE(rx.open(loopback(0)));
+    UdpSocket tx;
+    ASSERT_TRUE(tx.open(loopback(0)));
+    auto dst = loopback(rx.localEndpoint().port);
+    for (std::uint8_t i = 0; i < 10; ++i)
+        ASSERT_TRUE(tx.sendTo(&i, 1, dst).ok());
+
+    std::vector<std::array<std::uint8_t, 8>> storage(16);
+    std::vector<UdpRecvBuffer> buffers;
+    for (auto& slot : storage)
+        buffers.push_back(UdpRecvBuffer{slot.data(), slot.size(), 0, IpEndpoint{}});
+
+    std::size_t got = 0;
+    for (int attempt = 0; attempt < 1000 && got < 10; ++attempt) {
+        auto rr = rx.recvBatch(std::span<UdpRecvBuffer>(buffers).subspan(got));
+        if (!rr.ok())
+            continue;
+        got += rr.size;
+    }
+    ASSERT_EQ(got, 10U);
+    for (std::size_t i = 0; i < got; ++i) {
+        EXPECT_EQ(buffers[i].size, 1U);
+        EXPECT_EQ(buffers[i].data[0], static_cast<std::uint8_t>(i));
+        EXPECT_EQ(buffers[i].src.port, tx.localEndpoint().port);
+    }
+    EXPECT_EQ(rx.recvBatch(buffers).error, UdpError::WouldBlock);
+}
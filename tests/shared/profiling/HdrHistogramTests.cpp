@@ -0,0 +1,53 @@
+#include "profiling/HdrHistogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+TEST(HdrHistogram, BucketsKeepRelativeErrorBounded)
+{
+    for (std::uint64_t value : {0ULL, 1ULL, 63ULL, 64ULL, 65ULL, 1000ULL, 16'666'667ULL, 1ULL << 33}) {
+        const std::size_t index   = HdrHistogram::bucketIndex(value);
+        const std::uint64_t upper = HdrHistogram::bucketUpperBound(index);
+        ASSERT_LT(index, HdrHistogram::kBucketCount);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(static_cast<double>(upper - value), static_cast<double>(value) / 32.0 + 1.0);
+    }
+    EXPECT_EQ(HdrHistogram::bucketIndex(HdrHistogram::kMaxValue), HdrHistogram::kBucketCount - 1);
+    EXPECT_EQ(HdrHistogram::bucketIndex(~0ULL), HdrHistogram::kBucketCount - 1);
+}
+
+TEST(HdrHistogram, PercentilesTrackAUniformDistribution)
+{
+    auto histogram = std::make_unique<HdrHistogram>();
+    for (std::uint64_t v = 1; v <= 10000; ++v)
+        histogram->record(v * 1000);
+
+    EXPECT_EQ(histogram->count(), 10000U);
+    EXPECT_EQ(histogram->min(), 1000U);
+    EXPECT_EQ(histogram->max(), 10'000'000U);
+    EXPECT_NEAR(histogram->mean(), 5'000'500.0, 1.0);
+    EXPECT_NEAR(static_cast<double>(histogram->valueAtPercentile(50.0)), 5'000'000.0, 5'000'000.0 * 0.035);
+    EXPECT_NEAR(static_cast<double>(histogram->valueAtPercentile(99.0)), 9'900'000.0, 9'900'000.0 * 0.035);
+    EXPECT_EQ(histogram->valueAtPercentile(100.0), 10'000'000U);
+}
+
+TEST(HdrHistogram, MergeAndResetCombineCounts)
+{
+    auto a = std::make_unique<HdrHistogram>();
+    auto b = std::make_unique<HdrHistogram>();
+    a->record(10);
+    b->record(20'000);
+    b->record(30'000);
+
+    a->merge(*b);
+    EXPECT_EQ(a->count(), 3U);
+    EXPECT_EQ(a->min(), 10U);
+    EXPECT_EQ(a->max(), 30'000U);
+
+    a->reset();
+    EXPECT_EQ(a->count(), 0U);
+    EXPECT_EQ(a->min(), 0U);
+    EXPECT_EQ(a->valueAtPercentile(99.0), 0U);
+}
@@ -0,0 +1,104 @@
+#include "json/Json.hpp"
+#include "profiling/TickProfiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    const ZoneStats* findZone(const std::vector<ZoneStats>& zones, const std::string& name)
+    {
+        for (const auto& zone : zones) {
+            if (name == zone.name)
+                return &zone;
+        }
+        return nullptr;
+    }
+
+    void runTicks(TickProfiler& profiler, std::uint32_t count)
+    {
+        for (std::uint32_t tick = 0; tick < count; ++tick) {
+            ProfileTick profileTick(profiler, tick);
+            PROFILE_ZONE("test.outer");
+            for (int i = 0; i < 2; ++i) {
+                PROFILE_ZONE("test.inner");
+            }
+        }
+    }
+} // namespace
+
+TEST(TickProfiler, ZonesOutsideATickAreIgnored)
+{
+    TickProfiler profiler;
+    {
+        PROFILE_ZONE("test.unbound");
+    }
+    EXPECT_EQ(TickProfiler::current(), nullptr);
+    EXPECT_TRUE(profiler.stats().empty());
+}
+
+TEST(TickProfiler, FoldsNestedZonesOncePerTick)
+{
+    TickProfiler profiler;
+    runTicks(profiler, 10);
+
+    const auto zones = profiler.stats();
+    EXPECT_EQ(profiler.ticks(), 10U);
+    const auto* tick  = findZone(zones, "tick");
+    const auto* outer = findZone(zones, "test.outer");
+    const auto* inner = findZone(zones, "test.inner");
+    ASSERT_NE(tick, nullptr);
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+    EXPECT_EQ(inner->count, 10U);
+    EXPECT_LE(inner->max, outer->max);
+    EXPECT_LE(outer->p50, tick->max);
+    EXPECT_EQ(TickProfiler::current(), nullptr);
+
+    profiler.reset();
+    EXPECT_EQ(profiler.ticks(), 0U);
+    EXPECT_TRUE(profiler.stats().empty());
+}
+
+TEST(TickProfiler, RegisterZoneReturnsTheSameIdForAName)
+{
+    const auto first = TickProfiler::registerZone("test.same");
+    EXPECT_EQ(TickProfiler::registerZone("test.same"), first);
+    EXPECT_STREQ(TickProfiler::zoneName(first), "test.same");
+}
+
+TEST(TickProfiler, WritesTheLastTicksAsAChromeTrace)
+{
+    TickProfiler profiler(4);
+    runTicks(profiler, 10);
+
+    const auto path = (std::filesystem::temp_directory_path() / "rtype_trace_test.json").string();
+    ASSERT_TRUE(profiler.writeChromeTrace(path, 7, "Room 7"));
+
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    std::remove(path.c_str());
+
+    rtype::Json trace  = rtype::Json::parse(content.str());
+    rtype::Json events = trace["traceEvents"];
+    ASSERT_TRUE(events.isArray());
+    ASSERT_EQ(events.size(), 1U + 4U * 4U);
+    EXPECT_EQ(events[0].getValue<std::string>("ph"), "M");
+
+    std::size_t ticks = 0;
+    for (std::size_t i = 1; i < events.size(); ++i) {
+        EXPECT_EQ(events[i].getValue<std::string>("ph"), "X");
+        EXPECT_EQ(events[i].getValue<int>("tid"), 7);
+        if (events[i].getValue<std::string>("name") == "tick") {
+            EXPECT_GE(events[i]["args"].getValue<std::uint32_t>("tick"), 6U);
+            ++ticks;
+        }
+    }
+    EXPECT_EQ(ticks, 4U);
+}
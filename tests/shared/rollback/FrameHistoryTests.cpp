@@ -0,0 +1,136 @@
+#include "rollback/FrameHistory.hpp"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct TestState
+    {
+        float x            = 0.0F;
+        float y            = 0.0F;
+        std::int32_t score = 0;
+        std::uint8_t flags = 0;
+    };
+
+    struct World
+    {
+        std::map<EntityId, TestState> entities;
+        std::vector<EntityId> ids;
+        std::vector<TestState> states;
+        EntityId nextId = 0;
+
+        void step(std::mt19937& rng, std::uint64_t tick)
+        {
+            std::uniform_int_distribution<int> roll(0, 9);
+            for (auto it = entities.begin(); it != entities.end();) {
+                if (roll(rng) == 0 && tick % 3 == 0)
+                    it = entities.erase(it);
+                else {
+                    it->second.x += 1.5F;
+                    if (roll(rng) < 3)
+                        it->second.y -= 0.25F;
+                    ++it;
+                }
+            }
+            while (entities.size() < 40)
+                entities[nextId++] = TestState{static_cast<float>(nextId), 10.0F, 0, 1};
+            ids.clear();
+            states.clear();
+            for (const auto& [id, state] : entities) {
+                ids.push_back(id);
+                states.push_back(state);
+            }
+        }
+    };
+
+    bool sameState(const TestState& a, const TestState& b)
+    {
+        return a.x == b.x && a.y == b.y && a.score == b.score && a.flags == b.flags;
+    }
+} // namespace
+
+TEST(FrameHistory, RestoresEveryTickInTheWindow)
+{
+    FrameHistory<TestState> history(120);
+    std::mt19937 rng(3);
+    World world;
+    std::map<std::uint64_t, std::pair<std::vector<EntityId>, std::vector<TestState>>> expected;
+    for (std::uint64_t tick = 1; tick <= 400; ++tick) {
+        world.step(rng, tick);
+        history.addSnapshot(tick, world.ids, world.states, static_cast<std::uint32_t>(tick * 7));
+        expected[tick] = {world.ids, world.states};
+    }
+
+    FrameHistory<TestState>::Frame frame;
+    for (std::uint64_t tick = 281; tick <= 400; ++tick) {
+        ASSERT_TRUE(history.getSnapshot(tick, frame)) << tick;
+        EXPECT_EQ(frame.tick, tick);
+        EXPECT_EQ(frame.checksum, tick * 7);
+        ASSERT_EQ(frame.ids, expected[tick].first);
+        for (std::size_t i = 0; i < frame.states.size(); ++i)
+            ASSERT_TRUE(sameState(frame.states[i], expected[tick].second[i])) << tick << ":" << i;
+    }
+    EXPECT_FALSE(history.hasSnapshot(280));
+    EXPECT_EQ(history.size(), 120U);
+    auto range = history.getTickRange();
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range->first, 281U);
+    EXPECT_EQ(range->second, 400U);
+}
+
+TEST(FrameHistory, ArenaStopsGrowingOnceWarm)
+{
+    FrameHistory<TestState> history(300);
+    std::mt19937 rng(11);
+    World world;
+    for (std::uint64_t tick = 1; tick <= 900; ++tick) {
+        world.step(rng, tick);
+        history.addSnapshot(tick, world.ids, world.states, 0);
+    }
+    const std::size_t warm = history.arenaBytes();
+    for (std::uint64_t tick = 901; tick <= 1800; ++tick) {
+        world.step(rng, tick);
+        history.addSnapshot(tick, world.ids, world.states, 0);
+    }
+    EXPECT_EQ(history.arenaBytes(), warm);
+    EXPECT_LT(warm, 300 * world.ids.size() * (sizeof(TestState) + sizeof(EntityId)));
+}
+
+TEST(FrameHistory, RewritingATickDropsLaterFrames)
+{
+    FrameHistory<TestState> history(60);
+    std::vector<EntityId> ids{1, 2};
+    std::vector<TestState> states{{1.0F, 1.0F, 0, 0}, {2.0F, 2.0F, 0, 0}};
+    for (std::uint64_t tick = 10; tick < 20; ++tick)
+        history.addSnapshot(tick, ids, states, static_cast<std::uint32_t>(tick));
+
+    states[1].x = 42.0F;
+    history.addSnapshot(15, ids, states, 99);
+
+    EXPECT_FALSE(history.hasSnapshot(16));
+    EXPECT_EQ(history.getChecksum(15), 99U);
+    EXPECT_EQ(history.getChecksum(14), 14U);
+    FrameHistory<TestState>::Frame frame;
+    ASSERT_TRUE(history.getSnapshot(15, frame));
+    EXPECT_EQ(frame.states[1].x, 42.0F);
+}
+
+TEST(FrameHistory, GapsStartANewKeyframe)
+{
+    FrameHistory<TestState> history(60);
+    std::vector<EntityId> ids{5};
+    std::vector<TestState> states{{1.0F, 0.0F, 3, 0}};
+    history.addSnapshot(1, ids, states, 1);
+    states[0].score = 4;
+    history.addSnapshot(4, ids, states, 4);
+
+    FrameHistory<TestState>::Frame frame;
+    EXPECT_FALSE(history.hasSnapshot(2));
+    ASSERT_TRUE(history.getSnapshot(4, frame));
+    EXPECT_EQ(frame.states[0].score, 4);
+    ASSERT_TRUE(history.getSnapshot(1, frame));
+    EXPECT_EQ(frame.states[0].score, 3);
+}
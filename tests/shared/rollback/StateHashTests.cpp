@@ -0,0 +1,68 @@
+#include "rollback/StateHash.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(StateHash, IsIndependentOfUpdateOrder)
+{
+    StateHash forward;
+    StateHash backward;
+    for (EntityId id = 0; id < 50; ++id)
+        forward.update(id, {static_cast<float>(id), 2.0F, 100});
+    for (EntityId id = 50; id-- > 0;)
+        backward.update(id, {static_cast<float>(id), 2.0F, 100});
+
+    EXPECT_EQ(forward.value(), backward.value());
+    EXPECT_EQ(forward.size(), 50U);
+}
+
+TEST(StateHash, IncrementalValueMatchesAFreshHash)
+{
+    StateHash incremental;
+    for (EntityId id = 0; id < 20; ++id)
+        incremental.update(id, {1.0F, 1.0F, 10});
+    incremental.update(7, {3.5F, 1.0F, 10});
+    incremental.update(12, {1.0F, 1.0F, 4});
+    std::vector<EntityId> alive;
+    for (EntityId id = 0; id < 20; ++id) {
+        if (id != 3 && id != 19)
+            alive.push_back(id);
+    }
+    incremental.retain(alive);
+
+    StateHash fresh;
+    std::uint32_t sum = 0;
+    for (EntityId id : alive) {
+        StateHashFields fields{id == 7 ? 3.5F : 1.0F, 1.0F, static_cast<std::int16_t>(id == 12 ? 4 : 10)};
+        fresh.update(id, fields);
+        sum += StateHash::entityHash(id, fields);
+    }
+    EXPECT_EQ(incremental.value(), fresh.value());
+    EXPECT_EQ(incremental.value(), StateHash::combine(sum, static_cast<std::uint32_t>(alive.size())));
+}
+
+TEST(StateHash, OnlyRehashesChangedEntities)
+{
+    StateHash hash;
+    EXPECT_TRUE(hash.update(4, {1.0F, 2.0F, 3}));
+    EXPECT_FALSE(hash.update(4, {1.0F, 2.0F, 3}));
+    EXPECT_TRUE(hash.update(4, {1.0F, 2.5F, 3}));
+}
+
+TEST(StateHash, DetectsDivergence)
+{
+    StateHash a;
+    StateHash b;
+    a.update(1, {10.0F, 20.0F, 50});
+    b.update(1, {10.0F, 20.0F, 50});
+    EXPECT_EQ(a.value(), b.value());
+
+    b.update(1, {10.0F, 20.0F, 49});
+    EXPECT_NE(a.value(), b.value());
+
+    b.update(1, {10.0F, 20.0F, 50});
+    b.update(2, {0.0F, 0.0F, 0});
+    EXPECT_NE(a.value(), b.value());
+    b.erase(2);
+    EXPECT_EQ(a.value(), b.value());
+}